@@ -7,6 +7,7 @@
  */
 #include "sl_buffer.h"
 #include "sl_memory.h"
+#include <string.h>
 
 static sl_buffer_t *sli_buffer_last(sl_buffer_t *buffer);
 
@@ -32,12 +33,30 @@ sl_status_t sl_buffer_get_data(sl_buffer_t *buffer, uint16_t offset, uint8_t **d
 
 /*
  * Free data will attempt to free entire blocks of data up to the given offset
+ * The first block is owned by the caller, so it is emptied rather than freed. Offsets of the remaining data shift down accordingly.
+ * A block that is only partly below the offset is kept as is
  */
 sl_status_t sl_buffer_free_data(sl_buffer_t *buffer, uint16_t up_to_offset)
 {
-  UNUSED_PARAMETER(buffer);
-  UNUSED_PARAMETER(up_to_offset);
-  return SL_UNSUPPORTED;
+  if (buffer == NULL) {
+    return SL_ERROR;
+  }
+
+  if (up_to_offset < buffer->data_length) {
+    return SL_SUCCESS;
+  }
+  up_to_offset -= buffer->data_length;
+  buffer->data_length = 0;
+
+  // Release following blocks that lie entirely below the offset
+  while ((buffer->next != NULL) && (up_to_offset >= buffer->next->data_length)) {
+    sl_buffer_t *segment = buffer->next;
+    up_to_offset -= segment->data_length;
+    buffer->next  = segment->next;
+    segment->next = NULL;
+    sl_memory_free_buffer(segment, SL_MEMORY_FREE_BUFFER_CHAIN);
+  }
+  return SL_SUCCESS;
 }
 
 sl_status_t sl_buffer_expand(sl_buffer_t *buffer, uint16_t size_increase)
@@ -50,24 +69,101 @@ sl_status_t sl_buffer_expand(sl_buffer_t *buffer, uint16_t size_increase)
   return SL_SUCCESS;
 }
 
+/*
+ * sl_buffer_write copies data into the buffer chain starting at the given offset
+ * The chain is expanded with a new block when the data runs past its end
+ */
 sl_status_t sl_buffer_write(sl_buffer_t *buffer, uint16_t offset, void *data, uint16_t data_length)
 {
-  UNUSED_PARAMETER(buffer);
-  UNUSED_PARAMETER(offset);
-  UNUSED_PARAMETER(data);
-  UNUSED_PARAMETER(data_length);
-  return SL_UNSUPPORTED;
+  const uint8_t *source = (const uint8_t *)data;
+  sl_buffer_t *segment  = buffer;
+  uint32_t chain_length = 0;
+
+  if ((buffer == NULL) || ((data == NULL) && (data_length != 0))) {
+    return SL_ERROR;
+  }
+  if (data_length == 0) {
+    return SL_SUCCESS;
+  }
+
+  // Make sure the chain can hold offset + data_length bytes before anything is copied
+  while (segment != NULL) {
+    chain_length += segment->data_length;
+    segment = segment->next;
+  }
+  if ((uint32_t)offset + data_length > chain_length) {
+    uint32_t size_increase = (uint32_t)offset + data_length - chain_length;
+    if (size_increase > UINT16_MAX) {
+      return SL_ERROR;
+    }
+    sl_status_t status = sl_buffer_expand(buffer, (uint16_t)size_increase);
+    if (status != SL_SUCCESS) {
+      return status;
+    }
+  }
+
+  // Skip the blocks that end before the offset
+  segment = buffer;
+  while (offset >= segment->data_length) {
+    offset -= segment->data_length;
+    segment = segment->next;
+  }
+
+  while (data_length > 0) {
+    uint16_t chunk = segment->data_length - offset;
+    if (chunk > data_length) {
+      chunk = data_length;
+    }
+    memcpy(segment->data + offset, source, chunk);
+    source += chunk;
+    data_length -= chunk;
+    offset  = 0;
+    segment = segment->next;
+  }
+  return SL_SUCCESS;
 }
 
 /*
  * sl_buffer_read will copy data into the user buffer and then free it
+ * Blocks that are completely read are released. A partly read block is advanced past the data read
  */
 sl_status_t sl_buffer_read(sl_buffer_t *buffer, void *user_buffer, uint16_t user_buffer_length)
 {
-  UNUSED_PARAMETER(buffer);
-  UNUSED_PARAMETER(user_buffer);
-  UNUSED_PARAMETER(user_buffer_length);
-  return SL_UNSUPPORTED;
+  uint8_t *destination = (uint8_t *)user_buffer;
+  sl_buffer_t *segment = buffer;
+  uint32_t available   = 0;
+
+  if ((buffer == NULL) || ((user_buffer == NULL) && (user_buffer_length != 0))) {
+    return SL_ERROR;
+  }
+
+  // Nothing is consumed unless the whole request can be satisfied
+  while ((segment != NULL) && (available < user_buffer_length)) {
+    available += segment->data_length;
+    segment = segment->next;
+  }
+  if (available < user_buffer_length) {
+    return SL_ERROR;
+  }
+
+  uint16_t remaining = user_buffer_length;
+  segment            = buffer;
+  while (remaining > 0) {
+    uint16_t chunk = (segment->data_length < remaining) ? segment->data_length : remaining;
+    memcpy(destination, segment->data, chunk);
+    destination += chunk;
+    remaining -= chunk;
+    if (chunk < segment->data_length) {
+      // Last block is only partly read. It is kept, so drop the bytes read from its front
+      segment->data += chunk;
+      segment->data_length -= chunk;
+      user_buffer_length -= chunk;
+      break;
+    }
+    segment = segment->next;
+  }
+
+  return sl_buffer_free_data(buffer, user_buffer_length);
 }
 
 static sl_buffer_t *sli_buffer_last(sl_buffer_t *buffer)
@@ -22,7 +22,9 @@ sl_buffer_t *sl_memory_allocate_buffer(sl_buffer_type_t type, uint16_t size)
 #else
   buffer = malloc(size + sizeof(sl_buffer_t));
   if (buffer != NULL) {
-    buffer->type        = type | SL_BUFFER_OBJECT_ALLOCATED | SL_BUFFER_DATA_ALLOCATED;
+    // Data storage shares the allocation of the buffer object, so it is released together with the object
+    buffer->type        = type | SL_BUFFER_OBJECT_ALLOCATED;
+    buffer->next        = NULL;
     buffer->data        = &buffer[1];
     buffer->data_length = size;
     buffer->next_length = 0;
@@ -42,6 +44,7 @@ sl_buffer_t *sl_memory_make_into_buffer(sl_buffer_type_t type, void *data, uint1
   buffer = malloc(sizeof(sl_buffer_t));
   if (buffer != NULL) {
     buffer->type        = type | SL_BUFFER_OBJECT_ALLOCATED;
+    buffer->next        = NULL;
     buffer->data        = data;
     buffer->data_length = data_size;
     buffer->next_length = 0;
@@ -244,7 +244,56 @@ void console_add_to_history(const char *line, uint8_t line_length)
   console_history_end                         = (console_history_end + 1) % sizeof(console_history_buffer);
 }
 
-// Simple linear database search. This function could be replaced with a more complicated version
+// Binary search of a sorted database. Returns the index of the first key that is not less than token
+static uint32_t console_database_lower_bound(const console_database_t *db, const char *token)
+{
+  uint32_t low  = 0;
+  uint32_t high = db->length;
+
+  while (low < high) {
+    uint32_t middle = low + ((high - low) / 2);
+    if (strcmp(db->entries[middle].key, token) < 0) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  return low;
+}
+
+// Find the entry matching token. Sorted databases use a binary search, others a linear scan
+static sl_status_t console_lookup_entry(const console_database_t *db,
+                                        const char *token,
+                                        size_t token_length,
+                                        uint32_t *index)
+{
+  if (db->flags & CONSOLE_DATABASE_SORTED) {
+    uint32_t i = console_database_lower_bound(db, token);
+    if ((i == db->length) || (strncmp(token, db->entries[i].key, token_length) != 0)) {
+      return SL_STATUS_FAIL;
+    }
+    *index = i;
+    // An exact match sorts before every longer key sharing the prefix
+    if (db->entries[i].key[token_length] == '\0') {
+      return SL_STATUS_OK;
+    }
+#if CONSOLE_UNIQUE_PREFIX_MATCH
+    if (((i + 1) == db->length) || (strncmp(token, db->entries[i + 1].key, token_length) != 0)) {
+      return SL_STATUS_OK;
+    }
+#endif
+    return SL_STATUS_COMMAND_INCOMPLETE;
+  }
+
+  for (uint32_t i = 0; i < db->length; i++) {
+    if (strncmp(token, db->entries[i].key, token_length) == 0) {
+      *index = i;
+      return (strlen(db->entries[i].key) == token_length) ? SL_STATUS_OK : SL_STATUS_COMMAND_INCOMPLETE;
+    }
+  }
+  return SL_STATUS_FAIL;
+}
+
 sl_status_t console_find_command(char **string,
                                  const char *string_end,
                                  const console_database_t *db,
@@ -271,22 +320,17 @@ sl_status_t console_find_command(char **string,
       return SL_STATUS_FAIL;
 
     size_t token_length = strlen(token);
+    uint32_t index      = 0;
 
-    for (uint32_t i = 0; i < db->length; i++) {
-      if (strncmp(token, db->entries[i].key, token_length) == 0) {
-        *entry          = &(db->entries[i]);
-        *starting_index = i;
-
-        if (strlen(db->entries[i].key) == token_length) {
-          break;
-        } else {
-          return SL_STATUS_COMMAND_INCOMPLETE;
-        }
-      }
-    }
-    if (*entry == NULL) {
+    status = console_lookup_entry(db, token, token_length, &index);
+    if (status == SL_STATUS_FAIL) {
       return SL_STATUS_FAIL;
     }
+    *entry          = &(db->entries[index]);
+    *starting_index = index;
+    if (status == SL_STATUS_COMMAND_INCOMPLETE) {
+      return SL_STATUS_COMMAND_INCOMPLETE;
+    }
 
     output_command                               = (const console_descriptive_command_t *)(*entry)->value;
     const console_argument_type_t *argument_list = &(output_command->argument_list[0]);
@@ -20,6 +20,7 @@
 #include "console_types.h"
 #include "sl_status.h"
 #include <stdint.h>
+#include <stdbool.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -62,6 +63,7 @@ void console_print_command_args(const console_descriptive_command_t *command);
 
 char *console_get_command_buffer(void);
 uint32_t console_read_data_from_cache(char *buffer, uint32_t buffer_size);
+bool console_check_and_clear_rx_overflow(void);
 
 #ifdef SLI_AT_COMMAND_SUPPORT
 sl_status_t console_process_at_command_buffer(const console_database_t *command_database,
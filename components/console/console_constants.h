@@ -37,6 +37,13 @@ extern "C" {
   .length  = sizeof((console_database_entry_t[]){ __VA_ARGS__ }) / sizeof(console_database_entry_t), \
   .entries = { __VA_ARGS__ }
 
+// Entries must be in ascending key order. Used by generated databases so lookups can binary search
+#define CONSOLE_SORTED_DATABASE_ENTRIES(...) .flags = CONSOLE_DATABASE_SORTED, CONSOLE_DATABASE_ENTRIES(__VA_ARGS__)
+
+// Entries must be in ascending key order ignoring case. Used by generated AT command databases
+#define CONSOLE_NOCASE_SORTED_DATABASE_ENTRIES(...) \
+  .flags = CONSOLE_DATABASE_SORTED_NOCASE, CONSOLE_DATABASE_ENTRIES(__VA_ARGS__)
+
 #define CONSOLE_VARIABLE(name_string, var, ...)                   \
   {                                                               \
     .name = name_string, .variable = var, .type = { __VA_ARGS__ } \
@@ -110,6 +117,16 @@ extern "C" {
 #define CONSOLE_ARG_OPTIONAL_CHARACTER_MASK 0x7F
 #define CONSOLE_ARG_ENUM_INDEX_MASK         0x3F
 
+// Database flags
+#define CONSOLE_DATABASE_SORTED        (1 << 0) // Entries are sorted by key
+#define CONSOLE_DATABASE_SORTED_NOCASE (1 << 1) // Entries are sorted by key, ignoring case
+
+// Set to 1 to resolve a command token that is a prefix of exactly one key in a sorted database to that key.
+// Disabled by default, so an abbreviation doesn't silently start matching a different command when keys are added.
+#ifndef CONSOLE_UNIQUE_PREFIX_MATCH
+#define CONSOLE_UNIQUE_PREFIX_MATCH 0
+#endif
+
 /******************************************************
  *                   Enumerations
  ******************************************************/
@@ -40,6 +40,11 @@
 #define USER_RX_BUFFER_COUNT (4)
 #endif
 
+// Raw receive cache, drained by the line handler or directly by binary data consumers
+#ifndef USER_RX_CACHE_SIZE
+#define USER_RX_CACHE_SIZE USER_RX_BUFFER_SIZE
+#endif
+
 #define INVALID_INDEX (0xFF)
 
 // Special characters
@@ -93,9 +98,10 @@ static uint8_t user_rx_buffer[USER_RX_BUFFER_COUNT][USER_RX_BUFFER_SIZE];
 static uint16_t user_rx_buffer_write_pointer = 0;
 static uint8_t current_buffer_index          = 0;
 static uint8_t buffer_ready_index            = INVALID_INDEX;
-static uint8_t uart_rx_cache[USER_RX_BUFFER_SIZE];
+static uint8_t uart_rx_cache[USER_RX_CACHE_SIZE];
 static uint16_t uart_rx_write_iter = 0;
 static uint16_t uart_rx_read_iter  = 0;
+static volatile bool uart_rx_overflow = false;
 
 /******************************************************
  *               Function Definitions
@@ -131,11 +137,26 @@ sl_status_t console_process_buffer(const console_database_t *command_database,
 
 void cache_uart_rx_data(const char character)
 {
+  uint16_t next_write_iter = (uart_rx_write_iter + 1) % sizeof(uart_rx_cache);
+
+  // Drop the character rather than overwrite data that hasn't been read yet
+  if (next_write_iter == uart_rx_read_iter) {
+    uart_rx_overflow        = true;
+    console_data_rx_receive = 1;
+    return;
+  }
   uart_rx_cache[uart_rx_write_iter] = character;
-  uart_rx_write_iter                = (uart_rx_write_iter + 1) % sizeof(uart_rx_cache);
+  uart_rx_write_iter                = next_write_iter;
   console_data_rx_receive           = 1;
 }
 
+bool console_check_and_clear_rx_overflow(void)
+{
+  bool overflow    = uart_rx_overflow;
+  uart_rx_overflow = false;
+  return overflow;
+}
+
 uint32_t console_read_data_from_cache(char *buffer, uint32_t buffer_size)
 {
   uint32_t a = 0;
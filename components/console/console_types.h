@@ -62,6 +62,7 @@ typedef struct {
 
 typedef struct {
   uint32_t length;
+  uint32_t flags; // CONSOLE_DATABASE_* flags
   console_database_entry_t entries[];
 } console_database_t;
 
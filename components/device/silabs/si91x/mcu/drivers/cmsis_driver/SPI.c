@@ -637,6 +637,20 @@ void RSI_SPI_Slave_Set_CS_Init_State(void)
 {
   SPI_Slave_Set_CS_Init_State(&SSI_SLAVE_Resources);
 }
+int32_t RSI_SPI_Slave_Send_Gather(const SPI_GATHER_SEGMENT *segments,
+                                  uint32_t segment_count,
+                                  RSI_UDMA_DESC_T *task_list,
+                                  uint32_t task_list_len)
+{
+  return SPI_Send_Gather(segments,
+                         segment_count,
+                         task_list,
+                         task_list_len,
+                         &SSI_SLAVE_Resources,
+                         &UDMA0_Resources,
+                         udma0_chnl_info,
+                         udmaHandle0);
+}
 uint8_t RSI_SPI_GetSlaveSelectNumber(void)
 {
 	return spi_slavenumber;
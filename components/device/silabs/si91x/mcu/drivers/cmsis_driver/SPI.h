@@ -441,6 +441,12 @@ typedef struct SPI_TRANSFER_INFO {
 	uint16_t              def_val;        // Default transfer value
 } SPI_TRANSFER_INFO;
 
+/* SPI Gather Segment, one contiguous part of a gathered transmission */
+typedef struct SPI_GATHER_SEGMENT {
+	const void           *data;           // Pointer to the segment data
+	uint32_t              num;            // Number of data items in the segment
+} SPI_GATHER_SEGMENT;
+
 typedef struct _SPI_CLOCK
 {
    SSI_MST_CLK_SRC_SEL_T  spi_clk_src;
@@ -464,6 +470,10 @@ typedef struct {
 void RSI_SPI_SetSlaveSelectNumber(uint8_t slavenumber);
 void RSI_SPI_Slave_Disable(void);
 void RSI_SPI_Slave_Set_CS_Init_State(void);
+int32_t RSI_SPI_Slave_Send_Gather(const SPI_GATHER_SEGMENT *segments,
+                                  uint32_t segment_count,
+                                  RSI_UDMA_DESC_T *task_list,
+                                  uint32_t task_list_len);
 int32_t SSI_MASTER_Receive_Command_Data (void *data, uint32_t num, uint32_t instruction, uint32_t address, uint32_t wait_cycle);
 int32_t SSI_MASTER_Send_Command_Data (void *data, uint32_t num, uint32_t instruction, uint32_t address);
 #endif /* __SPI_H */
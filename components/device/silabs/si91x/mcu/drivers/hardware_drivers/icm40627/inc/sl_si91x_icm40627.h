@@ -123,6 +123,8 @@ extern "C" {
   0 /**< This bit automatically sets to 1 when an AGC Ready interrupt is generated.The bit clears to 0 after the register has been read. >**/
 #define SL_ICM40627_MASK_DATA_RDY_INT   (1 << SL_ICM40627_BIT_DATA_RDY_INT)
 #define SL_ICM40627_MASK_RESET_DONE_INT (1 << SL_ICM40627_BIT_RESET_DONE_INT)
+#define SL_ICM40627_MASK_FIFO_THS_INT   (1 << SL_ICM40627_BIT_FIFO_THS_INT)
+#define SL_ICM40627_MASK_FIFO_FULL_INT  (1 << SL_ICM40627_BIT_FIFO_FULL_INT)
 
 #define SL_ICM40627_INTF_CONFIG0_MASK_UI_SIFS_CFG (0x03)
 
@@ -194,6 +196,10 @@ extern "C" {
 #define SL_ICM40627_BIT_FIFO_THS_INT1_EN   2 /**<  FIFO threshold interrupt >**/
 #define SL_ICM40627_BIT_FIFO_FULL_INT1_EN  1 /**< FIFO full interrupt >**/
 #define SL_ICM40627_BIT_UI_AGC_RDY_INT1_EN 0 /**< UI AGC ready interrupt >**/
+#define SL_ICM40627_MASK_FIFO_THS_INT1_EN \
+  (1 << SL_ICM40627_BIT_FIFO_THS_INT1_EN) /**<  FIFO threshold interrupt Bit Mask >**/
+#define SL_ICM40627_MASK_FIFO_FULL_INT1_EN \
+  (1 << SL_ICM40627_BIT_FIFO_FULL_INT1_EN) /**<  FIFO full interrupt Bit Mask >**/
 
 #define SL_ICM40627_REG_INT_SOURCE1   (SL_ICM40627_BANK_0 | 0x66) /**< INT_SOURCE1 >**/
 #define SL_ICM40627_BIT_SMD_INT1_EN   3                           /**< SMD interrupt >**/
@@ -367,9 +373,67 @@ extern "C" {
 #define SL_ICM40627_REG_OFFSET_USER7 (SL_ICM40627_BANK_4 | 0x7E) /**< Upper Bits of Y-Accel & Z-Accel Offset Register */
 #define SL_ICM40627_REG_OFFSET_USER8 (SL_ICM40627_BANK_4 | 0x7F) /**< Lower Bits of Z-Accel Offset Register */
 
+/**************************************************************************/ /**
+* @name FIFO streaming
+* @{
+******************************************************************************/
+#define SL_ICM40627_FIFO_CONFIG_MODE_BYPASS      0x00 /**< FIFO bypass mode */
+#define SL_ICM40627_FIFO_CONFIG_MODE_STREAM      0x40 /**< Stream-to-FIFO mode */
+#define SL_ICM40627_FIFO_CONFIG1_ACCEL_EN        0x01 /**< Write accelerometer data to the FIFO */
+#define SL_ICM40627_FIFO_CONFIG1_GYRO_EN         0x02 /**< Write gyroscope data to the FIFO */
+#define SL_ICM40627_FIFO_CONFIG1_TEMP_EN         0x04 /**< Write temperature data to the FIFO */
+#define SL_ICM40627_FIFO_CONFIG1_TMST_FSYNC_EN   0x08 /**< Write the timestamp to the FIFO */
+#define SL_ICM40627_FIFO_CONFIG1_WM_GT_TH        0x20 /**< Watermark interrupt on every ODR above it */
+#define SL_ICM40627_FIFO_CONFIG3_MASK_WM         0x0F /**< Upper bits of the FIFO watermark */
+#define SL_ICM40627_BIT_FIFO_FLUSH               0x02 /**< SIGNAL_PATH_RESET: flush the FIFO */
+#define SL_ICM40627_TMST_CONFIG_BIT_TMST_EN      0x01 /**< Enable the timestamp register */
+#define SL_ICM40627_TMST_CONFIG_BIT_TMST_DELTA   0x04 /**< Timestamp field holds the delta from the previous packet */
+#define SL_ICM40627_TMST_CONFIG_BIT_TMST_RES     0x08 /**< Timestamp resolution, 16 us when set, 1 us when clear */
+#define SL_ICM40627_FIFO_HEADER_MSG              0x80 /**< FIFO is empty */
+#define SL_ICM40627_FIFO_HEADER_ACCEL            0x40 /**< Packet holds accelerometer data */
+#define SL_ICM40627_FIFO_HEADER_GYRO             0x20 /**< Packet holds gyroscope data */
+#define SL_ICM40627_FIFO_HEADER_MASK_TIMESTAMP   0x0C /**< Timestamp field bitmask */
+#define SL_ICM40627_FIFO_HEADER_TIMESTAMP_ODR    0x08 /**< Packet holds the ODR timestamp */
+#define SL_ICM40627_FIFO_SIZE                    2048 /**< FIFO size in bytes */
+#define SL_ICM40627_FIFO_PACKET_SIZE             16   /**< Header, accel, gyro, temperature and timestamp */
+#define SL_ICM40627_FIFO_TIMESTAMP_RESOLUTION_US 1    /**< Resolution of the FIFO timestamp */
+/**@}*/
+
 #define ICM40627_DEVICE_ID (0x4E) /**< ICM40627 Device ID value    */
 /** @endcond */
 
+/***************************************************************************/ /**
+ * @brief ICM40627 FIFO frame.
+ *
+ * @details One sample of the accelerometer, gyroscope and temperature sensor,
+ *          as read from the FIFO in streaming mode.
+ ******************************************************************************/
+typedef struct {
+  int16_t accel[3];      ///< Raw accelerometer data, multiply by the accel resolution to get g
+  int16_t gyro[3];       ///< Raw gyroscope data, multiply by the gyro resolution to get deg/sec
+  int8_t temperature;    ///< Raw temperature, (temperature / 2.07) + 25 gives Celsius
+  uint64_t timestamp_us; ///< Sampling time in microseconds, counted from the first frame of the stream
+} sl_icm40627_fifo_frame_t;
+
+/***************************************************************************/ /**
+ * @brief ICM40627 FIFO stream context.
+ *
+ * @details Owned by the application and passed to every FIFO streaming API.
+ *          The buffer receives whole FIFO bursts, it is used as both the SPI
+ *          transmit and receive buffer so that a DMA configured SSI instance
+ *          reads the FIFO in a single transfer.
+ ******************************************************************************/
+typedef struct {
+  uint8_t *buffer;         ///< Burst read buffer, holds the register address byte and whole FIFO packets
+  uint16_t buffer_size;    ///< Size of the buffer in bytes, at least SL_ICM40627_FIFO_PACKET_SIZE + 1
+  uint16_t watermark;      ///< Number of frames that raise the FIFO threshold interrupt
+  uint16_t last_timestamp; ///< 16-bit FIFO timestamp of the last frame
+  bool timestamp_valid;    ///< Set once the first frame of the stream is read
+  uint64_t timestamp_us;   ///< Reconstructed timestamp of the last frame
+  uint32_t frames_read;    ///< Number of frames read since the stream was started
+  uint32_t frames_lost;    ///< Number of frames overwritten in the FIFO before they were read
+} sl_icm40627_fifo_stream_t;
+
 /***************************************************************************/ /**
  * @brief
  *    Select the desired Register bank.
@@ -853,6 +917,103 @@ sl_status_t sl_si91x_icm40627_get_temperature_data(sl_ssi_handle_t ssi_driver_ha
  ******************************************************************************/
 sl_status_t sl_si91x_icm40627_get_device_id(sl_ssi_handle_t ssi_driver_handle, uint8_t *dev_id);
 
+/***************************************************************************/ /**
+ * @brief
+ *    Start streaming the accelerometer, gyroscope, temperature and timestamp
+ *    to the FIFO.
+ *
+ * @details
+ *    Flushes the FIFO, sets the watermark and enables the FIFO threshold and
+ *    FIFO full interrupts on INT1, then puts the FIFO in stream mode. The
+ *    sensors and the sample rate are configured separately with
+ *    @ref sl_si91x_icm40627_enable_sensor and
+ *    @ref sl_si91x_icm40627_set_sample_rate. The timestamps are 16-bit
+ *    with 1 us resolution and are extended in software, so the FIFO must be
+ *    read at least every 65 ms.
+ *
+ * @param[in] ssi_driver_handle
+ *    The handle to the SSI driver used for communication with the ICM40627 sensor
+ *
+ * @param[in,out] stream
+ *    Stream context with buffer and buffer_size set by the application. The
+ *    other members are reset.
+ *
+ * @param[in] watermark
+ *    Number of frames in the FIFO that raise the threshold interrupt,
+ *    1 to SL_ICM40627_FIFO_SIZE / SL_ICM40627_FIFO_PACKET_SIZE.
+ *
+ * @return sl_status_t Status code indicating the result:
+ *         - SL_STATUS_OK  - Success.
+ *         - SL_STATUS_NULL_POINTER  - The stream or its buffer is NULL.
+ *         - SL_STATUS_INVALID_PARAMETER  - The parameter is an invalid argument.
+ *
+ * For more information on status codes, see [SL STATUS DOCUMENTATION](
+ * https://docs.silabs.com/gecko-platform/latest/platform-common/status).
+ ******************************************************************************/
+sl_status_t sl_si91x_icm40627_fifo_stream_start(sl_ssi_handle_t ssi_driver_handle,
+                                                sl_icm40627_fifo_stream_t *stream,
+                                                uint16_t watermark);
+
+/***************************************************************************/ /**
+ * @brief
+ *    Stop FIFO streaming.
+ *
+ * @details
+ *    Puts the FIFO in bypass mode and disables the FIFO interrupts on INT1.
+ *
+ * @param[in] ssi_driver_handle
+ *    The handle to the SSI driver used for communication with the ICM40627 sensor
+ *
+ * @return sl_status_t Status code indicating the result:
+ *         - SL_STATUS_OK  - Success.
+ *         - SL_STATUS_INVALID_PARAMETER  - The parameter is an invalid argument.
+ *
+ * For more information on status codes, see [SL STATUS DOCUMENTATION](
+ * https://docs.silabs.com/gecko-platform/latest/platform-common/status).
+ ******************************************************************************/
+sl_status_t sl_si91x_icm40627_fifo_stream_stop(sl_ssi_handle_t ssi_driver_handle);
+
+/***************************************************************************/ /**
+ * @brief
+ *    Read the frames available in the FIFO.
+ *
+ * @details
+ *    Reads the interrupt status and FIFO count in one burst, then reads as
+ *    many whole FIFO packets as fit in frames and in the stream buffer in a
+ *    second burst, and decodes them. Reading the interrupt status clears the
+ *    FIFO interrupts. If the FIFO overflowed, the number of lost frames is
+ *    added to the stream counters. Typically called when INT1 is raised by
+ *    the FIFO threshold interrupt, and again while frames are returned.
+ *
+ * @param[in] ssi_driver_handle
+ *    The handle to the SSI driver used for communication with the ICM40627 sensor
+ *
+ * @param[in,out] stream
+ *    Stream context started with @ref sl_si91x_icm40627_fifo_stream_start.
+ *
+ * @param[out] frames
+ *    Array receiving the decoded frames.
+ *
+ * @param[in] max_frames
+ *    Number of entries in frames.
+ *
+ * @param[out] frame_count
+ *    Number of frames stored in frames, 0 when the FIFO is empty.
+ *
+ * @return sl_status_t Status code indicating the result:
+ *         - SL_STATUS_OK  - Success.
+ *         - SL_STATUS_NULL_POINTER  - A pointer parameter is NULL.
+ *         - SL_STATUS_INVALID_PARAMETER  - The parameter is an invalid argument.
+ *
+ * For more information on status codes, see [SL STATUS DOCUMENTATION](
+ * https://docs.silabs.com/gecko-platform/latest/platform-common/status).
+ ******************************************************************************/
+sl_status_t sl_si91x_icm40627_fifo_read_frames(sl_ssi_handle_t ssi_driver_handle,
+                                               sl_icm40627_fifo_stream_t *stream,
+                                               sl_icm40627_fifo_frame_t *frames,
+                                               uint16_t max_frames,
+                                               uint16_t *frame_count);
+
 /// @} end group ICM40627 ********************************************************/
 
 // ******** THE REST OF THE FILE IS DOCUMENTATION ONLY !***********************
@@ -878,6 +1039,7 @@ sl_status_t sl_si91x_icm40627_get_device_id(sl_ssi_handle_t ssi_driver_handle, u
 * 7. *Configure full-scale ranges for accelerometer and gyroscope:* @ref sl_si91x_icm40627_set_accel_full_scale, @ref sl_si91x_icm40627_set_gyro_full_scale
 * 8. *Enable or disable sensor interrupts:* @ref sl_si91x_icm40627_enable_interrupt
 * 9. *Calibrate accelerometer and gyroscope biases:* @ref sl_si91x_icm40627_calibrate_accel_and_gyro
+* 10. *Stream samples through the FIFO:* @ref sl_si91x_icm40627_fifo_stream_start, @ref sl_si91x_icm40627_fifo_read_frames, @ref sl_si91x_icm40627_fifo_stream_stop
 *
 * @li Typical usage sequence:
 *   - *Initialize the sensor:* Use @ref sl_si91x_icm40627_init before other operations.
@@ -887,6 +1049,11 @@ sl_status_t sl_si91x_icm40627_get_device_id(sl_ssi_handle_t ssi_driver_handle, u
 *   - *Read sensor data:* Use @ref sl_si91x_icm40627_get_accel_data, @ref sl_si91x_icm40627_get_gyro_data, and @ref sl_si91x_icm40627_get_temperature_data to acquire measurements.
 *   - *Calibrate sensors if necessary:* Use @ref sl_si91x_icm40627_calibrate_accel_and_gyro for bias correction.
 *
+* @li FIFO streaming, for sample rates where reading every sample is too costly (up to 8 kHz):
+*   - *Start the stream:* Use @ref sl_si91x_icm40627_fifo_stream_start with a watermark, after the sensors and sample rate are configured.
+*   - *Read batches:* On the INT1 interrupt, call @ref sl_si91x_icm40627_fifo_read_frames from thread context until it returns no frames. Each frame carries a reconstructed timestamp.
+*   - *Stop the stream:* Use @ref sl_si91x_icm40627_fifo_stream_stop.
+*
 * @li See the Function Documentation for detailed usage information of all APIs.
 *
 *
@@ -33,6 +33,7 @@
 #include "sl_si91x_ssi.h"
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 #include "sl_sleeptimer.h"
 
 /*******************************************************************************
@@ -60,6 +61,7 @@ static sl_status_t icm40627_read_register(sl_ssi_handle_t ssi_driver_handle,
                                           uint16_t reg_addr,
                                           uint8_t *data_in,
                                           uint32_t num_bytes);
+static sl_status_t icm40627_read_fifo(sl_ssi_handle_t ssi_driver_handle, uint8_t *buffer, uint32_t length);
 
 /** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
 
@@ -211,6 +213,34 @@ static sl_status_t icm40627_read_register(sl_ssi_handle_t ssi_driver_handle,
   return status;
 }
 
+/***************************************************************************/ /**
+ *    Reads length - 1 bytes from the FIFO data port in a single transfer.
+ *    The buffer is used for both directions, each byte is received after it
+ *    is sent, so the data lands at buffer[1] without an intermediate copy.
+ ******************************************************************************/
+static sl_status_t icm40627_read_fifo(sl_ssi_handle_t ssi_driver_handle, uint8_t *buffer, uint32_t length)
+{
+  sl_status_t status;
+
+  status = icm40627_select_register_bank(ssi_driver_handle, (SL_ICM40627_REG_FIFO_DATA >> 8));
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  buffer[0] = (uint8_t)(SL_ICM40627_REG_FIFO_DATA | 0x80); // Set R/W bit
+  memset(&buffer[1], DUMMY_DATA, length - 1);
+
+  status = sl_si91x_ssi_transfer_data(ssi_driver_handle, buffer, buffer, length);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  // wait till the read operation is completed
+  wait_till_ssi_gets_idle(ssi_driver_handle);
+
+  return status;
+}
+
 /***************************************************************************/ /**
  *    Writes a register in the ICM40627 device
  ******************************************************************************/
@@ -1265,6 +1295,235 @@ sl_status_t sl_si91x_icm40627_calibrate_accel_and_gyro(sl_ssi_handle_t ssi_drive
   return SL_STATUS_OK;
 }
 
+/***************************************************************************/ /**
+ *    Starts streaming the sensors and the timestamp to the FIFO
+ ******************************************************************************/
+sl_status_t sl_si91x_icm40627_fifo_stream_start(sl_ssi_handle_t ssi_driver_handle,
+                                                sl_icm40627_fifo_stream_t *stream,
+                                                uint16_t watermark)
+{
+  sl_status_t status;
+  uint8_t reg;
+  uint16_t threshold;
+  uint32_t ssi_data_length = 2;
+  uint8_t ssi_data[ssi_data_length];
+
+  if ((stream == NULL) || (stream->buffer == NULL)) {
+    return SL_STATUS_NULL_POINTER;
+  }
+  if ((watermark == 0) || (watermark > (SL_ICM40627_FIFO_SIZE / SL_ICM40627_FIFO_PACKET_SIZE))
+      || (stream->buffer_size < (SL_ICM40627_FIFO_PACKET_SIZE + 1))) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  stream->watermark       = watermark;
+  stream->last_timestamp  = 0;
+  stream->timestamp_valid = false;
+  stream->timestamp_us    = 0;
+  stream->frames_read     = 0;
+  stream->frames_lost     = 0;
+
+  /* Keep the FIFO in bypass mode while it is configured */
+  reg    = SL_ICM40627_FIFO_CONFIG_MODE_BYPASS;
+  status = icm40627_write_register(ssi_driver_handle, SL_ICM40627_REG_FIFO_CONFIG, &reg, ssi_data_length - 1);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  /* Absolute timestamps with 1 us resolution, extended to 64 bits when the frames are read */
+  status = icm40627_read_register(ssi_driver_handle, SL_ICM40627_REG_TMST_CONFIG, ssi_data, ssi_data_length);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+  reg = ssi_data[ssi_data_length - 1];
+  reg |= SL_ICM40627_TMST_CONFIG_BIT_TMST_EN;
+  reg &= ~(SL_ICM40627_TMST_CONFIG_BIT_TMST_DELTA | SL_ICM40627_TMST_CONFIG_BIT_TMST_RES);
+  status = icm40627_write_register(ssi_driver_handle, SL_ICM40627_REG_TMST_CONFIG, &reg, ssi_data_length - 1);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  /* The watermark is set in bytes, FIFO_CONFIG3 holds the upper bits */
+  threshold = watermark * SL_ICM40627_FIFO_PACKET_SIZE;
+  reg       = (uint8_t)(threshold & 0xFF);
+  status    = icm40627_write_register(ssi_driver_handle, SL_ICM40627_REG_FIFO_CONFIG2, &reg, ssi_data_length - 1);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+  status = icm40627_read_register(ssi_driver_handle, SL_ICM40627_REG_FIFO_CONFIG3, ssi_data, ssi_data_length);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+  reg = ssi_data[ssi_data_length - 1];
+  reg &= ~(SL_ICM40627_FIFO_CONFIG3_MASK_WM);
+  reg |= ((threshold >> 8) & SL_ICM40627_FIFO_CONFIG3_MASK_WM);
+  status = icm40627_write_register(ssi_driver_handle, SL_ICM40627_REG_FIFO_CONFIG3, &reg, ssi_data_length - 1);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  /* Accel, gyro, temperature and timestamp in every packet. The threshold interrupt is
+   * raised on every sample while the watermark is exceeded, so a missed interrupt is retried */
+  reg = SL_ICM40627_FIFO_CONFIG1_ACCEL_EN | SL_ICM40627_FIFO_CONFIG1_GYRO_EN | SL_ICM40627_FIFO_CONFIG1_TEMP_EN
+        | SL_ICM40627_FIFO_CONFIG1_TMST_FSYNC_EN | SL_ICM40627_FIFO_CONFIG1_WM_GT_TH;
+  status = icm40627_write_register(ssi_driver_handle, SL_ICM40627_REG_FIFO_CONFIG1, &reg, ssi_data_length - 1);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  /* Drop the packets stored before the stream was started */
+  reg    = SL_ICM40627_BIT_FIFO_FLUSH;
+  status = icm40627_write_register(ssi_driver_handle, SL_ICM40627_REG_SIGNAL_PATH_RESET, &reg, ssi_data_length - 1);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  /* Route the FIFO threshold and FIFO full interrupts to INT1 */
+  status = icm40627_read_register(ssi_driver_handle, SL_ICM40627_REG_INT_SOURCE0, ssi_data, ssi_data_length);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+  reg    = ssi_data[ssi_data_length - 1] | SL_ICM40627_MASK_FIFO_THS_INT1_EN | SL_ICM40627_MASK_FIFO_FULL_INT1_EN;
+  status = icm40627_write_register(ssi_driver_handle, SL_ICM40627_REG_INT_SOURCE0, &reg, ssi_data_length - 1);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  reg    = SL_ICM40627_FIFO_CONFIG_MODE_STREAM;
+  status = icm40627_write_register(ssi_driver_handle, SL_ICM40627_REG_FIFO_CONFIG, &reg, ssi_data_length - 1);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************/ /**
+ *    Stops FIFO streaming
+ ******************************************************************************/
+sl_status_t sl_si91x_icm40627_fifo_stream_stop(sl_ssi_handle_t ssi_driver_handle)
+{
+  sl_status_t status;
+  uint8_t reg;
+  uint32_t ssi_data_length = 2;
+  uint8_t ssi_data[ssi_data_length];
+
+  status = icm40627_read_register(ssi_driver_handle, SL_ICM40627_REG_INT_SOURCE0, ssi_data, ssi_data_length);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+  reg = ssi_data[ssi_data_length - 1];
+  reg &= ~(SL_ICM40627_MASK_FIFO_THS_INT1_EN | SL_ICM40627_MASK_FIFO_FULL_INT1_EN);
+  status = icm40627_write_register(ssi_driver_handle, SL_ICM40627_REG_INT_SOURCE0, &reg, ssi_data_length - 1);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  reg    = SL_ICM40627_FIFO_CONFIG_MODE_BYPASS;
+  status = icm40627_write_register(ssi_driver_handle, SL_ICM40627_REG_FIFO_CONFIG, &reg, ssi_data_length - 1);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************/ /**
+ *    Reads and decodes the frames available in the FIFO
+ ******************************************************************************/
+sl_status_t sl_si91x_icm40627_fifo_read_frames(sl_ssi_handle_t ssi_driver_handle,
+                                               sl_icm40627_fifo_stream_t *stream,
+                                               sl_icm40627_fifo_frame_t *frames,
+                                               uint16_t max_frames,
+                                               uint16_t *frame_count)
+{
+  sl_status_t status;
+  const uint8_t *packet;
+  sl_icm40627_fifo_frame_t *frame;
+  uint16_t fifo_count;
+  uint16_t packet_count;
+  uint16_t timestamp;
+  uint8_t int_status;
+  uint32_t ssi_data_length = 4;
+  uint8_t ssi_data[ssi_data_length];
+
+  if ((stream == NULL) || (stream->buffer == NULL) || (frames == NULL) || (frame_count == NULL)) {
+    return SL_STATUS_NULL_POINTER;
+  }
+  if (max_frames == 0) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  *frame_count = 0;
+
+  /* INT_STATUS, FIFO_COUNTH and FIFO_COUNTL are consecutive, read them in one burst */
+  status = icm40627_read_register(ssi_driver_handle, SL_ICM40627_REG_INT_STATUS, ssi_data, ssi_data_length);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+  int_status = ssi_data[1];
+  fifo_count = (uint16_t)((ssi_data[2] << 8) | ssi_data[3]);
+
+  if (int_status & SL_ICM40627_MASK_FIFO_FULL_INT) {
+    /* Packets dropped because the FIFO was full, FIFO_LOST_PKT0 holds the lower byte */
+    status = icm40627_read_register(ssi_driver_handle, SL_ICM40627_REG_FIFO_LOST_PKT0, ssi_data, 3);
+    if (status != SL_STATUS_OK) {
+      return status;
+    }
+    stream->frames_lost += (uint16_t)((ssi_data[2] << 8) | ssi_data[1]);
+  }
+
+  /* Only whole packets are read, a partial one is left for the next read */
+  packet_count = fifo_count / SL_ICM40627_FIFO_PACKET_SIZE;
+  if (packet_count > max_frames) {
+    packet_count = max_frames;
+  }
+  if (packet_count > ((stream->buffer_size - 1) / SL_ICM40627_FIFO_PACKET_SIZE)) {
+    packet_count = (stream->buffer_size - 1) / SL_ICM40627_FIFO_PACKET_SIZE;
+  }
+  if (packet_count == 0) {
+    return SL_STATUS_OK;
+  }
+
+  status = icm40627_read_fifo(ssi_driver_handle, stream->buffer, 1 + (packet_count * SL_ICM40627_FIFO_PACKET_SIZE));
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  packet = &stream->buffer[1];
+  for (uint16_t i = 0; i < packet_count; i++, packet += SL_ICM40627_FIFO_PACKET_SIZE) {
+    if (packet[0] & SL_ICM40627_FIFO_HEADER_MSG) {
+      /* The FIFO ran empty */
+      break;
+    }
+    frame = &frames[*frame_count];
+
+    /* Convert to 16 bit signed accel and gyro x,y and z values */
+    frame->accel[0]    = (int16_t)((packet[1] << 8) | packet[2]);
+    frame->accel[1]    = (int16_t)((packet[3] << 8) | packet[4]);
+    frame->accel[2]    = (int16_t)((packet[5] << 8) | packet[6]);
+    frame->gyro[0]     = (int16_t)((packet[7] << 8) | packet[8]);
+    frame->gyro[1]     = (int16_t)((packet[9] << 8) | packet[10]);
+    frame->gyro[2]     = (int16_t)((packet[11] << 8) | packet[12]);
+    frame->temperature = (int8_t)packet[13];
+
+    /* The 16-bit timestamp wraps every 65.536 ms, the unsigned difference is the
+     * time elapsed since the previous frame as long as the FIFO is read in time */
+    timestamp = (uint16_t)((packet[14] << 8) | packet[15]);
+    if (stream->timestamp_valid) {
+      stream->timestamp_us +=
+        (uint64_t)(uint16_t)(timestamp - stream->last_timestamp) * SL_ICM40627_FIFO_TIMESTAMP_RESOLUTION_US;
+    }
+    stream->timestamp_valid = true;
+    stream->last_timestamp  = timestamp;
+    frame->timestamp_us     = stream->timestamp_us;
+
+    (*frame_count)++;
+  }
+  stream->frames_read += *frame_count;
+
+  return SL_STATUS_OK;
+}
+
 /*******************************************************************************
  * Function to wait till GSPI communication completes
  *
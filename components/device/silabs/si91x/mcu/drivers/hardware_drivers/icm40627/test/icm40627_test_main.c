@@ -19,6 +19,7 @@
 #include "sl_si91x_driver_gpio.h"
 #include "sl_si91x_ssi.h"
 #include "rsi_rom_clks.h"
+#include "sl_sleeptimer.h"
 
 /*******************************************************************************
  ***************************  Defines / Macros  ********************************
@@ -27,6 +28,8 @@
 #define SSI_MASTER_BAUDRATE             10000000 // SSI baudrate
 #define SSI_MASTER_RECEIVE_SAMPLE_DELAY 0        // By default sample delay is 0
 #define DELAY_PERIODIC_MS1              2000     //sleeptimer1 periodic timeout in ms
+#define TEST_FIFO_WATERMARK             8        // FIFO watermark in frames
+#define TEST_FIFO_MAX_FRAMES            32       // Frames read per call
 
 /*******************************************************************************
  **********************  Local Function prototypes   ***************************
@@ -67,6 +70,7 @@ void test_icm40627_set_accel_bandwidth(void);
 void test_icm40627_set_gyro_bandwidth(void);
 void test_icm40627_software_reset(void);
 void test_icm40627_select_register_bank(void);
+void test_icm40627_fifo_stream(void);
 
 /******************************************************************************
  * Main function in which all the test cases are tested using unity framework
@@ -122,6 +126,7 @@ int app_init()
   RUN_TEST(test_icm40627_set_sample_rate, __LINE__);
   RUN_TEST(test_icm40627_gyro_set_sample_rate, __LINE__);
   RUN_TEST(test_icm40627_accel_set_sample_rate, __LINE__);
+  RUN_TEST(test_icm40627_fifo_stream, __LINE__);
   RUN_TEST(test_icm40627_enable_sleep_mode, __LINE__);
   RUN_TEST(test_icm40627_set_accel_bandwidth, __LINE__);
   RUN_TEST(test_icm40627_set_gyro_bandwidth, __LINE__);
@@ -521,6 +526,60 @@ void test_icm40627_set_sample_rate(void)
   UnityPrintf("ICM40627 set sample rate completed \n");
 }
 
+/*******************************************************************************
+ * Function to test FIFO streaming for ICM40627
+ ******************************************************************************/
+void test_icm40627_fifo_stream(void)
+{
+  UnityPrintf("\n");
+  UnityPrintf("Testing ICM40627 FIFO stream \n");
+  sl_status_t status;
+  static uint8_t buffer[1 + (TEST_FIFO_MAX_FRAMES * SL_ICM40627_FIFO_PACKET_SIZE)];
+  static sl_icm40627_fifo_frame_t frames[TEST_FIFO_MAX_FRAMES];
+  sl_icm40627_fifo_stream_t stream = { .buffer = buffer, .buffer_size = sizeof(buffer) };
+  uint16_t frame_count             = 0;
+
+  UnityPrintf("Testing with null parameter \n");
+  status = sl_si91x_icm40627_fifo_stream_start(test_ssi_driver_handle, NULL, TEST_FIFO_WATERMARK);
+  TEST_ASSERT_EQUAL_HEX(SL_STATUS_NULL_POINTER, status);
+  status =
+    sl_si91x_icm40627_fifo_read_frames(test_ssi_driver_handle, &stream, NULL, TEST_FIFO_MAX_FRAMES, &frame_count);
+  TEST_ASSERT_EQUAL_HEX(SL_STATUS_NULL_POINTER, status);
+  UnityPrintf("Testing with null parameter successfully \n");
+
+  UnityPrintf("Testing with invalid parameter \n");
+  status = sl_si91x_icm40627_fifo_stream_start(test_ssi_driver_handle, &stream, 0);
+  TEST_ASSERT_EQUAL_HEX(SL_STATUS_INVALID_PARAMETER, status);
+  status = sl_si91x_icm40627_fifo_stream_start(test_ssi_driver_handle,
+                                               &stream,
+                                               (SL_ICM40627_FIFO_SIZE / SL_ICM40627_FIFO_PACKET_SIZE) + 1);
+  TEST_ASSERT_EQUAL_HEX(SL_STATUS_INVALID_PARAMETER, status);
+  UnityPrintf("Testing with invalid parameter successfully \n");
+
+  sl_si91x_icm40627_set_sample_rate(test_ssi_driver_handle, 1000.0);
+  status = sl_si91x_icm40627_fifo_stream_start(test_ssi_driver_handle, &stream, TEST_FIFO_WATERMARK);
+  TEST_ASSERT_EQUAL_HEX(SL_STATUS_OK, status);
+  UnityPrintf("Status of API is correct, ICM40627 FIFO stream started successfully \n");
+
+  // 20 frames are stored at 1 kHz
+  sl_sleeptimer_delay_millisecond(20);
+  status =
+    sl_si91x_icm40627_fifo_read_frames(test_ssi_driver_handle, &stream, frames, TEST_FIFO_MAX_FRAMES, &frame_count);
+  TEST_ASSERT_EQUAL_HEX(SL_STATUS_OK, status);
+  TEST_ASSERT_TRUE(frame_count >= TEST_FIFO_WATERMARK);
+  for (uint16_t i = 1; i < frame_count; i++) {
+    TEST_ASSERT_TRUE(frames[i].timestamp_us > frames[i - 1].timestamp_us);
+  }
+  UnityPrintf("Frames read = %d, lost = %ld \n", frame_count, stream.frames_lost);
+  UnityPrintf("Status of API is correct, ICM40627 FIFO frames read successfully \n");
+
+  status = sl_si91x_icm40627_fifo_stream_stop(test_ssi_driver_handle);
+  TEST_ASSERT_EQUAL_HEX(SL_STATUS_OK, status);
+  UnityPrintf("Status of API is correct, ICM40627 FIFO stream stopped successfully \n");
+
+  UnityPrintf("ICM40627 FIFO stream completed \n");
+}
+
 /*******************************************************************************
  * Function to test enable sleep mode for ICM40627
  ******************************************************************************/
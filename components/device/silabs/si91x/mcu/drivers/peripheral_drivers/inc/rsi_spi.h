@@ -60,6 +60,14 @@ int32_t SPI_Send(const void *data,
                  UDMA_RESOURCES *udma,
                  UDMA_Channel_Info *chnl_info,
                  RSI_UDMA_HANDLE_T udmaHandle);
+int32_t SPI_Send_Gather(const SPI_GATHER_SEGMENT *segments,
+                        uint32_t segment_count,
+                        RSI_UDMA_DESC_T *task_list,
+                        uint32_t task_list_len,
+                        const SPI_RESOURCES *spi,
+                        UDMA_RESOURCES *udma,
+                        UDMA_Channel_Info *chnl_info,
+                        RSI_UDMA_HANDLE_T udmaHandle);
 int32_t SPI_Send_Command_Data(const void *data,
                               uint32_t num,
                               uint32_t instruction,
@@ -46,6 +46,7 @@
 #endif
 #else
 #include "rsi_rom_udma_wrapper.h"
+#include "rsi_rom_udma.h"
 #endif
 
 #include "sl_si91x_driver_gpio.h"
@@ -1727,6 +1728,153 @@ int32_t SPI_Send(const void *data,
   }
   return ARM_DRIVER_OK;
 }
+/**
+ * @fn           int32_t SPI_Send_Gather(const SPI_GATHER_SEGMENT *segments, uint32_t segment_count,
+ *                                       RSI_UDMA_DESC_T *task_list, uint32_t task_list_len,
+ *                                       const SPI_RESOURCES *spi, UDMA_RESOURCES *udma,
+ *                                       UDMA_Channel_Info *chnl_info, RSI_UDMA_HANDLE_T udmaHandle)
+ * @brief        Start sending several buffers to SPI transmitter as one transfer.
+ *               The transmit DMA channel runs a peripheral scatter-gather cycle with one task per segment,
+ *               so the segments are sent back to back without being copied or handled by the CPU in between.
+ *               Only 8-bit data frames and segments of up to DESC_MAX_LEN data items are supported.
+ * @param[in]    segments      : Pointer to the segments to send, in order
+ * @param[in]    segment_count : Number of segments
+ * @param[in]    task_list     : Pointer to the scatter-gather task list, it must stay valid until the transfer completes
+ * @param[in]    task_list_len : Number of tasks the task list can hold, at least segment_count
+ * @param[in]    spi           : Pointer to the spi resources
+ * @param[in]    udma          : Pointer to the udma resources
+ * @param[in]    chnl_info     : Pointer for channel info
+ * @param[in]    udmaHandle    : Pointer to the UDMA Handle
+ * @return       excecution status
+ */
+int32_t SPI_Send_Gather(const SPI_GATHER_SEGMENT *segments,
+                        uint32_t segment_count,
+                        RSI_UDMA_DESC_T *task_list,
+                        uint32_t task_list_len,
+                        const SPI_RESOURCES *spi,
+                        UDMA_RESOURCES *udma,
+                        UDMA_Channel_Info *chnl_info,
+                        RSI_UDMA_HANDLE_T udmaHandle)
+{
+#ifdef SL_SI91X_SSI_DMA
+  // The DMA driver does not expose scatter-gather transfers
+  (void)segments;
+  (void)segment_count;
+  (void)task_list;
+  (void)task_list_len;
+  (void)spi;
+  (void)udma;
+  (void)chnl_info;
+  (void)udmaHandle;
+  return ARM_DRIVER_ERROR_UNSUPPORTED;
+#else
+  volatile int32_t stat;
+  uint16_t data_width;
+  uint32_t total                     = 0;
+  RSI_UDMA_CHA_CONFIG_DATA_T control = { 0 };
+
+  if ((segments == NULL) || (segment_count == 0U) || (task_list == NULL) || (segment_count > task_list_len)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  if (!(spi->info->state & SPI_CONFIGURED)) {
+    return ARM_DRIVER_ERROR;
+  }
+  if (spi->info->status.busy) {
+    return ARM_DRIVER_ERROR_BUSY;
+  }
+  if ((spi->instance_mode == SPI_MASTER_MODE) || (spi->instance_mode == SPI_ULP_MASTER_MODE)) {
+    data_width = spi->reg->CTRLR0_b.DFS_32;
+  } else {
+    data_width = spi->reg->CTRLR0_b.DFS;
+  }
+  if ((spi->tx_dma == NULL) || (data_width > (8U - 1U))) {
+    return ARM_DRIVER_ERROR_UNSUPPORTED;
+  }
+
+  // Build one task per segment, every task but the last one loads the next from the list
+  control.transferType = UDMA_MODE_PER_SCATTER_GATHER | UDMA_MODE_ALT_SELECT;
+  control.nextBurst    = 0;
+  control.rPower       = ARBSIZE_1;
+  control.srcProtCtrl  = 0x0;
+  control.dstProtCtrl  = 0x0;
+  control.srcSize      = SRC_SIZE_8;
+  control.srcInc       = SRC_INC_8;
+  control.dstSize      = DST_SIZE_8;
+  control.dstInc       = DST_INC_NONE;
+  for (uint32_t segment = 0; segment < segment_count; segment++) {
+    const uint8_t *data = (const uint8_t *)segments[segment].data;
+    uint32_t size       = segments[segment].num;
+
+    if ((data == NULL) || (size == 0U) || (size > DESC_MAX_LEN)) {
+      return ARM_DRIVER_ERROR_PARAMETER;
+    }
+    control.totalNumOfDMATrans              = (unsigned int)((size - 1) & 0x03FF);
+    task_list[segment].pSrcEndAddr          = (void *)((uint32_t)&data[size - 1]);
+    task_list[segment].pDstEndAddr          = (void *)((uint32_t) & (spi->reg->DR));
+    task_list[segment].vsUDMAChaConfigData1 = control;
+    task_list[segment].Spare                = 0;
+    total += size;
+  }
+  // The last task ends the DMA cycle
+  task_list[segment_count - 1].vsUDMAChaConfigData1.transferType = UDMA_MODE_BASIC;
+
+  spi->info->status.busy       = 1U;
+  spi->info->status.data_lost  = 0U;
+  spi->info->status.mode_fault = 0U;
+
+  spi->xfer->tx_buf = (uint8_t *)segments[0].data;
+  spi->xfer->rx_buf = NULL;
+  spi->xfer->num    = total;
+  spi->xfer->rx_cnt = 0U;
+  spi->xfer->tx_cnt = 0U;
+
+  spi->reg->CTRLR0_b.TMOD = TRANSMIT_ONLY;
+
+  spi->reg->SPI_CTRLR0_b.INST_L = 0;
+  spi->reg->SPI_CTRLR0_b.ADDR_L = 0;
+
+  spi->reg->SSIENR = SSI_ENABLE;
+
+  spi->reg->DMACR_b.TDMAE    = 1;
+  spi->reg->DMATDLR_b.DMATDL = 1;
+
+  // Configure the channel and its callback with the first task, then replace its primary descriptor by the one
+  // copying the tasks into the alternate descriptor
+  control              = task_list[0].vsUDMAChaConfigData1;
+  control.transferType = UDMA_MODE_BASIC;
+  stat                 = UDMAx_ChannelConfigure(udma,
+                                spi->tx_dma->channel,
+                                (uint32_t)(spi->xfer->tx_buf),
+                                (uint32_t) & (spi->reg->DR),
+                                total,
+                                control,
+                                &spi->tx_dma->chnl_cfg,
+                                spi->tx_dma->cb_event,
+                                chnl_info,
+                                udmaHandle);
+  if (stat == -1) {
+    spi->info->status.busy = 0U;
+    return ARM_DRIVER_ERROR;
+  }
+  if (RSI_UDMA_SetChannelScatterGatherTransfer(udmaHandle,
+                                               spi->tx_dma->channel,
+                                               (uint8_t)segment_count,
+                                               task_list,
+                                               UDMA_MODE_PER_SCATTER_GATHER)
+      != RSI_OK) {
+    spi->info->status.busy = 0U;
+    return ARM_DRIVER_ERROR;
+  }
+  // The tasks move all the data, the interrupt handler must not reload the channel
+  chnl_info[spi->tx_dma->channel].Cnt = total;
+
+  UDMAx_ChannelEnable(spi->tx_dma->channel, udma, udmaHandle);
+  UDMAx_DMAEnable(udma, udmaHandle);
+
+  return ARM_DRIVER_OK;
+#endif
+}
+
 #ifdef SSI_DUAL_QUAD_COMPONENT
 /**
  * @fn          int32_t SPI_Send_Command_Data(const void *data, uint32_t num, uint32_t instruction, uint32_t address, 
@@ -72,6 +72,17 @@
 #define DMA_MAX_XFER_PAYLOAD_LEN 1015
 #define SET_IRQ_HIGH             1u
 #define SET_IRQ_LOW              0u
+// Largest payload of a frame given to sli_cpc_drv_transmit_data(). Each segment of a frame is sent by a single
+// DMA task, so TX frames are limited to one DMA transfer while RX frames may be longer
+#define TX_PAYLOAD_MAX_LENGTH DMA_MAX_XFER_PAYLOAD_LEN
+#define TX_FCS_LENGTH         2u
+#if (SL_CPC_ENDPOINT_SECURITY_ENABLED == 1)
+#define TX_SECURITY_TAG_LENGTH SLI_SECURITY_TAG_LENGTH_BYTES
+#else
+#define TX_SECURITY_TAG_LENGTH 0u
+#endif
+// The payload, the security tag and the checksum of a frame are sent straight from its buffer handle
+#define TX_PAYLOAD_MAX_SEGMENTS 3u
 typedef struct {
   sl_slist_node_t node;
   sl_cpc_buffer_handle_t *handle;
@@ -252,7 +263,6 @@ static sli_buf_entry_t *currently_transmiting_tx_entry = NULL;
 static bool pending_late_header                            = false;
 static IRQ_STATE_T irq_state                               = IRQ_IDLE;
 static volatile uint32_t tx_frame_complete                 = 0;
-static uint8_t tx_payload_data[DMA_MAX_XFER_LEN]           = { 0 };
 static uint8_t header_buffer[SLI_CPC_HDLC_HEADER_RAW_SIZE] = { 0 };
 static volatile bool is_header_tx_initiated                = FALSE;
 static volatile bool is_header_rx_initiated                = FALSE;
@@ -274,6 +284,13 @@ static uint8_t irq_header_rx_done         = 0;
 static uint8_t irq_payload_rx_done        = 0;
 static volatile bool is_tx_flush_required = FALSE, no_tx_payload = FALSE, no_rx_payload = FALSE;
 static enum header_situation received_header_situation;
+static SPI_GATHER_SEGMENT tx_payload_segments[TX_PAYLOAD_MAX_SEGMENTS];
+static uint8_t tx_payload_segment_count = 0;
+#if defined(SL_SI91X_SSI_DMA)
+static uint8_t tx_payload_data[TX_PAYLOAD_MAX_LENGTH + TX_SECURITY_TAG_LENGTH + TX_FCS_LENGTH] = { 0 };
+#else
+static RSI_UDMA_DESC_T tx_payload_tasks[TX_PAYLOAD_MAX_SEGMENTS];
+#endif
 /*******************************************************************************
  **************************   LOCAL FUNCTIONS   ********************************
  ******************************************************************************/
@@ -282,6 +299,7 @@ static void flush_tx(void);
 static void end_of_header_xfer(void);
 static void end_of_payload_xfer(void);
 static void prime_dma_for_transmission(void);
+static int32_t send_tx_payload(void);
 static void Init_Interface_PLL(void);
 static void prime_for_rx_header(uint8_t gpio_state_val);
 
@@ -624,6 +642,10 @@ sl_status_t sli_cpc_drv_transmit_data(sl_cpc_buffer_handle_t *buffer_handle, uin
   sli_buf_entry_t *entry;
   MCU_DECLARE_IRQ_STATE;
 
+  if (payload_tx_len > TX_PAYLOAD_MAX_LENGTH) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
   MCU_ENTER_ATOMIC();
   entry = (sli_buf_entry_t *)sl_slist_pop(&tx_free_list_head);
   MCU_EXIT_ATOMIC();
@@ -814,7 +836,7 @@ void sl_cpc_process_tx_rx(void)
     case SPI_CPC_TX_PAYLOAD: {
       // Header is successfully tx'd prepare for payload tx
       is_tx_flush_required = TRUE;
-      status               = SPIdrv_slave->Send(tx_payload_data, tx_payload_len);
+      status               = send_tx_payload();
       EFM_ASSERT(status == 0);
       RSI_EGPIO_SetPin(EGPIO, SPI_IRQ_PORT, SPI_IRQ_PIN, 0u);
 #if defined(DEBUG_LOG)
@@ -895,15 +917,8 @@ static void prime_dma_for_reception(size_t payload_size, enum header_situation l
     rx_started     = FALSE;
   }
 
-#if (SLI_CPC_RX_DATA_MAX_LENGTH <= DMA_MAX_XFER_LEN) // Non-large-buffer
-  {
-    // Configure the length of the payload to receive
-  }
-#else // Large-buffer
-  {
-#error "This driver only supports 1K data transaction SLI_CPC_RX_DATA_MAX_LENGTH should be set not more than 1024"
-  }
-#endif
+  // Payloads longer than DMA_MAX_XFER_LEN are received in one transfer, the UDMA driver
+  // reloads the channel descriptor for every DMA_MAX_XFER_LEN bytes
 
   start_transfer :
 
@@ -964,8 +979,9 @@ static void prime_dma_for_transmission(void)
   RSI_SPI_Slave_Disable();
   //init here since if there are back to back Tx initiated, then we will loose
   //previous tx payload length.
-  tx_payload_len          = 0;
-  irq_header_rx_initiated = 0;
+  tx_payload_len           = 0;
+  tx_payload_segment_count = 0;
+  irq_header_rx_initiated  = 0;
   // Pick the next frame to send
   currently_transmiting_tx_entry = (sli_buf_entry_t *)tx_submitted_list_head;
 
@@ -1008,35 +1024,24 @@ static void prime_dma_for_transmission(void)
     goto start_transfer;
   }
 
-#if (SLI_CPC_RX_DATA_MAX_LENGTH <= DMA_MAX_XFER_LEN) //Non-large-buffer
-  {
-    // Copy the payload
-    memcpy(&tx_payload_data[0],
-           currently_transmiting_tx_entry->handle->data,
-           (currently_transmiting_tx_entry->payload_len));
-
-    tx_payload_len += currently_transmiting_tx_entry->payload_len;
+  // Send the payload straight from the buffer handle, followed by the security tag and the checksum
+  tx_payload_segments[tx_payload_segment_count].data = currently_transmiting_tx_entry->handle->data;
+  tx_payload_segments[tx_payload_segment_count].num  = currently_transmiting_tx_entry->payload_len;
+  tx_payload_segment_count++;
 #if (SL_CPC_ENDPOINT_SECURITY_ENABLED == 1)
-    {
-      if (currently_transmiting_tx_entry->handle->security_tag) {
-        tx_desc_xfer_payload.xfer.linkAddr = LINKABS_ADDR(&tx_desc_xfer_tag);
-        tx_desc_xfer_tag.xfer.srcAddr      = (uint32_t)currently_transmiting_tx_entry->handle->security_tag;
-      } else {
-        tx_desc_xfer_payload.xfer.linkAddr = LINKABS_ADDR(&tx_desc_xfer_checksum);
-      }
-      tx_desc_xfer_checksum.xfer.srcAddr = (uint32_t)currently_transmiting_tx_entry->handle->fcs;
-    }
-#endif
+  if (currently_transmiting_tx_entry->handle->security_tag) {
+    tx_payload_segments[tx_payload_segment_count].data = currently_transmiting_tx_entry->handle->security_tag;
+    tx_payload_segments[tx_payload_segment_count].num  = TX_SECURITY_TAG_LENGTH;
+    tx_payload_segment_count++;
   }
-#else // Large-buffer
-#error "This driver only supports 1K data transaction SLI_CPC_RX_DATA_MAX_LENGTH should be set not more than 1024"
 #endif
+  tx_payload_segments[tx_payload_segment_count].data = currently_transmiting_tx_entry->handle->fcs;
+  tx_payload_segments[tx_payload_segment_count].num  = TX_FCS_LENGTH;
+  tx_payload_segment_count++;
 
-  // Finally load the checksum
-  memcpy(&tx_payload_data[currently_transmiting_tx_entry->payload_len],
-         currently_transmiting_tx_entry->handle->fcs,
-         2u);
-  tx_payload_len += 2u;
+  for (uint8_t segment = 0; segment < tx_payload_segment_count; segment++) {
+    tx_payload_len += tx_payload_segments[segment].num;
+  }
 
 start_transfer:
 
@@ -1057,6 +1062,33 @@ start_transfer:
   LOGIC_ANALYZER_TRACE_TX_DMA_ARMED;
 }
 
+/***************************************************************************/ /**
+ * Start the transmission of the payload segments of the frame
+ * prepared by prime_dma_for_transmission().
+ ******************************************************************************/
+static int32_t send_tx_payload(void)
+{
+#if defined(SL_SI91X_SSI_DMA)
+  // The SSI DMA driver has no scatter-gather support, gather the segments in a single buffer
+  uint16_t length = 0;
+
+  for (uint8_t segment = 0; segment < tx_payload_segment_count; segment++) {
+    if ((length + tx_payload_segments[segment].num) > sizeof(tx_payload_data)) {
+      return ARM_DRIVER_ERROR_PARAMETER;
+    }
+    memcpy(&tx_payload_data[length], tx_payload_segments[segment].data, tx_payload_segments[segment].num);
+    length += tx_payload_segments[segment].num;
+  }
+
+  return SPIdrv_slave->Send(tx_payload_data, length);
+#else
+  return RSI_SPI_Slave_Send_Gather(tx_payload_segments,
+                                   tx_payload_segment_count,
+                                   tx_payload_tasks,
+                                   TX_PAYLOAD_MAX_SEGMENTS);
+#endif
+}
+
 /**
  * @fn       static void end_of_header_xfer(void)
  * @brief    Process received header buffer
@@ -1100,6 +1132,11 @@ static void end_of_header_xfer(void)
     if (valid_header) {
       received_header_situation = HEADER_VALID;
       rx_payload_length         = sli_cpc_hdlc_get_length((void *)&header_buffer[0]);
+      if (rx_payload_length > SLI_CPC_RX_DATA_MAX_LENGTH) {
+        // The payload would not fit in the buffer handle
+        received_header_situation = HEADER_CORRUPTED;
+        rx_payload_length         = 0;
+      }
     } else {
       received_header_situation = HEADER_CORRUPTED;
     }
@@ -0,0 +1,115 @@
+/***************************************************************************/ /**
+ * @file  sl_si91x_fw_crc32.h
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_SI91X_FW_CRC32_H
+#define SL_SI91X_FW_CRC32_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************/
+/**
+ * @addtogroup FIRMWARE-FALLBACK Firmware Fallback A and B
+ * @ingroup SI91X_SERVICE_APIS
+ * @{
+ *
+ ******************************************************************************/
+
+/******************************** Macros ********************************/
+
+/** @brief Use slicing-by-8 lookup tables (8 KB of flash) instead of a single 1 KB byte-wise table. */
+#ifndef SL_SI91X_FW_CRC32_SLICE_BY_8
+#define SL_SI91X_FW_CRC32_SLICE_BY_8 1 ///< Set to 0 to trade CRC throughput for 7 KB of flash
+#endif
+
+/** @brief Initial register value of the firmware CRC32. */
+#define SL_SI91X_FW_CRC32_INIT_VALUE 0xFFFFFFFF ///< CRC register seed before the first byte
+
+/******************************** Structures ********************************/
+
+/** @brief Running state of a streaming firmware CRC32 calculation. */
+typedef struct {
+  uint32_t crc;    ///< CRC register before the final inversion
+  uint32_t length; ///< Number of bytes processed so far
+} sl_si91x_fw_crc32_context_t;
+
+/******************************** Functions ********************************/
+
+/***************************************************************************/ /**
+ *  @fn          void sl_si91x_fw_crc32_init(sl_si91x_fw_crc32_context_t *context)
+ *  @pre         None
+ *  @brief       Start a streaming CRC32 calculation.
+ *               The CRC is MSB-first over polynomial 0x04C11DB7, seeded with 0xFFFFFFFF
+ *               and inverted on completion, matching the A/B slot information CRC.
+ *  @param[out]  context            Pointer to the CRC context to reset.
+ ******************************************************************************/
+void sl_si91x_fw_crc32_init(sl_si91x_fw_crc32_context_t *context);
+
+/***************************************************************************/ /**
+ *  @fn          void sl_si91x_fw_crc32_update(sl_si91x_fw_crc32_context_t *context, const void *data, size_t length)
+ *  @pre         @ref sl_si91x_fw_crc32_init must be called on the context first.
+ *  @brief       Add a chunk of data to a streaming CRC32 calculation.
+ *               Chunks can have any length and alignment. Feeding an image in pieces
+ *               gives the same result as a single call over the whole image.
+ *  @param[in,out] context          Pointer to the CRC context.
+ *  @param[in]   data               Pointer to the chunk.
+ *  @param[in]   length             Length of the chunk in bytes.
+ ******************************************************************************/
+void sl_si91x_fw_crc32_update(sl_si91x_fw_crc32_context_t *context, const void *data, size_t length);
+
+/***************************************************************************/ /**
+ *  @fn          uint32_t sl_si91x_fw_crc32_final(const sl_si91x_fw_crc32_context_t *context)
+ *  @pre         None
+ *  @brief       Get the CRC32 of all data added so far.
+ *               The context is not modified, so more data can still be added afterwards.
+ *  @param[in]   context            Pointer to the CRC context.
+ *  @return      uint32_t           CRC32 value.
+ ******************************************************************************/
+uint32_t sl_si91x_fw_crc32_final(const sl_si91x_fw_crc32_context_t *context);
+
+/***************************************************************************/ /**
+ *  @fn          uint32_t sl_si91x_fw_crc32_calculate(const void *data, size_t length)
+ *  @pre         None
+ *  @brief       Calculate the CRC32 of a single buffer.
+ *  @param[in]   data               Pointer to the data.
+ *  @param[in]   length             Length of the data in bytes.
+ *  @return      uint32_t           CRC32 value.
+ ******************************************************************************/
+uint32_t sl_si91x_fw_crc32_calculate(const void *data, size_t length);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+#endif // SL_SI91X_FW_CRC32_H
@@ -242,6 +242,23 @@ sl_status_t sl_si91x_flash_write(uint32_t address, const uint8_t *buffer, uint32
 sl_status_t sl_si91x_fw_fallback_ota_flash_write(const sl_si91x_fw_fallback_config_t *config,
                                                  const uint8_t *data_buffer);
 
+/***************************************************************************/ /**
+ *  @fn          sl_status_t sl_si91x_fw_fallback_get_ota_image_crc32(uint32_t *crc, uint32_t *length)
+ *  @pre         None
+ *  @brief       Get the CRC32 of the OTA image written so far.
+ *               sl_si91x_fw_fallback_ota_flash_write() updates the CRC as each chunk is written,
+ *               starting from the last SL_SI91X_HEADER_PACKET chunk. The image can therefore be checked
+ *               against an expected CRC as soon as the last chunk is written, without reading it back.
+ *               The CRC is computed as by @ref sl_si91x_fw_crc32_calculate.
+ *               This function will work for A/B firmware only.
+ *  @param[out]  crc                CRC32 of the image bytes written since the header chunk.
+ *  @param[out]  length             Number of image bytes covered by the CRC. Can be NULL.
+ *  @return      sl_status_t        SL_STATUS_OK on success,
+ *                                  SL_STATUS_INVALID_STATE if no header chunk was written or a chunk write failed.
+ * For more information on status codes, refer to [SL STATUS DOCUMENTATION](https://docs.silabs.com/gecko-platform/latest/platform-common/status).
+ ******************************************************************************/
+sl_status_t sl_si91x_fw_fallback_get_ota_image_crc32(uint32_t *crc, uint32_t *length);
+
 /***************************************************************************/ /**
  *  @fn          sl_status_t sl_si91x_flash_read(uint32_t address, uint8_t *buffer, uint32_t length)
  *  @pre         None
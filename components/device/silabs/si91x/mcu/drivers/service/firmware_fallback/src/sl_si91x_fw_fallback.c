@@ -29,6 +29,7 @@
 
 #include "rsi_debug.h"
 #include "sl_si91x_fw_fallback.h"
+#include "sl_si91x_fw_crc32.h"
 #include "base_types.h"
 #include "si91x_device.h"
 #include "core_cm4.h"
@@ -53,6 +54,8 @@ static sl_status_t sli_si91x_erase_slot_info(uint32_t flash_offset);
 static sl_status_t sli_si91x_calculate_firmware_slot_crc(sl_si91x_fw_ab_slot_management_t *slot_info);
 static void sli_si91x_update_crc(sl_si91x_fw_ab_slot_management_t *slot_info);
 static uint8_t sl_m4_upadter_ota_flag = 0;
+static sl_si91x_fw_crc32_context_t ota_image_crc = { 0 }; ///< Running CRC32 of the OTA image written so far
+static bool ota_image_crc_valid                  = false;
 #endif
 
 #define SL_SI91X_SELECT_DEFAULT_NWP_FW_IMAGE 0x35 // Command value for selecting default NWP firmware image
@@ -259,9 +262,51 @@ sl_status_t sl_si91x_fw_fallback_ota_flash_write(const sl_si91x_fw_fallback_conf
                                          NULL,
                                          NULL);
 
+  // Fold the chunk into the running image CRC while it is still in cache. A header chunk starts a new image.
+  if (status == SL_STATUS_OK) {
+    if (config->ota_image_chunk_type == SL_SI91X_HEADER_PACKET) {
+      sl_si91x_fw_crc32_init(&ota_image_crc);
+      ota_image_crc_valid = true;
+    }
+    if (ota_image_crc_valid) {
+      sl_si91x_fw_crc32_update(&ota_image_crc, data_buffer, config->ota_image_data_length);
+    }
+  } else {
+    // A failed write leaves a gap in the image, so the running CRC no longer describes flash contents
+    ota_image_crc_valid = false;
+  }
+
   return status;
 }
 
+/***************************************************************************/ /**
+ *  @fn          sl_status_t sl_si91x_fw_fallback_get_ota_image_crc32(uint32_t *crc, uint32_t *length)
+ *  @pre         None
+ *  @brief       Get the CRC32 of the OTA image written so far.
+ *               The CRC is updated by sl_si91x_fw_fallback_ota_flash_write() as each chunk is written,
+ *               starting from the last header chunk.
+ *               This function will work for A/B firmware only.
+ *  @param[out]  crc                CRC32 of the image bytes written since the header chunk.
+ *  @param[out]  length             Number of image bytes covered by the CRC. Can be NULL.
+ *  @return      sl_status_t        SL_STATUS_OK on success, error code otherwise.
+ ******************************************************************************/
+sl_status_t sl_si91x_fw_fallback_get_ota_image_crc32(uint32_t *crc, uint32_t *length)
+{
+  if (crc == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  if (!ota_image_crc_valid) {
+    return SL_STATUS_INVALID_STATE;
+  }
+
+  *crc = sl_si91x_fw_crc32_final(&ota_image_crc);
+  if (length != NULL) {
+    *length = ota_image_crc.length;
+  }
+  return SL_STATUS_OK;
+}
+
 /***************************************************************************/ /**
  *  @fn          sl_status_t sl_si91x_verify_image(uint32_t flash_address)
  *  @pre         None
@@ -874,20 +919,8 @@ void sl_si91x_nwp_soft_reset_from_updater(const uint32_t m4_slot_image_offset)
  ******************************************************************************/
 static uint32_t sli_si91x_calculate_crc32(const void *data, size_t length)
 {
-  uint32_t crc         = 0xFFFFFFFF;
-  const uint8_t *bytes = (const uint8_t *)data;
-
-  for (size_t i = 0; i < length; i++) {
-    crc ^= (uint32_t)bytes[i] << 24;
-
-    for (int j = 0; j < 8; j++) {
-      if (crc & 0x80000000)
-        crc = (crc << 1) ^ CRC32_POLYNOMIAL;
-      else
-        crc <<= 1;
-    }
-  }
-  return ~crc; // Final XOR for CRC32
+  // Table-driven equivalent of the bitwise CRC32_POLYNOMIAL calculation
+  return sl_si91x_fw_crc32_calculate(data, length);
 }
 /***************************************************************************/ /**
  *  @fn          sl_status_t sli_si91x_calculate_firmware_slot_crc(sl_si91x_fw_ab_slot_management_t *slot_info)
@@ -93,6 +93,18 @@
 // <i> Default: 32
 #define SL_IOSTREAM_USART_VCOM_RX_BUFFER_SIZE 32
 
+// <o SL_IOSTREAM_USART_VCOM_RX_REQUEST_SIZE> Receive request size
+// <i> Maximum number of bytes requested from the USART driver at a time, 0 for all free receive buffer space.
+// <i> With UDMA enabled on the receive channel, received bytes become readable only when a request completes,
+// <i> so use 1 for interactive input in that case.
+// <i> Default: 0
+#define SL_IOSTREAM_USART_VCOM_RX_REQUEST_SIZE 0
+
+// <o SL_IOSTREAM_USART_VCOM_TX_BUFFER_SIZE> Transmit buffer size
+// <i> Writes return once data is queued in this buffer, and only wait for the transmitter when it is full.
+// <i> Default: 256
+#define SL_IOSTREAM_USART_VCOM_TX_BUFFER_SIZE 256
+
 // <q SL_IOSTREAM_USART_VCOM_CONVERT_BY_DEFAULT_LF_TO_CRLF> Convert \n to \r\n
 // <i> It can be changed at runtime using the C API.
 // <i> Default: 0
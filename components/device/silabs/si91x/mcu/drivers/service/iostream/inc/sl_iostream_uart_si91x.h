@@ -82,15 +82,28 @@ typedef struct {
 
 /// @brief I/O Stream UART config
 typedef struct {
-  uint8_t *rx_buffer;      ///< UART Rx Buffer
-  size_t rx_buffer_length; ///< UART Rx Buffer length
-  bool lf_to_crlf;         ///< lf_to_crlf
+  uint8_t *rx_buffer;       ///< UART Rx Buffer
+  size_t rx_buffer_length;  ///< UART Rx Buffer length
+  uint8_t *tx_buffer;       ///< UART Tx Buffer
+  size_t tx_buffer_length;  ///< UART Tx Buffer length
+  size_t rx_request_length; ///< Maximum length of a single receive request, 0 for the free Rx Buffer space
+  bool lf_to_crlf;          ///< lf_to_crlf
 } sl_iostream_uart_config_t;
 
 /// @brief I/O Stream UART context
 typedef struct {
   uint8_t *rx_buffer;                          ///< UART Rx Buffer
   size_t rx_buffer_len;                        ///< UART Rx Buffer length
+  size_t rx_request_len;                       ///< Maximum length of a single receive request
+  volatile size_t rx_head;                     ///< Total number of bytes received into the Rx Buffer
+  volatile size_t rx_tail;                     ///< Total number of bytes read from the Rx Buffer
+  volatile size_t rx_active;                   ///< Length of the receive request in progress, 0 if none
+  volatile size_t rx_received;                 ///< Bytes of the receive request in progress already counted in rx_head
+  uint8_t *tx_buffer;                          ///< UART Tx Buffer
+  size_t tx_buffer_len;                        ///< UART Tx Buffer length
+  volatile size_t tx_head;                     ///< Total number of bytes written to the Tx Buffer
+  volatile size_t tx_tail;                     ///< Total number of bytes transmitted from the Tx Buffer
+  volatile size_t tx_active;                   ///< Length of the transfer in progress, 0 if none
   sl_status_t (*tx)(void *context, char c);    ///< Tx function pointer
   void (*set_next_byte_detect)(void *context); ///< Pointer to a function to enable detection of next
                                                ///< byte on stream
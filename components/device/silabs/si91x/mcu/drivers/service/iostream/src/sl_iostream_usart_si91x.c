@@ -37,21 +37,30 @@
 #include "sli_iostream_uart_si91x.h"
 #include "sl_iostream_usart_si91x.h"
 #include "sl_atomic.h"
+#include "sl_core.h"
 #include <string.h>
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 #include "sl_si91x_usart.h"
+#if defined(SL_CATALOG_KERNEL_PRESENT)
+#include "cmsis_os2.h"
+#endif
 
 /*******************************************************************************
  *******************************   DEFINES   ***********************************
  ******************************************************************************/
+#define IOSTREAM_USART_TX_SPACE_EVENT (1UL << 0) // Room was made in the Tx buffer
+#define IOSTREAM_USART_RX_DATA_EVENT  (1UL << 1) // Data was added to the Rx buffer
 
 /*******************************************************************************
  **************************   GLOBAL VARIABLES   *******************************
  ******************************************************************************/
 sl_usart_handle_t usart_handle;
-volatile boolean_t send_complete = false, transfer_complete = false, receive_complete = false;
+static sl_iostream_uart_context_t *usart_stream_context = NULL;
+#if defined(SL_CATALOG_KERNEL_PRESENT)
+static osEventFlagsId_t usart_stream_events = NULL;
+#endif
 /*******************************************************************************
  *********************   LOCAL FUNCTION PROTOTYPES   ***************************
  ******************************************************************************/
@@ -69,6 +78,20 @@ static bool get_auto_cr_lf(void *context);
 static size_t read_rx_buffer(sl_iostream_uart_context_t *uart_context, uint8_t *buffer, size_t buffer_len);
 static sl_status_t usart_tx(void *context, char c);
 
+static sl_status_t queue_tx_data(sl_iostream_uart_context_t *uart_context, const uint8_t *data, size_t length);
+
+static void usart_start_tx(sl_iostream_uart_context_t *uart_context);
+
+static void usart_start_rx(sl_iostream_uart_context_t *uart_context);
+
+static void usart_update_rx(sl_iostream_uart_context_t *uart_context);
+
+static bool usart_can_wait(void);
+
+static void usart_wait(uint32_t event);
+
+static void usart_signal(uint32_t event);
+
 static sl_status_t usart_deinit(void *context);
 
 /*******************************************************************************
@@ -118,11 +141,14 @@ sl_status_t sli_iostream_uart_context_init(sl_iostream_uart_t *uart,
   // Configure iostream struct and context
   memset(context, 0, sizeof(*context));
 
-  context->rx_buffer     = config->rx_buffer;
-  context->rx_buffer_len = config->rx_buffer_length;
-  context->lf_to_crlf    = config->lf_to_crlf;
-  context->tx            = tx;
-  context->deinit        = deinit;
+  context->rx_buffer      = config->rx_buffer;
+  context->rx_buffer_len  = config->rx_buffer_length;
+  context->rx_request_len = config->rx_request_length;
+  context->tx_buffer      = config->tx_buffer;
+  context->tx_buffer_len  = config->tx_buffer_length;
+  context->lf_to_crlf     = config->lf_to_crlf;
+  context->tx             = tx;
+  context->deinit         = deinit;
 
   uart->stream.context = context;
   uart->stream.write   = uart_write;
@@ -147,6 +173,12 @@ sl_status_t sl_iostream_usart_init(sl_iostream_uart_t *iostream_uart,
 {
   sl_status_t status;
 
+  // Both directions are buffered, so both buffers are required
+  if ((uart_config->rx_buffer == NULL) || (uart_config->rx_buffer_length == 0) || (uart_config->tx_buffer == NULL)
+      || (uart_config->tx_buffer_length == 0)) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
   status = sli_iostream_uart_context_init(iostream_uart,
                                           &usart_context->context,
                                           uart_config,
@@ -161,8 +193,11 @@ sl_status_t sl_iostream_usart_init(sl_iostream_uart_t *iostream_uart,
   }
 
   // Save useful config info to usart context
-  usart_context->tx_pin = config->tx_pin;
-  usart_context->rx_pin = config->rx_pin;
+  if (config != NULL) {
+    usart_context->tx_pin = config->tx_pin;
+    usart_context->rx_pin = config->rx_pin;
+  }
+  usart_stream_context = &usart_context->context;
 
   // 1.Configure USART for basic async operation
   // 2.Peripheral clock enable
@@ -186,6 +221,16 @@ sl_status_t sl_iostream_usart_init(sl_iostream_uart_t *iostream_uart,
     return status;
   }
 
+#if defined(SL_CATALOG_KERNEL_PRESENT)
+  // Blocked readers and writers sleep on these flags once the kernel runs, and poll before that
+  if ((usart_stream_events == NULL) && (osKernelGetState() != osKernelInactive)) {
+    usart_stream_events = osEventFlagsNew(NULL);
+  }
+#endif
+
+  // Receive continuously into the Rx buffer
+  usart_start_rx(usart_stream_context);
+
   return SL_STATUS_OK;
 }
 
@@ -198,21 +243,7 @@ sl_status_t sl_iostream_usart_init(sl_iostream_uart_t *iostream_uart,
  ******************************************************************************/
 static sl_status_t usart_tx(void *context, char c)
 {
-  sl_status_t status;
-  (void)context;
-
-  // Transfer the char
-  status = sl_si91x_usart_send_data(usart_handle, &c, 1);
-  if (status != SL_STATUS_OK) {
-    return status;
-  }
-  // Wait till transfer comple
-  while (!send_complete)
-    ;
-  // Clear the variable to send next byte
-  send_complete = false;
-
-  return SL_STATUS_OK;
+  return queue_tx_data((sl_iostream_uart_context_t *)context, (const uint8_t *)&c, 1);
 }
 
 /*******************************************************************************
@@ -221,30 +252,167 @@ static sl_status_t usart_tx(void *context, char c)
 static sl_status_t uart_write(void *context, const void *buffer, size_t buffer_length)
 {
   sl_iostream_uart_context_t *uart_context = (sl_iostream_uart_context_t *)context;
-  char *c                                  = (char *)buffer;
+  const uint8_t *data                      = (const uint8_t *)buffer;
   bool lf_to_crlf                          = false;
-  uint32_t i                               = 0;
-  sl_status_t status                       = SL_STATUS_FAIL;
+  sl_status_t status                       = SL_STATUS_OK;
 
   sl_atomic_load(lf_to_crlf, uart_context->lf_to_crlf);
 
-  while (i < buffer_length) {
+  while (buffer_length > 0) {
+    size_t run_length = buffer_length;
+
+    // Queue everything up to the next LF in one copy, and the LF itself as CRLF
     if (lf_to_crlf == true) {
-      if (*c == '\n') {
-        status = uart_context->tx(uart_context, '\r');
+      const uint8_t *lf = memchr(data, '\n', buffer_length);
+      if (lf == data) {
+        status = queue_tx_data(uart_context, (const uint8_t *)"\r\n", 2);
+        if (status != SL_STATUS_OK) {
+          return status;
+        }
+        data++;
+        buffer_length--;
+        continue;
+      }
+      if (lf != NULL) {
+        run_length = (size_t)(lf - data);
       }
     }
-    status = uart_context->tx(uart_context, *c);
+
+    status = queue_tx_data(uart_context, data, run_length);
     if (status != SL_STATUS_OK) {
       return status;
     }
-    c++;
-    i++;
+    data += run_length;
+    buffer_length -= run_length;
   }
 
   return status;
 }
 
+/*******************************************************************************
+ * Copies data to the Tx buffer and starts its transmission.
+ * Waits for room in the Tx buffer only when it is full.
+ ******************************************************************************/
+static sl_status_t queue_tx_data(sl_iostream_uart_context_t *uart_context, const uint8_t *data, size_t length)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  while (length > 0) {
+    size_t copied = 0;
+
+    CORE_ENTER_ATOMIC();
+    while (copied < length) {
+      size_t free_space = uart_context->tx_buffer_len - (uart_context->tx_head - uart_context->tx_tail);
+      size_t index      = uart_context->tx_head % uart_context->tx_buffer_len;
+      size_t chunk      = uart_context->tx_buffer_len - index;
+
+      if (chunk > free_space) {
+        chunk = free_space;
+      }
+      if (chunk > (length - copied)) {
+        chunk = length - copied;
+      }
+      if (chunk == 0) {
+        break;
+      }
+      memcpy(&uart_context->tx_buffer[index], &data[copied], chunk);
+      uart_context->tx_head += chunk;
+      copied += chunk;
+    }
+    CORE_EXIT_ATOMIC();
+
+    usart_start_tx(uart_context);
+    data += copied;
+    length -= copied;
+
+    if ((length > 0) && (copied == 0)) {
+      // The Tx buffer is full. It can't drain while interrupts are masked, so the rest is dropped.
+      if (!usart_can_wait()) {
+        return SL_STATUS_FULL;
+      }
+      usart_wait(IOSTREAM_USART_TX_SPACE_EVENT);
+    }
+  }
+
+  return SL_STATUS_OK;
+}
+
+/*******************************************************************************
+ * Starts transmitting the contiguous pending part of the Tx buffer,
+ * unless a transfer is already in progress.
+ ******************************************************************************/
+static void usart_start_tx(sl_iostream_uart_context_t *uart_context)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();
+  if ((uart_context->tx_active == 0) && (uart_context->tx_head != uart_context->tx_tail)) {
+    size_t pending = uart_context->tx_head - uart_context->tx_tail;
+    size_t index   = uart_context->tx_tail % uart_context->tx_buffer_len;
+    size_t chunk   = uart_context->tx_buffer_len - index;
+
+    if (chunk > pending) {
+      chunk = pending;
+    }
+    // Set before sending, the completion may be signaled before the call returns
+    uart_context->tx_active = chunk;
+    if (sl_si91x_usart_send_data(usart_handle, &uart_context->tx_buffer[index], chunk) != SL_STATUS_OK) {
+      uart_context->tx_active = 0;
+    }
+  }
+  CORE_EXIT_ATOMIC();
+}
+
+/*******************************************************************************
+ * Requests reception into the contiguous free part of the Rx buffer,
+ * unless a request is already in progress or the Rx buffer is full.
+ ******************************************************************************/
+static void usart_start_rx(sl_iostream_uart_context_t *uart_context)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();
+  if (uart_context->rx_active == 0) {
+    size_t free_space = uart_context->rx_buffer_len - (uart_context->rx_head - uart_context->rx_tail);
+    size_t index      = uart_context->rx_head % uart_context->rx_buffer_len;
+    size_t chunk      = uart_context->rx_buffer_len - index;
+
+    if (chunk > free_space) {
+      chunk = free_space;
+    }
+    if ((uart_context->rx_request_len != 0) && (chunk > uart_context->rx_request_len)) {
+      chunk = uart_context->rx_request_len;
+    }
+    if (chunk > 0) {
+      uart_context->rx_active   = chunk;
+      uart_context->rx_received = 0;
+      if (sl_si91x_usart_receive_data(usart_handle, &uart_context->rx_buffer[index], chunk) != SL_STATUS_OK) {
+        uart_context->rx_active = 0;
+      }
+    }
+  }
+  CORE_EXIT_ATOMIC();
+}
+
+/*******************************************************************************
+ * Makes the bytes received so far by the request in progress readable.
+ ******************************************************************************/
+static void usart_update_rx(sl_iostream_uart_context_t *uart_context)
+{
+  size_t received;
+  CORE_DECLARE_IRQ_STATE;
+
+  // Read the count atomically with the request it belongs to
+  CORE_ENTER_ATOMIC();
+  received = sl_si91x_usart_get_rx_data_count(usart_handle);
+  if ((uart_context->rx_active != 0) && (received > uart_context->rx_received)
+      && (received <= uart_context->rx_active)) {
+    uart_context->rx_head += received - uart_context->rx_received;
+    uart_context->rx_received = received;
+  }
+  CORE_EXIT_ATOMIC();
+}
+
 /*******************************************************************************
  * Internal stream read implementation
  ******************************************************************************/
@@ -262,31 +430,87 @@ static sl_status_t uart_read(void *context, void *buffer, size_t buffer_length,
 }
 
 /*******************************************************************************
- * Tries to read the requested amount of data.
+ * Reads the data available in the Rx buffer, waiting for at least one byte.
  * Returns the number of bytes read.
  ******************************************************************************/
 static size_t read_rx_buffer(sl_iostream_uart_context_t *uart_context, uint8_t *buffer, size_t buffer_len)
 {
-  size_t ret_val;
-  uint8_t ch;
+  size_t available = 0;
+  size_t read_size = 0;
+
+  if (buffer_len == 0) {
+    return 0;
+  }
+
+  while (1) {
+    // Pick up bytes of the request in progress that were not signaled yet, and restart a failed request
+    usart_update_rx(uart_context);
+    usart_start_rx(uart_context);
+    available = uart_context->rx_head - uart_context->rx_tail;
+    if (available > 0) {
+      break;
+    }
+    if (!usart_can_wait()) {
+      return 0;
+    }
+    usart_wait(IOSTREAM_USART_RX_DATA_EVENT);
+  }
+
   // read the smallest amount between the data available and the size of the user buffer
-  size_t read_size = buffer_len < uart_context->rx_buffer_len ? buffer_len : uart_context->rx_buffer_len;
-
-  for (ret_val = 0; ret_val < read_size; ret_val++) {
-    // Read the byte received
-    sl_si91x_usart_receive_data(usart_handle, &ch, 1);
-    // wait till data byte receive
-    while (!receive_complete)
-      ;
-    // Clear the variable to receive next byte
-    receive_complete = false;
-    //Copying the char received from USART to buffer
-    uart_context->rx_buffer[ret_val] = ch;
+  read_size = (buffer_len < available) ? buffer_len : available;
+  for (size_t copied = 0; copied < read_size;) {
+    size_t index = (uart_context->rx_tail + copied) % uart_context->rx_buffer_len;
+    size_t chunk = uart_context->rx_buffer_len - index;
+
+    if (chunk > (read_size - copied)) {
+      chunk = read_size - copied;
+    }
+    memcpy(&buffer[copied], &uart_context->rx_buffer[index], chunk);
+    copied += chunk;
   }
-  // Copy the data received in buffer
-  memcpy(buffer, uart_context->rx_buffer, read_size);
+  uart_context->rx_tail += read_size;
 
-  return ret_val;
+  // Reception stops when the Rx buffer fills up, resume it now that there is room
+  usart_start_rx(uart_context);
+
+  return read_size;
+}
+
+/*******************************************************************************
+ * Returns true if the caller can wait for the USART interrupt.
+ ******************************************************************************/
+static bool usart_can_wait(void)
+{
+  return (__get_IPSR() == 0U) && (__get_PRIMASK() == 0U);
+}
+
+/*******************************************************************************
+ * Waits for an event from the USART interrupt. Sleeps once the kernel runs,
+ * otherwise returns immediately so that the caller polls.
+ ******************************************************************************/
+static void usart_wait(uint32_t event)
+{
+#if defined(SL_CATALOG_KERNEL_PRESENT)
+  if ((usart_stream_events != NULL) && (osKernelGetState() == osKernelRunning)) {
+    osEventFlagsWait(usart_stream_events, event, osFlagsWaitAny, osWaitForever);
+  }
+#else
+  (void)event;
+#endif
+}
+
+/*******************************************************************************
+ * Wakes up the readers or writers waiting for an event.
+ ******************************************************************************/
+static void usart_signal(uint32_t event)
+{
+#if defined(SL_CATALOG_KERNEL_PRESENT)
+  if (usart_stream_events != NULL) {
+    osEventFlagsSet(usart_stream_events, event);
+  }
+#else
+  (void)event;
+#endif
 }
 
 /*******************************************************************************
@@ -299,6 +523,12 @@ static sl_status_t uart_deinit(void *stream)
   sl_iostream_t *default_stream;
   sl_status_t status = SL_STATUS_OK;
 
+  // Let the queued output drain before the USART is turned off
+  while (usart_can_wait() && (uart_context->tx_head != uart_context->tx_tail)) {
+    usart_start_tx(uart_context);
+    usart_wait(IOSTREAM_USART_TX_SPACE_EVENT);
+  }
+
   default_stream = sl_iostream_get_default();
 
   // Check if uart stream is the default and if it's the case,
@@ -335,6 +565,14 @@ static sl_status_t usart_deinit(void *context)
   // Deinit the USART
   status = sl_si91x_usart_deinit(usart_handle);
 
+  usart_stream_context = NULL;
+#if defined(SL_CATALOG_KERNEL_PRESENT)
+  if (usart_stream_events != NULL) {
+    osEventFlagsDelete(usart_stream_events);
+    usart_stream_events = NULL;
+  }
+#endif
+
   return status;
 }
 
@@ -343,15 +581,29 @@ static sl_status_t usart_deinit(void *context)
  ******************************************************************************/
 void callback_event(uint32_t event)
 {
-  switch (event) {
-    case SL_USART_EVENT_SEND_COMPLETE:
-      send_complete = true;
-      break;
-    case SL_USART_EVENT_RECEIVE_COMPLETE:
-      receive_complete = true;
-      break;
-    case SL_USART_EVENT_TRANSFER_COMPLETE:
-      send_complete = true;
-      break;
+  sl_iostream_uart_context_t *uart_context = usart_stream_context;
+
+  if (uart_context == NULL) {
+    return;
+  }
+
+  // Events raised earlier in the same interrupt can be repeated in a later callback, so a transfer is
+  // only retired if the driver counts show it completed, and not the one restarted below.
+  if ((event & (SL_USART_EVENT_SEND_COMPLETE | SL_USART_EVENT_TRANSFER_COMPLETE)) && (uart_context->tx_active != 0)
+      && (sl_si91x_usart_get_tx_data_count(usart_handle) == uart_context->tx_active)) {
+    uart_context->tx_tail += uart_context->tx_active;
+    uart_context->tx_active = 0;
+    usart_start_tx(uart_context);
+    usart_signal(IOSTREAM_USART_TX_SPACE_EVENT);
+  }
+
+  // The driver signals a receive timeout for every byte of a request that is not complete yet
+  if (event & (SL_USART_EVENT_RECEIVE_COMPLETE | SL_USART_EVENT_RX_TIMEOUT)) {
+    usart_update_rx(uart_context);
+    if ((uart_context->rx_active != 0) && (uart_context->rx_received == uart_context->rx_active)) {
+      uart_context->rx_active = 0;
+      usart_start_rx(uart_context);
+    }
+    usart_signal(IOSTREAM_USART_RX_DATA_EVENT);
   }
 }
\ No newline at end of file
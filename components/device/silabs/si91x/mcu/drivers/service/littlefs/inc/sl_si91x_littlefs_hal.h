@@ -115,7 +115,8 @@ int si91x_block_device_erase(const struct lfs_config *cfg, lfs_block_t block);
  * @brief Sync the state of the underlying block device.
  * @details Sync the state of the underlying block device. if the write function does not
  * perform caching, and therefore each read or write call hits the memory, the
- * sync function can simply return 0.
+ * sync function can simply return 0. With the common flash HAL, adjacent prog calls
+ * are coalesced and written in the background, and sync waits for all of them to complete.
  *
  * @param[in] cfg  littlefs config struct
  * @return 0 - QSPI_OK
@@ -41,12 +41,112 @@
 #define LITTLE_FS_OK    0    // LittleFS success code
 #define LITTLE_FS_ERROR 1    // LittleFS Error code
 
+// Size of each buffer used to coalesce adjacent prog calls into a single common flash write
+#ifndef SL_SI91X_LITTLEFS_PROG_BUFFER_SIZE
+#define SL_SI91X_LITTLEFS_PROG_BUFFER_SIZE 2048
+#endif
+// One buffer collects prog data while the other one is being written to flash
+#define LITTLEFS_PROG_BUFFER_COUNT 2
+
+typedef struct {
+  uint32_t address;                                 // Flash address of the first buffered byte
+  uint16_t length;                                  // Number of buffered bytes
+  bool in_flight;                                   // Buffer is being written to flash
+  sl_si91x_common_flash_write_t operation;          // Pending common flash write of this buffer
+  uint8_t data[SL_SI91X_LITTLEFS_PROG_BUFFER_SIZE]; // Coalesced prog data
+} littlefs_prog_buffer_t;
+
 extern char linker_littlefs_begin;
 static osSemaphoreId_t littlefs_sem;
+static littlefs_prog_buffer_t prog_buffers[LITTLEFS_PROG_BUFFER_COUNT];
+static uint8_t active_prog_buffer;
 
 __attribute__((used)) uint8_t littlefs_default_storage[LITTLEFS_DEFAULT_MEM_SIZE] __attribute__((section(".ltfs")));
 #define LITTLEFS_BASE (&linker_littlefs_begin)
 
+/******************************************************************************
+ * Wait for the write of a prog buffer to complete and release the buffer
+ ******************************************************************************/
+static sl_status_t littlefs_complete_prog_buffer(littlefs_prog_buffer_t *prog_buffer)
+{
+  sl_status_t status = SL_STATUS_OK;
+
+  if (prog_buffer->in_flight) {
+    do {
+      status = sl_si91x_common_flash_write_process(&prog_buffer->operation, SLI_SI91X_WAIT_FOR_COMMAND_SUCCESS);
+    } while (status == SL_STATUS_IN_PROGRESS);
+    prog_buffer->in_flight = false;
+    prog_buffer->length    = 0;
+  }
+  return status;
+}
+
+/******************************************************************************
+ * Start writing the active prog buffer and switch to the other buffer
+ ******************************************************************************/
+static sl_status_t littlefs_issue_prog_buffer(void)
+{
+  littlefs_prog_buffer_t *prog_buffer = &prog_buffers[active_prog_buffer];
+  littlefs_prog_buffer_t *next_buffer = &prog_buffers[(active_prog_buffer + 1) % LITTLEFS_PROG_BUFFER_COUNT];
+  sl_status_t status;
+
+  if (prog_buffer->length == 0) {
+    return SL_STATUS_OK;
+  }
+
+  // The other buffer becomes the active one, so its previous write has to be finished first
+  status = littlefs_complete_prog_buffer(next_buffer);
+  if (status != SL_STATUS_OK) {
+    prog_buffer->length = 0;
+    return status;
+  }
+
+  status = sl_si91x_command_to_write_common_flash_start(&prog_buffer->operation,
+                                                        prog_buffer->address,
+                                                        prog_buffer->data,
+                                                        prog_buffer->length,
+                                                        FLASH_WRITE);
+  if (status == SL_STATUS_IN_PROGRESS) {
+    prog_buffer->in_flight = true;
+    status                 = SL_STATUS_OK;
+  } else {
+    prog_buffer->length = 0;
+  }
+  active_prog_buffer = (active_prog_buffer + 1) % LITTLEFS_PROG_BUFFER_COUNT;
+  return status;
+}
+
+/******************************************************************************
+ * Write all buffered prog data to flash and wait for completion
+ ******************************************************************************/
+static sl_status_t littlefs_flush_prog_buffers(void)
+{
+  sl_status_t status = littlefs_issue_prog_buffer();
+
+  for (uint8_t i = 0; i < LITTLEFS_PROG_BUFFER_COUNT; i++) {
+    sl_status_t buffer_status = littlefs_complete_prog_buffer(&prog_buffers[i]);
+    if (status == SL_STATUS_OK) {
+      status = buffer_status;
+    }
+  }
+  return status;
+}
+
+/******************************************************************************
+ * Check whether buffered prog data overlaps the given flash region
+ ******************************************************************************/
+static bool littlefs_prog_buffers_overlap(uint32_t address, uint32_t size)
+{
+  for (uint8_t i = 0; i < LITTLEFS_PROG_BUFFER_COUNT; i++) {
+    const littlefs_prog_buffer_t *prog_buffer = &prog_buffers[i];
+    if ((prog_buffer->length != 0) && (address < (prog_buffer->address + prog_buffer->length))
+        && (prog_buffer->address < (address + size))) {
+      return true;
+    }
+  }
+  return false;
+}
+
 /******************************************************************************
  * Initialize the qspi for littlefs
  ******************************************************************************/
@@ -72,6 +172,10 @@ int si91x_block_device_read(const struct lfs_config *cfg,
   //Calculate the flash read address based on block number and offset
   flash_read_addr = (uint32_t)LITTLEFS_BASE + (block * cfg->block_size) + off;
   if (flash_read_addr != 0) {
+    // Flash is read memory mapped, so pending prog data of this region has to reach flash first
+    if (littlefs_prog_buffers_overlap(flash_read_addr, size) && (littlefs_flush_prog_buffers() != SL_STATUS_OK)) {
+      return LFS_ERR_IO;
+    }
     memcpy((uint8_t *)buffer, (uint8_t *)flash_read_addr, size);
     status = LITTLE_FS_OK;
   }
@@ -94,8 +198,33 @@ int si91x_block_device_prog(const struct lfs_config *cfg,
   flash_prog_addr = (uint32_t)LITTLEFS_BASE + (block * cfg->block_size) + off;
 
   if (flash_prog_addr != 0) {
-    //Write to flash
-    status = sl_si91x_command_to_write_common_flash(flash_prog_addr, buffer, (uint16_t)size, FLASH_WRITE);
+    littlefs_prog_buffer_t *prog_buffer = &prog_buffers[active_prog_buffer];
+
+    // Start writing the collected data once this prog is not adjacent to it or does not fit
+    if ((prog_buffer->length != 0)
+        && ((flash_prog_addr != (prog_buffer->address + prog_buffer->length))
+            || ((prog_buffer->length + size) > SL_SI91X_LITTLEFS_PROG_BUFFER_SIZE))) {
+      if (littlefs_issue_prog_buffer() != SL_STATUS_OK) {
+        return LFS_ERR_IO;
+      }
+      prog_buffer = &prog_buffers[active_prog_buffer];
+    }
+
+    if (size > SL_SI91X_LITTLEFS_PROG_BUFFER_SIZE) {
+      //Write to flash
+      status = littlefs_flush_prog_buffers();
+      if (status == SL_STATUS_OK) {
+        status = sl_si91x_command_to_write_common_flash(flash_prog_addr, buffer, (uint16_t)size, FLASH_WRITE);
+      }
+    } else {
+      // Buffered data is written on a non adjacent prog, read of the region, erase or sync
+      if (prog_buffer->length == 0) {
+        prog_buffer->address = flash_prog_addr;
+      }
+      memcpy(&prog_buffer->data[prog_buffer->length], buffer, size);
+      prog_buffer->length += (uint16_t)size;
+      status = LITTLE_FS_OK;
+    }
     if (status != LITTLE_FS_OK) {
       status = LFS_ERR_IO;
     }
@@ -119,7 +248,10 @@ int si91x_block_device_erase(const struct lfs_config *cfg, lfs_block_t block)
 
   if (flash_erase_addr != 0) {
     //Erase sector
-    status = sl_si91x_command_to_write_common_flash(flash_erase_addr, dummy_buff, SECTOR_SIZE, FLASH_ERASE);
+    status = littlefs_flush_prog_buffers();
+    if (status == SL_STATUS_OK) {
+      status = sl_si91x_command_to_write_common_flash(flash_erase_addr, dummy_buff, SECTOR_SIZE, FLASH_ERASE);
+    }
     if (status != LITTLE_FS_OK) {
       status = LFS_ERR_IO;
     }
@@ -133,6 +265,9 @@ int si91x_block_device_erase(const struct lfs_config *cfg, lfs_block_t block)
 int si91x_block_device_sync(const struct lfs_config *c)
 {
   UNUSED_PARAMETER(c);
+  if (littlefs_flush_prog_buffers() != SL_STATUS_OK) {
+    return LFS_ERR_IO;
+  }
   return LITTLE_FS_OK;
 }
 
@@ -32,6 +32,8 @@
 #define TEST_SIZE       256        // Example size
 #define LITTLE_FS_OK    0          // LittleFS success code
 #define LITTLE_FS_ERROR 1          // LittleFS Error code
+#define TEST_PROG_BLOCK 0x00000001 // Block used for the coalesced program test
+#define TEST_PROG_COUNT 8          // Number of adjacent program calls
 
 /*******************************************************************************
  ***************************  Global Variables   *******************************
@@ -45,6 +47,7 @@
  ***************************  Local Variables   *******************************
  ******************************************************************************/
 static uint8_t buffer[TEST_SIZE];
+static uint8_t prog_buffer[TEST_SIZE * TEST_PROG_COUNT];
 const struct lfs_config cfg = {
   .read   = si91x_block_device_read,   // Function to read data from the block device
   .prog   = si91x_block_device_prog,   // Function to program data to the block device
@@ -110,6 +113,7 @@ void test_si91x_block_device_prog(void);
 void test_si91x_block_device_erase(void);
 void test_si91x_block_device_sync(void);
 void test_si91x_block_device_lock_and_unlock(void);
+void test_si91x_block_device_coalesced_prog(void);
 
 /******************************************************************************
  * Main function in which all the test cases are tested using unity framework
@@ -127,6 +131,7 @@ int app_init()
   RUN_TEST(test_si91x_block_device_erase, __LINE__);
   RUN_TEST(test_si91x_block_device_sync, __LINE__);
   RUN_TEST(test_si91x_block_device_lock_and_unlock, __LINE__);
+  RUN_TEST(test_si91x_block_device_coalesced_prog, __LINE__);
 
   UnityEnd();
   UnityPrintf("END");
@@ -216,3 +221,43 @@ void test_si91x_block_device_lock_and_unlock(void)
   UnityPrintf("tested  block device unlock callback \n");
   UnityPrintf("Testing  block device lock and unlock callback API's completed successfully \n");
 }
+
+/*******************************************************************************
+ * Function to test adjacent programs of LittleFS block device
+ ******************************************************************************/
+void test_si91x_block_device_coalesced_prog(void)
+{
+  UnityPrintf("\n");
+  UnityPrintf("Testing LittleFS Block Device adjacent Program \n");
+  int status;
+  uint32_t start_tick;
+  uint32_t elapsed_ticks;
+
+  status = si91x_block_device_erase(&cfg, TEST_PROG_BLOCK);
+  TEST_ASSERT_EQUAL_INT(0, status);
+
+  for (uint32_t i = 0; i < sizeof(prog_buffer); i++) {
+    prog_buffer[i] = (uint8_t)i;
+  }
+
+  UnityPrintf("Testing %d adjacent programs followed by sync \n", TEST_PROG_COUNT);
+  start_tick = osKernelGetTickCount();
+  for (uint32_t i = 0; i < TEST_PROG_COUNT; i++) {
+    status = si91x_block_device_prog(&cfg, TEST_PROG_BLOCK, i * TEST_SIZE, &prog_buffer[i * TEST_SIZE], TEST_SIZE);
+    TEST_ASSERT_EQUAL_HEX(0, status);
+  }
+  status = si91x_block_device_sync(&cfg);
+  TEST_ASSERT_EQUAL_INT(0, status);
+  elapsed_ticks = osKernelGetTickCount() - start_tick;
+  UnityPrintf("Programmed %d bytes in %lu ticks \n", sizeof(prog_buffer), elapsed_ticks);
+
+  UnityPrintf("Testing read back of the programmed data \n");
+  for (uint32_t i = 0; i < TEST_PROG_COUNT; i++) {
+    status = si91x_block_device_read(&cfg, TEST_PROG_BLOCK, i * TEST_SIZE, buffer, TEST_SIZE);
+    TEST_ASSERT_EQUAL_INT(0, status);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(&prog_buffer[i * TEST_SIZE], buffer, TEST_SIZE);
+  }
+  UnityPrintf("Status of API is correct, LittleFS Block Device adjacent Program successfully \n");
+
+  UnityPrintf("LittleFS Block Device adjacent Program test completed \n");
+}
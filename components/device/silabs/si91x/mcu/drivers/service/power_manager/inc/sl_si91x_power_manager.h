@@ -153,6 +153,21 @@ extern "C" {
 #define SL_SI91X_POWER_MANAGER_CORE_EXIT_CRITICAL  sl_si91x_power_manager_core_exitcritical()
 /** @endcond */
 
+// Opt-in: the default wakeup time and power ratio are estimates, not characterized values.
+#ifndef SL_SI91X_POWER_MANAGER_SLEEP_GOVERNOR
+#define SL_SI91X_POWER_MANAGER_SLEEP_GOVERNOR 0 ///< Enable (1) or disable (0) the idle state selection by break-even time.
+#endif
+
+#ifndef SL_SI91X_POWER_MANAGER_SLEEP_WAKEUP_TIME_US
+#define SL_SI91X_POWER_MANAGER_SLEEP_WAKEUP_TIME_US \
+  1000 ///< Wakeup time from sleep in microseconds that the core cannot measure, i.e., while it is powered down.
+#endif
+
+#ifndef SL_SI91X_POWER_MANAGER_SLEEP_POWER_RATIO_PERCENT
+#define SL_SI91X_POWER_MANAGER_SLEEP_POWER_RATIO_PERCENT \
+  200 ///< Power drawn during the sleep transitions, in percent of the power saved by sleeping instead of standby.
+#endif
+
 // -----------------------------------------------------------------------------
 // Data Types.
 
@@ -232,6 +247,21 @@ typedef struct {
   sl_power_manager_ps_transition_event_info_t *info; ///< Handle event info.
 } sl_power_manager_ps_transition_event_handle_t;
 
+/// @brief Structure representing the running statistics of a latency, in core clock cycles.
+typedef struct {
+  uint32_t count;       ///< Number of measured latencies.
+  uint32_t last_cycles; ///< Last measured latency.
+  uint32_t min_cycles;  ///< Shortest measured latency.
+  uint32_t max_cycles;  ///< Longest measured latency.
+  uint32_t mean_cycles; ///< Mean of the measured latencies.
+} sl_power_latency_stats_t;
+
+/// @brief Structure representing the latency statistics of a power state transition.
+typedef struct {
+  sl_power_latency_stats_t entry; ///< From the start of the transition until the core stops or the transition ends.
+  sl_power_latency_stats_t exit;  ///< From the wakeup until the transition ends. Only measured for sleep states.
+} sl_power_transition_stats_t;
+
 /** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
 // -----------------------------------------------------------------------------
 // Internal API Prototypes
@@ -893,6 +923,78 @@ bool sl_si91x_power_manager_is_tx_command_in_progress(void);
  ******************************************************************************/
 void sl_si91x_power_manager_deinit(void);
 
+/***************************************************************************/
+/**
+ * @brief To get the latency statistics of a power state transition.
+ * 
+ * @details The entry and exit latencies of every transition are measured with the DWT cycle counter
+ *          and kept as running statistics from the Power Manager initialization.
+ *          - For transitions between active states, the entry latency is the duration of the transition.
+ *          - For sleep transitions (Sleep, PS1), the entry latency ends when the core stops, and the exit
+ *            latency starts when the core runs again after wakeup. The wakeup time of the hardware is not
+ *            included, see \ref SL_SI91X_POWER_MANAGER_SLEEP_WAKEUP_TIME_US.
+ * 
+ *          The cycles are counted at the core clock of the transition, which can be different in the
+ *          entry and exit phases. The M4 debug peripheral must be powered for the measurement.
+ * 
+ * @pre Pre-conditions:
+ * - \ref sl_si91x_power_manager_init 
+ * 
+ * @param[in] from Power state the transition starts from, PS2, PS3 or PS4 (of type \ref sl_power_state_t).
+ * @param[in] to   Power state the transition goes to (of type \ref sl_power_state_t).
+ * @param[out] stats Latency statistics of the transition \ref sl_power_transition_stats_t.
+ * 
+ * @return Status code indicating the result:
+ *         - SL_STATUS_OK  - Success.
+ *         - SL_STATUS_NOT_INITIALIZED  - Power Manager is not initialized.
+ *         - SL_STATUS_NULL_POINTER  - Null pointer is passed.
+ *         - SL_STATUS_INVALID_PARAMETER  - Invalid parameter is passed.
+ * 
+ * For more information on status codes, see [SL STATUS DOCUMENTATION](https://docs.silabs.com/gecko-platform/latest/platform-common/status).
+ ******************************************************************************/
+sl_status_t sl_si91x_power_manager_get_transition_stats(sl_power_state_t from,
+                                                        sl_power_state_t to,
+                                                        sl_power_transition_stats_t *stats);
+
+/***************************************************************************/
+/**
+ * @brief To clear the latency statistics of all the power state transitions.
+ ******************************************************************************/
+void sl_si91x_power_manager_reset_transition_stats(void);
+
+/***************************************************************************/
+/**
+ * @brief To get the break-even time of sleep from the current power state.
+ * 
+ * @details Sleep saves energy over standby only if the system stays idle long enough to pay back the energy
+ *          spent in the sleep transitions. The break-even time is the mean measured sleep transition time,
+ *          plus \ref SL_SI91X_POWER_MANAGER_SLEEP_WAKEUP_TIME_US, scaled by
+ *          \ref SL_SI91X_POWER_MANAGER_SLEEP_POWER_RATIO_PERCENT.
+ * 
+ * @pre Pre-conditions:
+ * - \ref sl_si91x_power_manager_init 
+ * 
+ * @return Break-even time in microseconds.
+ ******************************************************************************/
+uint32_t sl_si91x_power_manager_get_sleep_break_even_time(void);
+
+/***************************************************************************/
+/**
+ * @brief To select the power state to enter for an idle period.
+ * 
+ * @details Returns the deepest state whose break-even time fits in the idle period, i.e., 
+ *          SL_SI91X_POWER_MANAGER_SLEEP if the idle period is at least \ref sl_si91x_power_manager_get_sleep_break_even_time,
+ *          SL_SI91X_POWER_MANAGER_STANDBY otherwise. It always returns SL_SI91X_POWER_MANAGER_SLEEP if
+ *          \ref SL_SI91X_POWER_MANAGER_SLEEP_GOVERNOR is disabled.
+ * 
+ * @note In tickless mode, it is called with the time until the next sleeptimer wakeup when the system is idle.
+ * 
+ * @param[in] expected_idle_us Expected idle time in microseconds.
+ * 
+ * @return sl_power_state_t enum value of the state to enter.
+ ******************************************************************************/
+sl_power_state_t sl_si91x_power_manager_get_idle_state(uint32_t expected_idle_us);
+
 /** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
 /******************************************************************************* 
  * @brief To get the lowest possible power state from the requirement table.
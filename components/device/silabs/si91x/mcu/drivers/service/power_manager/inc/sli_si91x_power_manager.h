@@ -241,6 +241,62 @@ void sli_si91x_power_manager_low_power_hw_config(boolean_t is_sleep);
  ******************************************************************************/
 void sli_si91x_power_manager_init_debug(void);
 
+/***************************************************************************/
+/**
+ * @brief To start the latency measurement of a power state transition.
+ * 
+ * @note FOR INTERNAL USE ONLY.
+ ******************************************************************************/
+void sli_si91x_power_manager_begin_transition(void);
+
+/***************************************************************************/
+/**
+ * @brief To end the latency measurement of a power state transition and update its statistics.
+ * 
+ * @note FOR INTERNAL USE ONLY.
+ * 
+ * @param[in] from Power State from which the transition takes place (of type \ref sl_power_state_t).
+ * @param[in] to   Power State to which the transition takes place (of type \ref sl_power_state_t).
+ ******************************************************************************/
+void sli_si91x_power_manager_end_transition(sl_power_state_t from, sl_power_state_t to);
+
+/***************************************************************************/
+/**
+ * @brief To get the latency statistics of a power state transition.
+ * 
+ * @note FOR INTERNAL USE ONLY.
+ * 
+ * @param[in] from Power State from which the transition takes place (of type \ref sl_power_state_t).
+ * @param[in] to   Power State to which the transition takes place (of type \ref sl_power_state_t).
+ * @param[out] stats Latency statistics of the transition.
+ * @return Status code of the operation.
+ *         - SL_STATUS_OK  - Success.
+ *         - SL_STATUS_NULL_POINTER  - Null pointer is passed.
+ *         - SL_STATUS_INVALID_PARAMETER  - Invalid parameter is passed.
+ ******************************************************************************/
+sl_status_t sli_si91x_power_manager_get_transition_stats(sl_power_state_t from,
+                                                         sl_power_state_t to,
+                                                         sl_power_transition_stats_t *stats);
+
+/***************************************************************************/
+/**
+ * @brief To clear the latency statistics of all the power state transitions.
+ * 
+ * @note FOR INTERNAL USE ONLY.
+ ******************************************************************************/
+void sli_si91x_power_manager_reset_transition_stats(void);
+
+/***************************************************************************/
+/**
+ * @brief To get the mean time spent in the sleep transitions from a power state.
+ * 
+ * @note FOR INTERNAL USE ONLY.
+ * 
+ * @param[in] from Power State from which the system goes to sleep (of type \ref sl_power_state_t).
+ * @return Mean entry plus exit latency of the measured sleep transitions in microseconds, 0 if none was measured.
+ ******************************************************************************/
+uint32_t sli_si91x_power_manager_get_sleep_overhead_us(sl_power_state_t from);
+
 /** @} (end addtogroup POWER-MANAGER) */
 
 #ifdef __cplusplus
@@ -108,6 +108,7 @@ sl_status_t sl_si91x_power_manager_init(void)
     // and requirement table.
     sl_slist_init(&power_manager_ps_transition_event_list);
     memset(requirement_ps_table, 0, sizeof(requirement_ps_table));
+    sli_si91x_power_manager_reset_transition_stats();
     // Configures the clock to power save mode
     sli_si91x_power_manager_init_hardware();
     is_initialized = true;
@@ -243,6 +244,8 @@ sl_status_t sl_si91x_power_manager_sleep(void)
     return SL_STATUS_BUSY;
   }
 #endif
+  // Measures the sleep entry and exit latencies.
+  sli_si91x_power_manager_begin_transition();
   do {
     // Internal function to change active mode to sleep mode is called.
     // It sets the required configurations and goes into sleep mode.
@@ -257,6 +260,7 @@ sl_status_t sl_si91x_power_manager_sleep(void)
   if (status != SL_STATUS_OK) {
     return status;
   }
+  sli_si91x_power_manager_end_transition(current_state, SL_SI91X_POWER_MANAGER_SLEEP);
   // Notifies the state transition who has subscribed to it.
   notify_power_state_transition(SL_SI91X_POWER_MANAGER_SLEEP, current_state);
   // If it reaches here, then returns SL_STATUS_OK
@@ -369,6 +373,64 @@ sl_power_state_t sl_si91x_power_manager_get_current_state(void)
   return current_state;
 }
 
+/*******************************************************************************
+ * Returns the latency statistics of a power state transition.
+ * Validation of the parameters is handled in the internal function.
+ ******************************************************************************/
+sl_status_t sl_si91x_power_manager_get_transition_stats(sl_power_state_t from,
+                                                        sl_power_state_t to,
+                                                        sl_power_transition_stats_t *stats)
+{
+  if (!is_initialized) {
+    // Validate the status of power manager service, if not initialized
+    // returns error code.
+    return SL_STATUS_NOT_INITIALIZED;
+  }
+  return sli_si91x_power_manager_get_transition_stats(from, to, stats);
+}
+
+/*******************************************************************************
+ * Clears the latency statistics of all the power state transitions.
+ ******************************************************************************/
+void sl_si91x_power_manager_reset_transition_stats(void)
+{
+  sli_si91x_power_manager_reset_transition_stats();
+}
+
+/*******************************************************************************
+ * Returns the break-even time of sleep from the current power state.
+ * Sleeping for a time T instead of standing by costs the power of the sleep
+ * transitions during their duration, and saves the difference between the
+ * standby and sleep power for the rest of T. Both are equal when T is the
+ * transition time scaled by the ratio of these powers.
+ ******************************************************************************/
+uint32_t sl_si91x_power_manager_get_sleep_break_even_time(void)
+{
+  uint64_t break_even_us;
+
+  break_even_us = (uint64_t)sli_si91x_power_manager_get_sleep_overhead_us(current_state)
+                  + SL_SI91X_POWER_MANAGER_SLEEP_WAKEUP_TIME_US;
+  break_even_us = (break_even_us * SL_SI91X_POWER_MANAGER_SLEEP_POWER_RATIO_PERCENT) / 100;
+  return (break_even_us > UINT32_MAX) ? UINT32_MAX : (uint32_t)break_even_us;
+}
+
+/*******************************************************************************
+ * Selects the deepest power state whose break-even time fits in the expected
+ * idle time.
+ ******************************************************************************/
+sl_power_state_t sl_si91x_power_manager_get_idle_state(uint32_t expected_idle_us)
+{
+#if (SL_SI91X_POWER_MANAGER_SLEEP_GOVERNOR == 1)
+  if (expected_idle_us < sl_si91x_power_manager_get_sleep_break_even_time()) {
+    // Sleeping would cost more than it saves, standby instead.
+    return SL_SI91X_POWER_MANAGER_STANDBY;
+  }
+#else
+  (void)expected_idle_us;
+#endif
+  return SL_SI91X_POWER_MANAGER_SLEEP;
+}
+
 /*******************************************************************************
  * Returns the pointer to the array of requirement table.
  ******************************************************************************/
@@ -109,12 +109,37 @@
 #define RAM_192_KB              192 // Validation for 192 KB RAM
 #define RAM_256_KB              256 // Validation for 256 KB RAM
 #define RAM_320_KB              320 // Validation for 320 KB RAM
+#define US_PER_SECOND           1000000 // Microseconds per second
 
 /*******************************************************************************
  ***************************  Local Types  ********************************
  ******************************************************************************/
 typedef void (*power_state_fptr)(void);
 
+// Running statistics of a latency, in core clock cycles
+typedef struct {
+  uint32_t count;        // Number of measured latencies
+  uint32_t last_cycles;  // Last measured latency
+  uint32_t min_cycles;   // Shortest measured latency
+  uint32_t max_cycles;   // Longest measured latency
+  uint64_t total_cycles; // Sum of the measured latencies
+} latency_accumulator_t;
+
+// Latency statistics of a power state transition
+typedef struct {
+  latency_accumulator_t entry; // Entry latency
+  latency_accumulator_t exit;  // Exit latency, only measured for sleep states
+  uint64_t total_us;           // Sum of the entry and exit latencies in microseconds
+} transition_latency_t;
+
+// Measurement of the transition in progress
+typedef struct {
+  uint32_t start_cycles; // Cycle counter at the start of the current phase
+  uint32_t entry_cycles; // Entry latency, once the core has stopped
+  uint32_t entry_clock;  // Core clock during the entry phase
+  boolean_t slept;       // The core has stopped during the transition
+} transition_probe_t;
+
 /*******************************************************************************
  *********************   LOCAL FUNCTION PROTOTYPES   ***************************
  ******************************************************************************/
@@ -134,6 +159,12 @@ static sl_status_t configure_ram_memory(sl_power_ram_retention_config_t *config,
                                         uint32_t *ulpss_ram);
 static sl_status_t trigger_sleep(sli_power_sleep_config_t *config, uint8_t sleep_type);
 static sl_status_t convert_rsi_to_sl_error_code(rsi_error_t error);
+static void enable_cycle_counter(void);
+static void mark_transition_sleep(void);
+static void mark_transition_wakeup(void);
+static void update_latency(latency_accumulator_t *latency, uint32_t cycles);
+static void get_latency_stats(const latency_accumulator_t *latency, sl_power_latency_stats_t *stats);
+static uint32_t cycles_to_us(uint32_t cycles, uint32_t clock);
 #if defined(SLI_WIRELESS_COMPONENT_PRESENT) && (SLI_WIRELESS_COMPONENT_PRESENT == 1)
 __WEAK sl_status_t sli_si91x_submit_rx_pkt(void);
 #endif
@@ -186,6 +217,10 @@ static const power_state_struct_t ps_transition[NO_OF_ACTIVE_STATES] = {
   }
 };
 
+// Latency statistics of each transition, indexed like ps_transition
+static transition_latency_t transition_latency[NO_OF_ACTIVE_STATES][NO_OF_TRANSITIONS];
+static transition_probe_t transition_probe;
+
 /*******************************************************************************
 ***********************  Global function Definitions *************************
  ******************************************************************************/
@@ -210,7 +245,9 @@ sl_status_t sli_si91x_power_manager_change_power_state(sl_power_state_t from, sl
   if (ps_transition[from - PS_OFFSET].to_ps[to].fptr != NULL) {
     // If the from and to state transition function pointer is not null,
     // then it calls the function and state change is performed.
+    sli_si91x_power_manager_begin_transition();
     ps_transition[from - PS_OFFSET].to_ps[to].fptr();
+    sli_si91x_power_manager_end_transition(from, to);
     status = SL_STATUS_OK;
   } else {
     // If it reached here, returns Null pointer
@@ -463,6 +500,8 @@ void sli_si91x_power_manager_init_hardware(void)
   sli_si91x_clock_manager_config_clks_on_ps_change(sl_si91x_power_manager_get_current_state(),
                                                    sl_si91x_power_manager_get_clock_scaling());
   sli_si91x_power_manager_low_power_hw_config(true);
+  // Cycle counter for the transition latency statistics
+  enable_cycle_counter();
 #if (SL_SI91X_TICKLESS_MODE == 1)
 #ifdef SL_SLEEP_TIMER
   RSI_PS_SetWkpSources(SYSRTC_BASED_WAKEUP); //Setting SYSRTC as a wakeup source
@@ -762,7 +801,9 @@ static sl_status_t trigger_sleep(sli_power_sleep_config_t *config, uint8_t sleep
   }
 #endif
   // According to the sleep type, with retention or without retention it enters the sleep mode.
+  mark_transition_sleep();
   error_code = RSI_PS_EnterDeepSleep(sleep_type, config->low_freq_clock);
+  mark_transition_wakeup();
   // If error is encountered, it is converted to sl error code.
   status = convert_rsi_to_sl_error_code(error_code);
   return status;
@@ -899,3 +940,179 @@ static sl_status_t convert_rsi_to_sl_error_code(rsi_error_t error)
   }
   return status;
 }
+
+/*******************************************************************************
+ * Starts the latency measurement of a power state transition.
+ ******************************************************************************/
+void sli_si91x_power_manager_begin_transition(void)
+{
+  transition_probe.slept        = false;
+  transition_probe.entry_cycles = 0;
+  transition_probe.entry_clock  = SystemCoreClock;
+  transition_probe.start_cycles = DWT->CYCCNT;
+}
+
+/*******************************************************************************
+ * Ends the latency measurement of a power state transition.
+ * If the core has stopped during the transition, the entry latency was taken
+ * when it stopped and the elapsed cycles are the exit latency, otherwise they
+ * are the entry latency.
+ ******************************************************************************/
+void sli_si91x_power_manager_end_transition(sl_power_state_t from, sl_power_state_t to)
+{
+  uint32_t cycles = DWT->CYCCNT - transition_probe.start_cycles;
+  transition_latency_t *latency;
+  uint32_t primask;
+
+  if ((from > SL_SI91X_POWER_MANAGER_PS4) || (from < SL_SI91X_POWER_MANAGER_PS2) || (to >= LAST_ENUM_POWER_STATE)) {
+    return;
+  }
+  latency = &transition_latency[from - PS_OFFSET][to];
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (transition_probe.slept) {
+    update_latency(&latency->entry, transition_probe.entry_cycles);
+    update_latency(&latency->exit, cycles);
+    latency->total_us += cycles_to_us(transition_probe.entry_cycles, transition_probe.entry_clock);
+    latency->total_us += cycles_to_us(cycles, SystemCoreClock);
+  } else {
+    update_latency(&latency->entry, cycles);
+    latency->total_us += cycles_to_us(cycles, transition_probe.entry_clock);
+  }
+  __set_PRIMASK(primask);
+}
+
+/*******************************************************************************
+ * Copies the latency statistics of a power state transition.
+ ******************************************************************************/
+sl_status_t sli_si91x_power_manager_get_transition_stats(sl_power_state_t from,
+                                                         sl_power_state_t to,
+                                                         sl_power_transition_stats_t *stats)
+{
+  const transition_latency_t *latency;
+  uint32_t primask;
+
+  if (stats == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+  if ((from > SL_SI91X_POWER_MANAGER_PS4) || (from < SL_SI91X_POWER_MANAGER_PS2) || (to >= LAST_ENUM_POWER_STATE)
+      || (ps_transition[from - PS_OFFSET].to_ps[to].is_valid == INVALID)) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  latency = &transition_latency[from - PS_OFFSET][to];
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  get_latency_stats(&latency->entry, &stats->entry);
+  get_latency_stats(&latency->exit, &stats->exit);
+  __set_PRIMASK(primask);
+  return SL_STATUS_OK;
+}
+
+/*******************************************************************************
+ * Clears the latency statistics of all the power state transitions.
+ ******************************************************************************/
+void sli_si91x_power_manager_reset_transition_stats(void)
+{
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  memset(transition_latency, 0, sizeof(transition_latency));
+  __set_PRIMASK(primask);
+}
+
+/*******************************************************************************
+ * Returns the mean entry plus exit time of the sleep transitions from a power
+ * state, in microseconds.
+ ******************************************************************************/
+uint32_t sli_si91x_power_manager_get_sleep_overhead_us(sl_power_state_t from)
+{
+  const transition_latency_t *latency;
+  uint64_t overhead_us = 0;
+  uint32_t primask;
+
+  if ((from > SL_SI91X_POWER_MANAGER_PS4) || (from < SL_SI91X_POWER_MANAGER_PS2)) {
+    return 0;
+  }
+  latency = &transition_latency[from - PS_OFFSET][SL_SI91X_POWER_MANAGER_SLEEP];
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (latency->entry.count != 0) {
+    overhead_us = latency->total_us / latency->entry.count;
+  }
+  __set_PRIMASK(primask);
+  return (overhead_us > UINT32_MAX) ? UINT32_MAX : (uint32_t)overhead_us;
+}
+
+/*******************************************************************************
+ * Enables the DWT cycle counter used to measure the transition latencies.
+ ******************************************************************************/
+static void enable_cycle_counter(void)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/*******************************************************************************
+ * Takes the entry latency right before the core stops.
+ * When the core wakes up and goes back to sleep (sleep on ISR exit), only the
+ * first entry is taken.
+ ******************************************************************************/
+static void mark_transition_sleep(void)
+{
+  if (!transition_probe.slept) {
+    transition_probe.entry_cycles = DWT->CYCCNT - transition_probe.start_cycles;
+    transition_probe.slept        = true;
+  }
+}
+
+/*******************************************************************************
+ * Starts the exit latency measurement right after the core wakes up.
+ * The debug block may have been powered down with the core, so the cycle
+ * counter is enabled again.
+ ******************************************************************************/
+static void mark_transition_wakeup(void)
+{
+  enable_cycle_counter();
+  transition_probe.start_cycles = DWT->CYCCNT;
+}
+
+/*******************************************************************************
+ * Adds a measured latency to the running statistics.
+ ******************************************************************************/
+static void update_latency(latency_accumulator_t *latency, uint32_t cycles)
+{
+  if ((latency->count == 0) || (cycles < latency->min_cycles)) {
+    latency->min_cycles = cycles;
+  }
+  if (cycles > latency->max_cycles) {
+    latency->max_cycles = cycles;
+  }
+  latency->last_cycles = cycles;
+  latency->total_cycles += cycles;
+  latency->count++;
+}
+
+/*******************************************************************************
+ * Converts the running statistics of a latency to the API structure.
+ ******************************************************************************/
+static void get_latency_stats(const latency_accumulator_t *latency, sl_power_latency_stats_t *stats)
+{
+  stats->count       = latency->count;
+  stats->last_cycles = latency->last_cycles;
+  stats->min_cycles  = latency->min_cycles;
+  stats->max_cycles  = latency->max_cycles;
+  stats->mean_cycles = (latency->count != 0) ? (uint32_t)(latency->total_cycles / latency->count) : 0;
+}
+
+/*******************************************************************************
+ * Converts a number of core clock cycles to microseconds.
+ ******************************************************************************/
+static uint32_t cycles_to_us(uint32_t cycles, uint32_t clock)
+{
+  if (clock == 0) {
+    return 0;
+  }
+  return (uint32_t)(((uint64_t)cycles * US_PER_SECOND) / clock);
+}
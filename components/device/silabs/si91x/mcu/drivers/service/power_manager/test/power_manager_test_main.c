@@ -79,6 +79,7 @@ void test_power_manager_subscribe_ps_transition_event(void);
 void test_power_manager_unsubscribe_ps_transition_event(void);
 void test_power_manager_sleep(void);
 void test_power_manager_standby(void);
+void test_power_manager_transition_stats(void);
 void test_power_manager_set_wakeup_sources(void);
 void test_power_manager_configure_ram_retention(void);
 void test_power_manager_get_current_state(void);
@@ -129,6 +130,7 @@ void app_init()
   RUN_TEST(test_power_manager_set_wakeup_sources, __LINE__);
   RUN_TEST(test_power_manager_sleep, __LINE__);
   RUN_TEST(test_power_manager_standby, __LINE__);
+  RUN_TEST(test_power_manager_transition_stats, __LINE__);
   RUN_TEST(test_power_manager_unsubscribe_ps_transition_event, __LINE__);
   RUN_TEST(test_power_manager_remove_peripheral_requirement, __LINE__);
   RUN_TEST(test_power_manager_remove_ps_requirement, __LINE__);
@@ -654,6 +656,61 @@ void test_power_manager_standby(void)
   UnityPrintf("Power Manager move into standby mode test completed \n");
 }
 
+/*******************************************************************************
+ * Function to test transition latency statistics and idle state selection.
+ ******************************************************************************/
+void test_power_manager_transition_stats(void)
+{
+  UnityPrintf("\n");
+  UnityPrintf("Testing Power Manager transition latency statistics \n");
+  sl_status_t status;
+  sl_power_transition_stats_t stats;
+  sl_power_state_t state = sl_si91x_power_manager_get_current_state();
+
+  UnityPrintf("Testing with NULL pointer \n");
+  status = sl_si91x_power_manager_get_transition_stats(state, SL_SI91X_POWER_MANAGER_SLEEP, NULL);
+  TEST_ASSERT_EQUAL_HEX(SL_STATUS_NULL_POINTER, status);
+  UnityPrintf("Status of API is correct, NULL pointer test successfully \n");
+
+  UnityPrintf("Testing with invalid parameters \n");
+  status = sl_si91x_power_manager_get_transition_stats(SL_SI91X_POWER_MANAGER_PS1, SL_SI91X_POWER_MANAGER_SLEEP, &stats);
+  TEST_ASSERT_EQUAL_HEX(SL_STATUS_INVALID_PARAMETER, status);
+  status = sl_si91x_power_manager_get_transition_stats(state, state, &stats);
+  TEST_ASSERT_EQUAL_HEX(SL_STATUS_INVALID_PARAMETER, status);
+  UnityPrintf("Status of API is correct, invalid parameters test successfully \n");
+
+  UnityPrintf("Testing sleep latency after sleep test \n");
+  status = sl_si91x_power_manager_get_transition_stats(state, SL_SI91X_POWER_MANAGER_SLEEP, &stats);
+  TEST_ASSERT_EQUAL_HEX(SL_STATUS_OK, status);
+  TEST_ASSERT_TRUE(stats.entry.count > 0);
+  TEST_ASSERT_EQUAL(stats.entry.count, stats.exit.count);
+  TEST_ASSERT_TRUE(stats.entry.min_cycles <= stats.entry.mean_cycles);
+  TEST_ASSERT_TRUE(stats.entry.mean_cycles <= stats.entry.max_cycles);
+  UnityPrintf("Sleep entry latency: %lu cycles, exit latency: %lu cycles \n",
+              stats.entry.mean_cycles,
+              stats.exit.mean_cycles);
+
+  UnityPrintf("Testing idle state selection \n");
+  TEST_ASSERT_TRUE(sl_si91x_power_manager_get_sleep_break_even_time() > 0);
+#if (SL_SI91X_POWER_MANAGER_SLEEP_GOVERNOR == 1)
+  TEST_ASSERT_EQUAL(SL_SI91X_POWER_MANAGER_STANDBY, sl_si91x_power_manager_get_idle_state(0));
+#else
+  TEST_ASSERT_EQUAL(SL_SI91X_POWER_MANAGER_SLEEP, sl_si91x_power_manager_get_idle_state(0));
+#endif
+  TEST_ASSERT_EQUAL(SL_SI91X_POWER_MANAGER_SLEEP, sl_si91x_power_manager_get_idle_state(UINT32_MAX));
+  UnityPrintf("Idle state selection is correct \n");
+
+  UnityPrintf("Testing reset of statistics \n");
+  sl_si91x_power_manager_reset_transition_stats();
+  status = sl_si91x_power_manager_get_transition_stats(state, SL_SI91X_POWER_MANAGER_SLEEP, &stats);
+  TEST_ASSERT_EQUAL_HEX(SL_STATUS_OK, status);
+  TEST_ASSERT_EQUAL(0, stats.entry.count);
+  TEST_ASSERT_EQUAL(0, stats.exit.count);
+  UnityPrintf("Statistics reset successfully \n");
+
+  UnityPrintf("Power Manager transition latency statistics test completed \n");
+}
+
 /*******************************************************************************
  * Function to test set wakeup source.
  ******************************************************************************/
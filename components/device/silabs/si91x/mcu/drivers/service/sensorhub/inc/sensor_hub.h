@@ -58,6 +58,12 @@
 #define SL_SH_POWER_SAVE_TASK_STACK_SIZE (512 * 2)     ///< Power task stack size
 #define SL_EM_TASK_RUN_TICKS             osWaitForever ///< Max wait time of message queue in Event task
 #define MAP_TABLE_SIZE                   10            ///< Size of the sensors interrupt MAP table
+#ifndef SL_SH_EM_QUEUE_LENGTH
+#define SL_SH_EM_QUEUE_LENGTH 20 ///< Number of events the EM task queue holds
+#endif
+#ifndef SL_SH_SAMPLING_SLACK
+#define SL_SH_SAMPLING_SLACK 10 ///< Ticks a polled sensor may be sampled early to share a wake-up, at most 1/4 interval
+#endif
 
 /*******************************************************************************
  ***********************  GPIO IRQ Defines / Macros  ***************************
@@ -124,7 +130,8 @@ typedef enum {
   SL_SENSOR_START_FAILED,    ///< Event indicating that the sensor failed to start
   SL_SENSOR_STOP_FAILED,     ///< Event indicating that the sensor failed to stop
   SL_SENSOR_DELETED,         ///< Event indicating that the sensor has been deleted
-  SL_SENSOR_DELETE_FAILED    ///< Event indicating that the sensor deletion failed
+  SL_SENSOR_DELETE_FAILED,   ///< Event indicating that the sensor deletion failed
+  SL_SENSOR_BATCH_READY      ///< Event indicating that the sensor ring buffer reached its watermark
 } sl_sensorhub_event_t;
 
 /**
@@ -210,6 +217,51 @@ typedef struct {
   sl_sensor_data_group_t *sensor_data_ptr; ///< Pointer to Sensor data storage structure
 } sl_sensor_info_t;
 
+/**
+ * @brief Back-pressure statistics of a sensor ring buffer.
+ */
+
+typedef struct {
+  uint32_t produced;       ///< Samples written to the ring buffer
+  uint32_t dropped;        ///< Samples not taken because the ring buffer was full
+  uint32_t consumed;       ///< Samples released by the application
+  uint32_t batches_posted; ///< Batch ready events posted to the application
+  uint32_t post_failures;  ///< Batch ready events dropped because the EM queue was full
+  uint32_t max_latency;    ///< Longest time, in ticks, between sampling and release of a sample
+  uint16_t max_level;      ///< Highest number of samples held in the ring buffer
+} sl_sensor_ring_stats_t;
+
+/**
+ * @brief Statistics of the shared sampling timer of the polled sensors.
+ */
+
+typedef struct {
+  uint32_t wakeups;   ///< Expiries of the sampling timer that sampled at least one sensor
+  uint32_t samples;   ///< Sampling events set for the polled sensors
+  uint32_t coalesced; ///< Samples taken before their deadline to share the wake-up of another sensor
+  uint32_t missed;    ///< Sampling periods skipped because the sampling timer ran late
+  uint32_t max_early; ///< Longest time, in ticks, a sample was taken before its deadline
+  uint32_t max_late;  ///< Longest time, in ticks, a sample was taken after its deadline
+} sl_sensor_sampling_stats_t;
+
+/**
+ * @brief Single producer, single consumer ring buffer of sensor samples.
+ *
+ * The sensor task is the only writer of head and the application the only writer of tail,
+ * so neither side takes a lock.
+ */
+
+typedef struct {
+  sl_sensor_data_t *samples;      ///< Sample storage, NULL when the ring buffer is not configured
+  uint32_t *timestamps;           ///< Kernel tick count at which each sample was taken
+  uint16_t depth;                 ///< Number of samples the ring buffer holds, a power of two
+  uint16_t watermark;             ///< Number of buffered samples that posts SL_SENSOR_BATCH_READY
+  volatile uint32_t head;         ///< Free running write index
+  volatile uint32_t tail;         ///< Free running read index
+  volatile uint8_t batch_pending; ///< Set from posting SL_SENSOR_BATCH_READY until the next release
+  sl_sensor_ring_stats_t stats;   ///< Back-pressure statistics
+} sl_sensor_ring_buffer_t;
+
 /**
  * @brief Structure to monitor and handle the sensors.
  */
@@ -223,7 +275,9 @@ typedef struct {
   sl_sensor_info_t *config_st;        ///< Sensor configuration structure
   sl_sensor_impl_type_t *sensor_impl; ///< Sensor implementation structure
   sl_sensor_status_t sensor_status;   ///< Sensor status
-  TimerHandle_t timer_handle;         ///< RTOS timer handle
+  uint32_t next_sample_tick;          ///< Kernel tick of the next sampling deadline in polling mode
+  volatile uint8_t sampling_armed;    ///< Set while the shared sampling timer samples the sensor
+  sl_sensor_ring_buffer_t ring;       ///< Sample ring buffer, used instead of sensor_data_ptr when configured
 } sl_sensor_handle_t;
 
 /**
@@ -472,6 +526,129 @@ sl_status_t sl_si91x_sensorhub_start_sensor(sl_sensor_id_t sensor_id);
 ******************************************************************************/
 sl_status_t sl_si91x_sensorhub_stop_sensor(sl_sensor_id_t sensor_id);
 
+/***************************************************************************/ /**
+* @brief To deliver the samples of the given sensor in batches through a ring buffer.
+*
+* @details
+* This function performs the following operations:
+* - Allocate a ring buffer of depth samples from the sensor data RAM.
+* - Every sample taken is appended to the ring buffer instead of the sensor_data_ptr storage,
+*   and the data delivery mode and event acknowledgment of the sensor are no longer used.
+*   Sensors that buffer samples themselves, like IMU FIFOs, may append several samples per
+*   sampling event, up to the max_number room given in the sl_sensor_data_group_t.
+* - SL_SENSOR_BATCH_READY is posted when watermark samples are buffered. It is posted again
+*   only after the application releases samples with @ref sl_si91x_sensorhub_ring_buffer_release.
+* - When the ring buffer is full, new samples are not taken and are counted as dropped.
+*
+* @pre Pre-condition:
+*      - \ref sl_si91x_sensorhub_create_sensor
+*
+* @param[in] sensor_id - Sensor ID.
+* @param[in] depth -     Number of samples the ring buffer holds, a power of two.
+* @param[in] watermark - Number of buffered samples that triggers SL_SENSOR_BATCH_READY, 1 to depth.
+*
+* @return Status code indicating the result:
+*       - SL_STATUS_OK  - Success, ring buffer configured.
+*       - SL_SH_SENSOR_CREATE_FAIL - Given sensor not created.
+*       - SL_SH_INVALID_PARAMETERS - Invalid depth or watermark, or the sensor is an ADC sensor.
+*       - SL_SH_RING_BUFFER_ALREADY_CONFIGURED - The sensor already has a ring buffer, or it is started.
+*       - SL_SH_MEMORY_LIMIT_EXCEEDED - Not enough sensor data RAM left.
+* 
+* For more information on status codes, see [SL STATUS DOCUMENTATION](https://docs.silabs.com/gecko-platform/latest/platform-common/status).
+******************************************************************************/
+sl_status_t sl_si91x_sensorhub_configure_ring_buffer(sl_sensor_id_t sensor_id, uint16_t depth, uint16_t watermark);
+
+/***************************************************************************/ /**
+* @brief To get the oldest samples buffered for the given sensor without copying them.
+*
+* @details
+* The samples returned are contiguous in the ring buffer, so fewer samples than buffered are
+* returned when they wrap around the end of the ring buffer. They stay valid until they are released
+* with @ref sl_si91x_sensorhub_ring_buffer_release. Only one task may consume the samples of a sensor.
+*
+* @param[in] sensor_id -   Sensor ID.
+* @param[out] samples -    Pointer to the first sample.
+* @param[out] timestamps - Pointer to the kernel tick count of the first sample, may be NULL.
+* @param[out] count -      Number of samples available at samples.
+*
+* @return Status code indicating the result:
+*       - SL_STATUS_OK  - Success, count is at least 1.
+*       - SL_STATUS_EMPTY - No samples are buffered.
+*       - SL_SH_INVALID_PARAMETERS - Invalid parameters.
+*       - SL_SH_SENSOR_CREATE_FAIL - Given sensor not created.
+*       - SL_SH_RING_BUFFER_NOT_CONFIGURED - The sensor has no ring buffer.
+* 
+* For more information on status codes, see [SL STATUS DOCUMENTATION](https://docs.silabs.com/gecko-platform/latest/platform-common/status).
+******************************************************************************/
+sl_status_t sl_si91x_sensorhub_ring_buffer_peek(sl_sensor_id_t sensor_id,
+                                                sl_sensor_data_t **samples,
+                                                const uint32_t **timestamps,
+                                                uint16_t *count);
+
+/***************************************************************************/ /**
+* @brief To release the oldest samples buffered for the given sensor.
+*
+* @details
+* Released samples are overwritten by the sensor task. Releasing also re-arms SL_SENSOR_BATCH_READY.
+*
+* @param[in] sensor_id - Sensor ID.
+* @param[in] count -     Number of samples to release, at most the number buffered.
+*
+* @return Status code indicating the result:
+*       - SL_STATUS_OK  - Success, samples released.
+*       - SL_SH_INVALID_PARAMETERS - More samples than buffered.
+*       - SL_SH_SENSOR_CREATE_FAIL - Given sensor not created.
+*       - SL_SH_RING_BUFFER_NOT_CONFIGURED - The sensor has no ring buffer.
+* 
+* For more information on status codes, see [SL STATUS DOCUMENTATION](https://docs.silabs.com/gecko-platform/latest/platform-common/status).
+******************************************************************************/
+sl_status_t sl_si91x_sensorhub_ring_buffer_release(sl_sensor_id_t sensor_id, uint16_t count);
+
+/***************************************************************************/ /**
+* @brief To get the back-pressure statistics of the ring buffer of the given sensor.
+*
+* @param[in] sensor_id - Sensor ID.
+* @param[out] stats -    Statistics of the ring buffer.
+*
+* @return Status code indicating the result:
+*       - SL_STATUS_OK  - Success, statistics copied.
+*       - SL_SH_INVALID_PARAMETERS - Invalid parameters.
+*       - SL_SH_SENSOR_CREATE_FAIL - Given sensor not created.
+*       - SL_SH_RING_BUFFER_NOT_CONFIGURED - The sensor has no ring buffer.
+* 
+* For more information on status codes, see [SL STATUS DOCUMENTATION](https://docs.silabs.com/gecko-platform/latest/platform-common/status).
+******************************************************************************/
+sl_status_t sl_si91x_sensorhub_get_ring_buffer_stats(sl_sensor_id_t sensor_id, sl_sensor_ring_stats_t *stats);
+
+/***************************************************************************/ /**
+* @brief To get the statistics of the shared sampling timer of the polled sensors.
+*
+* @details
+* All polled sensors are sampled from one timer. Sampling deadlines are aligned to multiples of
+* the sampling interval, so sensors with harmonic intervals wake up together, and a sensor due
+* within SL_SH_SAMPLING_SLACK ticks of a wake-up is sampled early instead of waking up again.
+*
+* @param[out] stats - Statistics of the sampling timer.
+*
+* @return Status code indicating the result:
+*       - SL_STATUS_OK  - Success, statistics copied.
+*       - SL_SH_INVALID_PARAMETERS - Invalid parameters.
+* 
+* For more information on status codes, see [SL STATUS DOCUMENTATION](https://docs.silabs.com/gecko-platform/latest/platform-common/status).
+******************************************************************************/
+sl_status_t sl_si91x_sensorhub_get_sampling_stats(sl_sensor_sampling_stats_t *stats);
+
+/***************************************************************************/ /**
+* @brief To get the time until the next wake-up of the shared sampling timer.
+*
+* @details
+* The application can use it in app_is_ok_to_sleep() to skip sleep states whose
+* wake-up time is longer than the time left before the next sensor is sampled.
+*
+* @return Ticks until the next sampling wake-up, 0 if it is due, or osWaitForever if no polled sensor is started.
+******************************************************************************/
+uint32_t sl_si91x_sensorhub_get_next_sampling_delay(void);
+
 /***************************************************************************/ /**
 * @brief To post the events to Event Manager (EM) to be notified to the application.
 *
@@ -644,7 +821,8 @@ sl_status_t sl_si91x_sensorhub_notify_cb_register(sl_sensor_signalEvent_t cb_eve
 * @brief Callback function to set the event flag
 *
 * @details
-* This function will set the event flag bits based on the sensor sampling intervals.
+* This function will set the event flag bits of the polled sensors that are due, and re-arm
+* the shared sampling timer for the next deadline.
 * In the polling mode call the timer call-back function.
 *
 * @param[in] xTimer   -   Timer handle.
@@ -914,6 +1092,20 @@ void sli_config_sdc_params(sl_drv_sdc_config_t *sdc_config_st_p);
 ///    .sensor_intr_type           = - SL_SH_FALL_EDGE,
 ///    .data_deliver.data_mode     = - SL_SH_NO_DATA_MODE,
 ///    ```
+///    * **Ring buffer delivery**: Instead of a data_deliver.mode, a polling or interrupt sensor can deliver every sample through a ring buffer, configured after the sensor is created:
+///    ```C
+///    sl_si91x_sensorhub_configure_ring_buffer(sensor_id, 64, 16); // 64 samples, SL_SENSOR_BATCH_READY at 16
+///    ```
+///      * On SL_SENSOR_BATCH_READY, read the samples in place and release them:
+///    ```C
+///    while (sl_si91x_sensorhub_ring_buffer_peek(sensor_id, &samples, &timestamps, &count) == SL_STATUS_OK) {
+///      // process samples[0] to samples[count - 1]
+///      sl_si91x_sensorhub_ring_buffer_release(sensor_id, count);
+///    }
+///    ```
+///      * Samples taken while the ring buffer is full are dropped and counted, see sl_si91x_sensorhub_get_ring_buffer_stats().
+///      * The ring buffer is allocated from the 4 KB sensor data RAM, which can be resized with the SL_SH_SENSORS_RAM_SIZE macro.
+///
 ///    * To configure the PS2, please update the below macro in the preprocessor settings:
 ///    ```C
 ///    - SL_SENSORHUB_POWERSAVE=1
@@ -96,6 +96,13 @@
 #define SL_SH_EM_TASK_CREATION_FAILED     (27 << SL_SH_SENSORHUB_ERRORS_MASK) ///< EM task creation failed
 #define SL_ALL_PERIPHERALS_INIT_FAILED \
   (28 << SL_SH_SENSORHUB_ERRORS_MASK) ///< All(i2c,spi,adc) peripheral's initialization failed
+
+/****************************RING BUFFER ERRORS******************************/
+
+#define SL_SH_RING_BUFFER_NOT_CONFIGURED \
+  (29 << SL_SH_SENSORHUB_ERRORS_MASK) ///< Ring buffer API is called for a sensor without a ring buffer
+#define SL_SH_RING_BUFFER_ALREADY_CONFIGURED \
+  (30 << SL_SH_SENSORHUB_ERRORS_MASK) ///< Ring buffer is already configured or the sensor is started
 /** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
 #define SL_DRIVER_OK ARM_DRIVER_OK ///< Operation succeeded
 /** @endcond */
@@ -67,7 +67,9 @@
 /*******************************************************************************
  ********************** Sensor HUB Defines / Macros  ***************************
  ******************************************************************************/
-#define SENSORS_RAM_SIZE            4096 //< This RAM is used the store all sensor's data
+#ifndef SL_SH_SENSORS_RAM_SIZE
+#define SL_SH_SENSORS_RAM_SIZE 4096 //< This RAM is used the store all sensor's data, including ring buffers
+#endif
 #define ALARM_WAKEUP_SOURCE         1    //< This is for the Alarm based wakup
 #define GPIO_WAKEUP_SOURCE          0    //< This is for the UULP_GPIO based wakup
 #define SL_SH_SOCLDOTURNONWAITTIME  31
@@ -141,8 +143,8 @@ ARM_DRIVER_SPI *SPIdrv       = &Driver_SSI_ULP_MASTER; //< ULP SSI driver operat
 uint8_t sl_sensor_wait_flags = 0;                      //< Store the sensor event bits
 static RTC_TIME_CONFIG_T rtcConfig, alarmConfig, rtc_get_Time;
 /*TODO: the sensor_data_ram must be mapped to ULP RAM*/
-uint8_t sensor_data_ram[SENSORS_RAM_SIZE] __attribute__((aligned(4))); //< Ram using for the sensor data storage
-uint32_t free_ram_index = 0;                                           //< ram index for the sensor
+uint8_t sensor_data_ram[SL_SH_SENSORS_RAM_SIZE] __attribute__((aligned(4))); //< Ram using for the sensor data storage
+uint32_t free_ram_index = 0;                                                 //< ram index for the sensor
 #ifdef SL_SH_ADC_CHANNEL0
 extern uint16_t *adc_data_ptrs[];
 #endif
@@ -159,6 +161,22 @@ static void transition_callback(sl_power_state_t from, sl_power_state_t to);
 sl_power_manager_ps_transition_event_handle_t handle;
 sl_power_manager_ps_transition_event_info_t info = { .event_mask = PS_EVENT_MASK, .on_event = transition_callback };
 
+/*******************************************************************************
+ **************************  Ring buffer functions *****************************
+ ******************************************************************************/
+static void sli_si91x_sensor_bus_init(sl_sensor_bus_t sensor_bus);
+static void sli_si91x_sensor_ring_sample(sl_sensor_handle_t *sensor);
+
+/*******************************************************************************
+ ***********************  Sampling timer functions *****************************
+ ******************************************************************************/
+static void sli_si91x_sampling_schedule(void *parameter1, uint32_t parameter2);
+static sl_status_t sli_si91x_sampling_reschedule(void);
+static TimerHandle_t sl_sampling_timer = NULL;       //< Shared timer sampling the polled sensors
+static sl_sensor_sampling_stats_t sl_sampling_stats; //< Statistics of the shared sampling timer
+static volatile uint32_t sl_sampling_wakeup_tick;    //< Kernel tick the sampling timer is armed for
+static volatile uint8_t sl_sampling_timer_armed;     //< Set while the sampling timer is armed
+
 /*******************************************************************************
  ******************  CMSIS OS handlers/Variables   *****************************
  ******************************************************************************/
@@ -693,8 +711,104 @@ sl_status_t sl_si91x_sensorhub_notify_cb_register(sl_sensor_signalEvent_t cb_eve
 *******************************************************************************/
 void sl_si91x_sensors_timer_cb(TimerHandle_t xTimer)
 {
-  uint32_t event_bit = (uint32_t)pvTimerGetTimerID(xTimer);
-  osEventFlagsSet(sl_event_group, (0x01 << event_bit));
+  (void)xTimer;
+  sli_si91x_sampling_schedule(NULL, 0);
+}
+
+/**************************************************************************/ /**
+ *  @fn          static void sli_si91x_sampling_schedule(void *parameter1, uint32_t parameter2)
+ *  @brief       Sets the events of the polled sensors that are due and re-arms the shared
+ *               sampling timer for the earliest next deadline. A sensor due within its slack
+ *               is sampled with this wake-up instead of waking up the MCU again.
+ *               Runs in the timer service task, from the timer callback or pended by
+ *               sli_si91x_sampling_reschedule(), so that the timer is only armed from there.
+ *  @param[in]   parameter1    unused
+ *  @param[in]   parameter2    unused
+*******************************************************************************/
+static void sli_si91x_sampling_schedule(void *parameter1, uint32_t parameter2)
+{
+  TickType_t now      = xTaskGetTickCount();
+  uint32_t next_delay = osWaitForever;
+  uint32_t events     = 0;
+  uint32_t sampled    = 0;
+
+  (void)parameter1;
+  (void)parameter2;
+
+  for (uint8_t i = 0; i < SL_MAX_NUM_SENSORS; i++) {
+    sl_sensor_handle_t *sensor = &sensor_list.sl_sensors_st[i];
+    uint32_t interval;
+    uint32_t slack;
+    int32_t remaining;
+
+    if (sensor->sampling_armed == 0) {
+      continue;
+    }
+    interval  = sensor->config_st->sampling_interval;
+    slack     = ((interval / 4) < SL_SH_SAMPLING_SLACK) ? (interval / 4) : SL_SH_SAMPLING_SLACK;
+    remaining = (int32_t)(sensor->next_sample_tick - now);
+
+    if (remaining <= (int32_t)slack) {
+      events |= (0x01 << sensor->sensor_event_bit);
+      sampled++;
+      if (remaining > 0) {
+        sl_sampling_stats.coalesced++;
+        if ((uint32_t)remaining > sl_sampling_stats.max_early) {
+          sl_sampling_stats.max_early = (uint32_t)remaining;
+        }
+      } else if ((uint32_t)(-remaining) > sl_sampling_stats.max_late) {
+        sl_sampling_stats.max_late = (uint32_t)(-remaining);
+      }
+
+      // Stay on the interval grid, early samples must not drift the following deadlines
+      sensor->next_sample_tick += interval;
+      remaining = (int32_t)(sensor->next_sample_tick - now);
+      if (remaining <= 0) {
+        uint32_t missed = ((uint32_t)(-remaining) / interval) + 1;
+
+        sensor->next_sample_tick += missed * interval;
+        sl_sampling_stats.missed += missed;
+        remaining = (int32_t)(sensor->next_sample_tick - now);
+      }
+    }
+
+    if ((uint32_t)remaining < next_delay) {
+      next_delay = (uint32_t)remaining;
+    }
+  }
+
+  if (events != 0) {
+    sl_sampling_stats.wakeups++;
+    sl_sampling_stats.samples += sampled;
+    osEventFlagsSet(sl_event_group, events);
+  }
+
+  if (next_delay == osWaitForever) {
+    sl_sampling_timer_armed = 0;
+    xTimerStop(sl_sampling_timer, 0);
+  } else {
+    sl_sampling_wakeup_tick = now + next_delay;
+    sl_sampling_timer_armed = 1;
+    // The timer is one-shot, changing its period also starts it
+    if (xTimerChangePeriod(sl_sampling_timer, next_delay, 0) != pdPASS) {
+      DEBUGOUT("\r\n Sampling timer re-arm failed \r\n");
+    }
+  }
+}
+
+/**************************************************************************/ /**
+ *  @fn          static sl_status_t sli_si91x_sampling_reschedule(void)
+ *  @brief       Re-arms the shared sampling timer after a polled sensor was started or stopped.
+ *  @return      SL_STATUS_OK if the reschedule was queued to the timer service task,
+ *               SL_STATUS_FAIL otherwise
+*******************************************************************************/
+static sl_status_t sli_si91x_sampling_reschedule(void)
+{
+  if (xTimerPendFunctionCall(sli_si91x_sampling_schedule, NULL, 0, portMAX_DELAY) != pdPASS) {
+    return SL_STATUS_FAIL;
+  }
+
+  return SL_STATUS_OK;
 }
 
 /**************************************************************************/ /**
@@ -1159,7 +1273,6 @@ sl_status_t sl_si91x_sensorhub_create_sensor(sl_sensor_id_t sensor_id)
   uint8_t sensor_index;
   sl_status_t status         = 0;
   uint32_t ramAllocationSize = 0;
-  char sl_sensor_timer_name[16];
 
   local_info = sli_si91x_get_sensor_info(sensor_id);
   if (NULL == local_info) {
@@ -1177,6 +1290,7 @@ sl_status_t sl_si91x_sensorhub_create_sensor(sl_sensor_id_t sensor_id)
 
   sensor_list.sl_sensors_st[sensor_index].sensor_event_bit     = sensor_index;
   sensor_list.sl_sensors_st[sensor_index].config_st            = local_info;
+  memset(&sensor_list.sl_sensors_st[sensor_index].ring, 0, sizeof(sl_sensor_ring_buffer_t));
   sensor_list.sl_sensors_st[sensor_index].config_st->sensor_id = sensor_id;
   sl_sensor_wait_flags |= (uint8_t)(0x1 << sensor_list.sl_sensors_st[sensor_index].sensor_event_bit);
 
@@ -1273,27 +1387,23 @@ sl_status_t sl_si91x_sensorhub_create_sensor(sl_sensor_id_t sensor_id)
     return SL_SH_COMMAND_SELF_TEST_FAIL;
   }
 
-  snprintf(sl_sensor_timer_name,
-           sizeof(sl_sensor_timer_name) - 1,
-           "%s%02x",
-           sensor_list.sl_sensors_st[sensor_index].config_st->sensor_name,
-           sensor_id);
-
   /*Check the sensor mode. poll/interrupt and create the timer*/
   switch (local_info->sensor_mode) {
     case SL_SH_POLLING_MODE:
-
-      sensor_list.sl_sensors_st[sensor_index].timer_handle =
-        xTimerCreate(sl_sensor_timer_name,
-                     ((sensor_list.sl_sensors_st[sensor_index].config_st->sampling_interval)),
-                     1,
-                     (void *)(sensor_list.sl_sensors_st[sensor_index].sensor_event_bit),
-                     sl_si91x_sensors_timer_cb);
-
-      if (sensor_list.sl_sensors_st[sensor_index].timer_handle == NULL) {
-        DEBUGOUT("\r\n OS timer creation Failed \r\n");
+      if (sensor_list.sl_sensors_st[sensor_index].config_st->sampling_interval == 0) {
+        DEBUGOUT("\r\n Invalid sampling interval \r\n");
         return SL_SH_TIMER_CREATION_FAILED;
       }
+
+      //!All polled sensors share one timer, so that their wake-ups can be coalesced
+      if (sl_sampling_timer == NULL) {
+        sl_sampling_timer = xTimerCreate("SH Sampling", 1, pdFALSE, NULL, sl_si91x_sensors_timer_cb);
+        if (sl_sampling_timer == NULL) {
+          DEBUGOUT("\r\n OS timer creation Failed \r\n");
+          return SL_SH_TIMER_CREATION_FAILED;
+        }
+      }
+      sensor_list.sl_sensors_st[sensor_index].sampling_armed = 0;
       break;
 
     case SL_SH_INTERRUPT_MODE:
@@ -1342,7 +1452,6 @@ sl_status_t sl_si91x_sensorhub_delete_sensor(sl_sensor_id_t sensor_id)
 {
   /*TODO: Need to verify the delete function*/
   uint32_t sensor_index;
-  osStatus_t timer_status;
   /*Delete the sensor to the sensor list*/
   sensor_index = sli_si91x_delete_sensor_list_index(sensor_id);
   if (sensor_index == SL_MAX_NUM_SENSORS) {
@@ -1353,12 +1462,15 @@ sl_status_t sl_si91x_sensorhub_delete_sensor(sl_sensor_id_t sensor_id)
   /*Check the sensor mode. poll/interrupt and create the timer*/
   switch (sensor_list.sl_sensors_st[sensor_index].config_st->sensor_mode) {
     case SL_SH_POLLING_MODE:
-      timer_status = osTimerDelete(sensor_list.sl_sensors_st[sensor_index].timer_handle); //cmsis v2 apis
-      if (timer_status != osOK) {
-        /* Post-event as SL_SENSOR_START_FAILED */
-        DEBUGOUT("\r\n osTimer Delete failed:%d \r\n", timer_status);
-        sl_si91x_em_post_event(sensor_id, SL_SENSOR_DELETE_FAILED, NULL, EM_POST_TIME);
-        return SL_SH_TIMER_DELETION_FAILED;
+      //!The shared sampling timer is kept, only stop sampling this sensor
+      if (sensor_list.sl_sensors_st[sensor_index].sampling_armed != 0) {
+        sensor_list.sl_sensors_st[sensor_index].sampling_armed = 0;
+        if (sli_si91x_sampling_reschedule() != SL_STATUS_OK) {
+          /* Post-event as SL_SENSOR_DELETE_FAILED */
+          DEBUGOUT("\r\n Sampling timer reschedule failed \r\n");
+          sl_si91x_em_post_event(sensor_id, SL_SENSOR_DELETE_FAILED, NULL, EM_POST_TIME);
+          return SL_SH_TIMER_DELETION_FAILED;
+        }
       }
       break;
 
@@ -1409,7 +1521,7 @@ sl_status_t sl_si91x_sensorhub_delete_sensor(sl_sensor_id_t sensor_id)
 sl_status_t sl_si91x_sensorhub_start_sensor(sl_sensor_id_t sensor_id)
 {
   uint32_t sensor_index, status = 0;
-  osStatus_t timer_status;
+  uint32_t interval;
   sensor_index = sli_si91x_get_sensor_index(sensor_id);
   if (sensor_index == SL_SH_SENSOR_INDEX_NOT_FOUND) {
     sl_si91x_em_post_event(sensor_id, SL_SENSOR_CREATION_FAILED, NULL, EM_POST_TIME);
@@ -1418,9 +1530,18 @@ sl_status_t sl_si91x_sensorhub_start_sensor(sl_sensor_id_t sensor_id)
 
   switch (sensor_list.sl_sensors_st[sensor_index].config_st->sensor_mode) {
     case SL_SH_POLLING_MODE:
+      //!Align the first deadline to the interval, so that sensors with harmonic intervals wake up together
+      interval = sensor_list.sl_sensors_st[sensor_index].config_st->sampling_interval;
+      if ((interval == 0) || (sl_sampling_timer == NULL)) {
+        /* Post event as SL_SENSOR_START_FAILED */
+        sl_si91x_em_post_event(sensor_id, SL_SENSOR_START_FAILED, NULL, EM_POST_TIME);
+        return SL_SH_TIMER_START_FAIL;
+      }
+      sensor_list.sl_sensors_st[sensor_index].next_sample_tick = ((xTaskGetTickCount() / interval) + 1) * interval;
+      sensor_list.sl_sensors_st[sensor_index].sampling_armed   = 1;
 
-      timer_status = xTimerStart(sensor_list.sl_sensors_st[sensor_index].timer_handle, portMAX_DELAY);
-      if (timer_status != pdPASS) {
+      if (sli_si91x_sampling_reschedule() != SL_STATUS_OK) {
+        sensor_list.sl_sensors_st[sensor_index].sampling_armed = 0;
         /* Post event as SL_SENSOR_START_FAILED */
         sl_si91x_em_post_event(sensor_id, SL_SENSOR_START_FAILED, NULL, EM_POST_TIME);
         return SL_SH_TIMER_START_FAIL;
@@ -1478,10 +1599,11 @@ sl_status_t sl_si91x_sensorhub_stop_sensor(sl_sensor_id_t sensor_id)
   }
   switch (sensor_list.sl_sensors_st[sensor_index].config_st->sensor_mode) {
     case SL_SH_POLLING_MODE:
-      status = osTimerStop(sensor_list.sl_sensors_st[sensor_index].timer_handle);
-      if (status != osOK) {
+      sensor_list.sl_sensors_st[sensor_index].sampling_armed = 0;
+      status                                                 = sli_si91x_sampling_reschedule();
+      if (status != SL_STATUS_OK) {
         /* Post event as SL_SENSOR_STOP_FAILED */
-        DEBUGOUT("\r\n osTimer stop failed:%lu \r\n", status);
+        DEBUGOUT("\r\n Sampling timer reschedule failed:%lu \r\n", status);
         sl_si91x_em_post_event(sensor_id, SL_SENSOR_STOP_FAILED, NULL, EM_POST_TIME);
         return SL_SH_TIMER_STOP_FAIL;
       }
@@ -1533,14 +1655,16 @@ void sl_si91x_em_post_event(sl_sensor_id_t sensor_id,
   em_event.event          = event;
   em_event.em_sensor_data = dataPtr;
 
-  BaseType_t mutex_result = pdFALSE;
+  osStatus_t mutex_result = osError;
   mutex_result            = osMutexAcquire(sl_event_queue_mutex, ticks_to_wait);
   if (mutex_result != osOK) {
     DEBUGOUT("\r\n osMutexAcquire failed in Sensor_Task:%u \r\n", (uint8_t)mutex_result);
   }
-  mutex_result = osMessageQueuePut(sl_event_queue_handler, &em_event, 0U, 0U);
+  if (osMessageQueuePut(sl_event_queue_handler, &em_event, 0U, 0U) != osOK) {
+    DEBUGOUT("\r\n EM queue full, event %u dropped \r\n", (uint8_t)event);
+  }
+  // Release even when the queue is full, or the next post would wait on this mutex forever
   if (mutex_result == osOK) {
-    //xSemaphoreGiveRecursive(event_queue_mutex);
     mutex_result = osMutexRelease(sl_event_queue_mutex);
 
     if (mutex_result != osOK) {
@@ -1575,7 +1699,8 @@ void sl_si91x_em_task(void)
   sl_semaphore_em_task_id = osSemaphoreNew(1U, 0U, NULL);
 
   /*Create an Event Queue*/
-  sl_event_queue_handler = osMessageQueueNew(20, sizeof(sl_em_event_t), &sl_osMessageQueueAttr); //CMSIS V2 API
+  sl_event_queue_handler =
+    osMessageQueueNew(SL_SH_EM_QUEUE_LENGTH, sizeof(sl_em_event_t), &sl_osMessageQueueAttr); //CMSIS V2 API
   if (sl_event_queue_handler == NULL) {
     DEBUGOUT("create event queue failed");
     while (1)
@@ -1706,30 +1831,16 @@ void sl_si91x_sensor_task(void)
     i = 0;
     while (event_flags) {
 
-      if ((event_flags & 0x1) == 0x1) {
+      if (((event_flags & 0x1) == 0x1) && (sensor_list.sl_sensors_st[i].ring.samples != NULL)) {
+        sli_si91x_sensor_ring_sample(&sensor_list.sl_sensors_st[i]);
+      } else if ((event_flags & 0x1) == 0x1) {
 
         if (sensor_list.sl_sensors_st[i].event_ack == CLEAR_EVENT_ACK) {
           if (sensor_list.sl_sensors_st[i].config_st->data_deliver.data_mode == SL_SH_THRESHOLD) {
             sensor_list.sl_sensors_st[i].config_st->sensor_data_ptr->number = 0;
           }
           if (sensor_list.sl_sensors_st[i].config_st->sensor_mode == SL_SH_POLLING_MODE) {
-            if ((sensor_list.sl_sensors_st[i].config_st->sensor_bus == SL_SH_I2C) && !bus_errors.i2c) {
-              sli_si91x_i2c_init();
-              bus_errors.i2c = true;
-            }
-            if ((sensor_list.sl_sensors_st[i].config_st->sensor_bus == SL_SH_SPI) && !bus_errors.spi) {
-              sli_si91x_spi_init();
-              bus_errors.spi = true;
-            }
-            if ((sensor_list.sl_sensors_st[i].config_st->sensor_bus == SL_SH_ADC) && !bus_errors.adc) {
-              sli_si91x_adc_init();
-              sl_status_t ret =
-                sl_si91x_adc_channel_init(&bus_intf_info.adc_config.adc_ch_cfg, &bus_intf_info.adc_config.adc_cfg);
-              if (ret != SL_STATUS_OK) {
-                DEBUGOUT("\r\n ADC sensor channel init failed after wakeup \r\n");
-              }
-              bus_errors.adc = true;
-            }
+            sli_si91x_sensor_bus_init(sensor_list.sl_sensors_st[i].config_st->sensor_bus);
             status =
               sensor_list.sl_sensors_st[i].sensor_impl->sample(sensor_list.sl_sensors_st[i].sensor_handle,
                                                                sensor_list.sl_sensors_st[i].config_st->sensor_data_ptr);
@@ -1837,6 +1948,331 @@ void sl_si91x_sensor_task(void)
   } //end of while(1);
 } //end of sensor task
 
+/**************************************************************************/ /**
+ *  @fn          static void sli_si91x_sensor_bus_init(sl_sensor_bus_t sensor_bus)
+ *  @brief       Initializes the bus of a polling sensor again if it was
+ *               de-initialized for sleep.
+ *  @param[in]   sensor_bus     bus of the sensor
+*******************************************************************************/
+static void sli_si91x_sensor_bus_init(sl_sensor_bus_t sensor_bus)
+{
+  if ((sensor_bus == SL_SH_I2C) && !bus_errors.i2c) {
+    sli_si91x_i2c_init();
+    bus_errors.i2c = true;
+  }
+  if ((sensor_bus == SL_SH_SPI) && !bus_errors.spi) {
+    sli_si91x_spi_init();
+    bus_errors.spi = true;
+  }
+  if ((sensor_bus == SL_SH_ADC) && !bus_errors.adc) {
+    sli_si91x_adc_init();
+    sl_status_t ret =
+      sl_si91x_adc_channel_init(&bus_intf_info.adc_config.adc_ch_cfg, &bus_intf_info.adc_config.adc_cfg);
+    if (ret != SL_STATUS_OK) {
+      DEBUGOUT("\r\n ADC sensor channel init failed after wakeup \r\n");
+    }
+    bus_errors.adc = true;
+  }
+}
+
+/**************************************************************************/ /**
+ *  @fn          static void sli_si91x_sensor_ring_sample(sl_sensor_handle_t *sensor)
+ *  @brief       Samples a sensor into its ring buffer and posts
+ *               SL_SENSOR_BATCH_READY when the watermark is reached.
+ *               Sensors that buffer samples (like IMU FIFOs) may store several
+ *               samples per call, up to the contiguous free room of the ring.
+ *               Called from the sensor task, the only producer of the ring buffer.
+ *  @param[in]   sensor     sensor to sample
+*******************************************************************************/
+static void sli_si91x_sensor_ring_sample(sl_sensor_handle_t *sensor)
+{
+  sl_sensor_ring_buffer_t *ring = &sensor->ring;
+  sl_sensor_data_group_t slot;
+  sl_em_event_t em_event;
+  uint32_t level = ring->head - ring->tail;
+  uint32_t index;
+  uint32_t room;
+  uint32_t timestamp;
+  int32_t status;
+
+  if (sensor->config_st->sensor_mode == SL_SH_POLLING_MODE) {
+    sli_si91x_sensor_bus_init(sensor->config_st->sensor_bus);
+  }
+
+  if (level >= ring->depth) {
+    // Never overwrite samples the application may be reading, drop the new one instead
+    ring->stats.dropped++;
+  } else {
+    index = ring->head & (ring->depth - 1U);
+    // The samples of one call are stored contiguously, up to the end of the ring
+    room = ring->depth - index;
+    if (room > (ring->depth - level)) {
+      room = ring->depth - level;
+    }
+    slot.number      = 0;
+    slot.max_number  = (room > UINT8_MAX) ? UINT8_MAX : (uint8_t)room;
+    slot.sensor_data = &ring->samples[index];
+    status           = sensor->sensor_impl->sample(sensor->sensor_handle, &slot);
+    if ((status == SL_STATUS_OK) && (slot.number != 0) && (slot.number <= slot.max_number)) {
+      timestamp = osKernelGetTickCount();
+      for (uint32_t n = 0; n < slot.number; n++) {
+        ring->timestamps[index + n] = timestamp;
+      }
+      // The samples must be complete before the application can see the new head
+      __DMB();
+      ring->head += slot.number;
+      level += slot.number;
+      ring->stats.produced += slot.number;
+      if (level > ring->stats.max_level) {
+        ring->stats.max_level = (uint16_t)level;
+      }
+    } else {
+      DEBUGOUT("\r\n Sensor ring sample fail:%d \r\n", sensor->config_st->sensor_id);
+    }
+  }
+
+  // Only one batch event is queued at a time, the application drains the ring buffer on it
+  if ((level >= ring->watermark) && (ring->batch_pending == 0)) {
+    ring->batch_pending     = 1;
+    em_event.sensor_id      = sensor->config_st->sensor_id;
+    em_event.event          = SL_SENSOR_BATCH_READY;
+    em_event.em_sensor_data = ring;
+    // Not serialized with the EM mutex, which is held while the application callback runs
+    if (osMessageQueuePut(sl_event_queue_handler, &em_event, 0U, 0U) == osOK) {
+      ring->stats.batches_posted++;
+    } else {
+      // Retried on the next sample
+      ring->batch_pending = 0;
+      ring->stats.post_failures++;
+    }
+  }
+
+  if (sensor->config_st->sensor_mode == SL_SH_INTERRUPT_MODE) {
+    RSI_NPSSGPIO_IntrUnMask(BIT(sensor->config_st->sampling_intr_req_pin));
+  }
+}
+
+/**************************************************************************/ /**
+ *  @fn          sl_status_t sl_si91x_sensorhub_configure_ring_buffer(sl_sensor_id_t sensor_id,
+ *                                                   uint16_t depth, uint16_t watermark)
+ *  @brief       To deliver the samples of the given sensor in batches through a ring buffer
+ *  @param[in]   sensor_id     ID of the sensor
+ *  @param[in]   depth         number of samples of the ring buffer, a power of two
+ *  @param[in]   watermark     number of buffered samples that posts SL_SENSOR_BATCH_READY
+ *  @return      status 0 if successful, else error code
+*******************************************************************************/
+sl_status_t sl_si91x_sensorhub_configure_ring_buffer(sl_sensor_id_t sensor_id, uint16_t depth, uint16_t watermark)
+{
+  sl_sensor_ring_buffer_t *ring;
+  uint32_t sensor_index;
+  uint32_t ramAllocationSize;
+
+  if ((depth == 0) || ((depth & (depth - 1U)) != 0) || (watermark == 0) || (watermark > depth)) {
+    return SL_SH_INVALID_PARAMETERS;
+  }
+  sensor_index = sli_si91x_get_sensor_index(sensor_id);
+  if (sensor_index == SL_SH_SENSOR_INDEX_NOT_FOUND) {
+    return SL_SH_SENSOR_CREATE_FAIL;
+  }
+  /* ADC sensors keep their samples in the ADC FIFO ping/pong buffers */
+  if (sensor_list.sl_sensors_st[sensor_index].config_st->sensor_bus == SL_SH_ADC) {
+    return SL_SH_INVALID_PARAMETERS;
+  }
+  ring = &sensor_list.sl_sensors_st[sensor_index].ring;
+  if ((ring->samples != NULL) || (sensor_list.sl_sensors_st[sensor_index].sensor_status == SL_SENSOR_START)) {
+    return SL_SH_RING_BUFFER_ALREADY_CONFIGURED;
+  }
+
+  ramAllocationSize = (uint32_t)depth * (sizeof(sl_sensor_data_t) + sizeof(uint32_t));
+  ramAllocationSize = (ramAllocationSize + 3U) & ~3U; //for 4 byte align and 4 byte boundary
+  if ((free_ram_index + ramAllocationSize) > sizeof(sensor_data_ram)) {
+    return SL_SH_MEMORY_LIMIT_EXCEEDED;
+  }
+
+  ring->timestamps = (uint32_t *)&sensor_data_ram[free_ram_index];
+  ring->samples    = (sl_sensor_data_t *)&sensor_data_ram[free_ram_index + (depth * sizeof(uint32_t))];
+  free_ram_index += ramAllocationSize;
+  ring->depth         = depth;
+  ring->watermark     = watermark;
+  ring->head          = 0;
+  ring->tail          = 0;
+  ring->batch_pending = 0;
+  memset(&ring->stats, 0, sizeof(ring->stats));
+
+  return SL_STATUS_OK;
+}
+
+/**************************************************************************/ /**
+ *  @fn          static sl_sensor_ring_buffer_t *sli_si91x_get_ring_buffer(sl_sensor_id_t sensor_id,
+ *                                                   sl_status_t *status)
+ *  @brief       To get the ring buffer of the given sensor
+ *  @param[in]   sensor_id     ID of the sensor
+ *  @param[out]  status        error code if there is no ring buffer
+ *  @return      ring buffer of the sensor, NULL if there is none
+*******************************************************************************/
+static sl_sensor_ring_buffer_t *sli_si91x_get_ring_buffer(sl_sensor_id_t sensor_id, sl_status_t *status)
+{
+  uint32_t sensor_index = sli_si91x_get_sensor_index(sensor_id);
+
+  if (sensor_index == SL_SH_SENSOR_INDEX_NOT_FOUND) {
+    *status = SL_SH_SENSOR_CREATE_FAIL;
+    return NULL;
+  }
+  if (sensor_list.sl_sensors_st[sensor_index].ring.samples == NULL) {
+    *status = SL_SH_RING_BUFFER_NOT_CONFIGURED;
+    return NULL;
+  }
+  *status = SL_STATUS_OK;
+  return &sensor_list.sl_sensors_st[sensor_index].ring;
+}
+
+/**************************************************************************/ /**
+ *  @fn          sl_status_t sl_si91x_sensorhub_ring_buffer_peek(sl_sensor_id_t sensor_id,
+ *               sl_sensor_data_t **samples, const uint32_t **timestamps, uint16_t *count)
+ *  @brief       To get the oldest contiguous samples of the given sensor without copying them
+ *  @param[in]   sensor_id     ID of the sensor
+ *  @param[out]  samples       first sample
+ *  @param[out]  timestamps    tick count of the first sample, may be NULL
+ *  @param[out]  count         number of samples
+ *  @return      status 0 if successful, else error code
+*******************************************************************************/
+sl_status_t sl_si91x_sensorhub_ring_buffer_peek(sl_sensor_id_t sensor_id,
+                                                sl_sensor_data_t **samples,
+                                                const uint32_t **timestamps,
+                                                uint16_t *count)
+{
+  sl_sensor_ring_buffer_t *ring;
+  sl_status_t status;
+  uint32_t level;
+  uint32_t index;
+  uint32_t contiguous;
+
+  if ((samples == NULL) || (count == NULL)) {
+    return SL_SH_INVALID_PARAMETERS;
+  }
+  ring = sli_si91x_get_ring_buffer(sensor_id, &status);
+  if (ring == NULL) {
+    return status;
+  }
+
+  level = ring->head - ring->tail;
+  // Read the samples only after the head that publishes them
+  __DMB();
+  if (level == 0) {
+    *count = 0;
+    return SL_STATUS_EMPTY;
+  }
+  index      = ring->tail & (ring->depth - 1U);
+  contiguous = ring->depth - index;
+  *samples   = &ring->samples[index];
+  *count     = (uint16_t)((level < contiguous) ? level : contiguous);
+  if (timestamps != NULL) {
+    *timestamps = &ring->timestamps[index];
+  }
+
+  return SL_STATUS_OK;
+}
+
+/**************************************************************************/ /**
+ *  @fn          sl_status_t sl_si91x_sensorhub_ring_buffer_release(sl_sensor_id_t sensor_id,
+ *                                                   uint16_t count)
+ *  @brief       To release the oldest samples of the given sensor
+ *  @param[in]   sensor_id     ID of the sensor
+ *  @param[in]   count         number of samples to release
+ *  @return      status 0 if successful, else error code
+*******************************************************************************/
+sl_status_t sl_si91x_sensorhub_ring_buffer_release(sl_sensor_id_t sensor_id, uint16_t count)
+{
+  sl_sensor_ring_buffer_t *ring;
+  sl_status_t status;
+  uint32_t latency;
+
+  ring = sli_si91x_get_ring_buffer(sensor_id, &status);
+  if (ring == NULL) {
+    return status;
+  }
+  if (count > (ring->head - ring->tail)) {
+    return SL_SH_INVALID_PARAMETERS;
+  }
+  if (count == 0) {
+    return SL_STATUS_OK;
+  }
+
+  // The oldest sample released waited the longest
+  latency = osKernelGetTickCount() - ring->timestamps[ring->tail & (ring->depth - 1U)];
+  if (latency > ring->stats.max_latency) {
+    ring->stats.max_latency = latency;
+  }
+  ring->stats.consumed += count;
+  // Done reading the samples before the sensor task may overwrite them
+  __DMB();
+  ring->tail += count;
+  ring->batch_pending = 0;
+
+  return SL_STATUS_OK;
+}
+
+/**************************************************************************/ /**
+ *  @fn          sl_status_t sl_si91x_sensorhub_get_ring_buffer_stats(sl_sensor_id_t sensor_id,
+ *                                                   sl_sensor_ring_stats_t *stats)
+ *  @brief       To get the back-pressure statistics of the ring buffer of the given sensor
+ *  @param[in]   sensor_id     ID of the sensor
+ *  @param[out]  stats         statistics of the ring buffer
+ *  @return      status 0 if successful, else error code
+*******************************************************************************/
+sl_status_t sl_si91x_sensorhub_get_ring_buffer_stats(sl_sensor_id_t sensor_id, sl_sensor_ring_stats_t *stats)
+{
+  sl_sensor_ring_buffer_t *ring;
+  sl_status_t status;
+
+  if (stats == NULL) {
+    return SL_SH_INVALID_PARAMETERS;
+  }
+  ring = sli_si91x_get_ring_buffer(sensor_id, &status);
+  if (ring == NULL) {
+    return status;
+  }
+  *stats = ring->stats;
+
+  return SL_STATUS_OK;
+}
+
+/**************************************************************************/ /**
+ *  @fn          sl_status_t sl_si91x_sensorhub_get_sampling_stats(sl_sensor_sampling_stats_t *stats)
+ *  @brief       To get the statistics of the shared sampling timer of the polled sensors
+ *  @param[out]  stats         statistics of the sampling timer
+ *  @return      status 0 if successful, else error code
+*******************************************************************************/
+sl_status_t sl_si91x_sensorhub_get_sampling_stats(sl_sensor_sampling_stats_t *stats)
+{
+  if (stats == NULL) {
+    return SL_SH_INVALID_PARAMETERS;
+  }
+  // Updated by the timer service task, copy a consistent snapshot
+  taskENTER_CRITICAL();
+  *stats = sl_sampling_stats;
+  taskEXIT_CRITICAL();
+
+  return SL_STATUS_OK;
+}
+
+/**************************************************************************/ /**
+ *  @fn          uint32_t sl_si91x_sensorhub_get_next_sampling_delay(void)
+ *  @brief       To get the time until the next wake-up of the shared sampling timer
+ *  @return      ticks until the next wake-up, or osWaitForever if the timer is not armed
+*******************************************************************************/
+uint32_t sl_si91x_sensorhub_get_next_sampling_delay(void)
+{
+  int32_t remaining;
+
+  if (sl_sampling_timer_armed == 0) {
+    return osWaitForever;
+  }
+  remaining = (int32_t)(sl_sampling_wakeup_tick - xTaskGetTickCount());
+
+  return (remaining > 0) ? (uint32_t)remaining : 0;
+}
+
 /**************************************************************************/ /**
 * @fn       void mySPI_callback(uint32_t event)
 * @brief  SPI callback handler
@@ -34,6 +34,12 @@ void test_sensor_event_handler(uint8_t sensor_id, uint8_t event); // application
 
 sl_sensor_id_t test_sensor_scan_info[SL_MAX_NUM_SENSORS];
 static uint32_t test_sensor_scan_cnt = 0; // Sensor scan count
+// Only this sensor delivers through a ring buffer, the others keep their configured delivery mode
+static uint32_t test_ring_sensor_index = SL_MAX_NUM_SENSORS;
+
+#define TEST_RING_DEPTH     16 // Ring buffer depth of the dedicated sensor
+#define TEST_RING_WATERMARK 4  // Ring buffer watermark of the dedicated sensor
+#define TEST_RING_WAIT_MS   5000
 
 /*******************************************************************************
  ************************  Test Function Prototypes  ****************************
@@ -46,6 +52,9 @@ void test_sensorhub_start_sensor(void);
 void test_sensorhub_stop_sensor(void);
 void test_sensorhub_notify_cb_register(void);
 void test_sensor_hub_start(void);
+void test_sensorhub_ring_buffer(void);
+void test_sensorhub_sampling_timer(void);
+void test_sensorhub_ring_buffer_delivery(void);
 
 /******************************************************************************
  * Main function in which all the test cases are tested using unity framework
@@ -58,8 +67,11 @@ int main()
   RUN_TEST(test_sensor_hub_init, __LINE__);
   RUN_TEST(test_sensorhub_detect_sensors, __LINE__);
   RUN_TEST(test_sensorhub_create_sensor, __LINE__);
+  RUN_TEST(test_sensorhub_ring_buffer, __LINE__);
   RUN_TEST(test_sensor_hub_start, __LINE__);
   RUN_TEST(test_sensorhub_start_sensor, __LINE__);
+  RUN_TEST(test_sensorhub_sampling_timer, __LINE__);
+  RUN_TEST(test_sensorhub_ring_buffer_delivery, __LINE__);
   RUN_TEST(test_sensorhub_delete_sensor, __LINE__);
   RUN_TEST(test_sensorhub_stop_sensor, __LINE__);
 
@@ -120,6 +132,68 @@ void test_sensorhub_create_sensor(void)
   UnityPrintf("Sensor Hub create sensor test completed \n");
 }
 
+/*******************************************************************************
+ * Function to test the ring buffer of the Sensor Hub sensors
+ ******************************************************************************/
+void test_sensorhub_ring_buffer(void)
+{
+  UnityPrintf("\n");
+  UnityPrintf("Testing Sensor Hub ring buffer  \n");
+  sl_status_t status;
+  sl_sensor_data_t *samples;
+  const uint32_t *timestamps;
+  uint16_t count;
+  sl_sensor_ring_stats_t stats;
+
+  UnityPrintf("Testing with invalid depth and watermark \n");
+  status = sl_si91x_sensorhub_configure_ring_buffer(test_sensor_scan_info[0], 12, 4);
+  TEST_ASSERT_EQUAL_HEX(SL_SH_INVALID_PARAMETERS, status);
+  status = sl_si91x_sensorhub_configure_ring_buffer(test_sensor_scan_info[0], 16, 17);
+  TEST_ASSERT_EQUAL_HEX(SL_SH_INVALID_PARAMETERS, status);
+  status = sl_si91x_sensorhub_configure_ring_buffer(test_sensor_scan_info[0], 16, 0);
+  TEST_ASSERT_EQUAL_HEX(SL_SH_INVALID_PARAMETERS, status);
+  UnityPrintf("Testing with invalid depth and watermark successfully\n");
+
+  UnityPrintf("Testing with null parameters \n");
+  status = sl_si91x_sensorhub_ring_buffer_peek(test_sensor_scan_info[0], NULL, &timestamps, &count);
+  TEST_ASSERT_EQUAL_HEX(SL_SH_INVALID_PARAMETERS, status);
+  status = sl_si91x_sensorhub_get_ring_buffer_stats(test_sensor_scan_info[0], NULL);
+  TEST_ASSERT_EQUAL_HEX(SL_SH_INVALID_PARAMETERS, status);
+  UnityPrintf("Testing with null parameters successfully\n");
+
+  UnityPrintf("Testing with correct parameters \n");
+  for (uint32_t i = 0; i < test_sensor_scan_cnt; i++) {
+    status = sl_si91x_sensorhub_configure_ring_buffer(test_sensor_scan_info[i], TEST_RING_DEPTH, TEST_RING_WATERMARK);
+    if (status == SL_SH_INVALID_PARAMETERS) {
+      // ADC sensors do not support ring buffers
+      continue;
+    }
+    TEST_ASSERT_EQUAL_HEX(SL_STATUS_OK, status);
+    test_ring_sensor_index = i;
+    break;
+  }
+  if (test_ring_sensor_index == SL_MAX_NUM_SENSORS) {
+    UnityPrintf("No sensor supports a ring buffer, skipped \n");
+    return;
+  }
+
+  sl_sensor_id_t sensor_id = test_sensor_scan_info[test_ring_sensor_index];
+  status                   = sl_si91x_sensorhub_configure_ring_buffer(sensor_id, TEST_RING_DEPTH, TEST_RING_WATERMARK);
+  TEST_ASSERT_EQUAL_HEX(SL_SH_RING_BUFFER_ALREADY_CONFIGURED, status);
+  status = sl_si91x_sensorhub_ring_buffer_peek(sensor_id, &samples, &timestamps, &count);
+  TEST_ASSERT_EQUAL_HEX(SL_STATUS_EMPTY, status);
+  TEST_ASSERT_EQUAL_UINT16(0, count);
+  status = sl_si91x_sensorhub_ring_buffer_release(sensor_id, 1);
+  TEST_ASSERT_EQUAL_HEX(SL_SH_INVALID_PARAMETERS, status);
+  status = sl_si91x_sensorhub_get_ring_buffer_stats(sensor_id, &stats);
+  TEST_ASSERT_EQUAL_HEX(SL_STATUS_OK, status);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.produced);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.dropped);
+  UnityPrintf("Status of API is correct, Sensor Hub ring buffer configured successfully \n");
+
+  UnityPrintf("Sensor Hub ring buffer test completed \n");
+}
+
 /*******************************************************************************
  * Function to test start Sensor Hub
  ******************************************************************************/
@@ -183,6 +257,98 @@ void test_sensorhub_start_sensor(void)
   UnityPrintf("Sensor Hub start sensor test completed \n");
 }
 
+/*******************************************************************************
+ * Function to test the shared sampling timer of the polled sensors
+ ******************************************************************************/
+void test_sensorhub_sampling_timer(void)
+{
+  UnityPrintf("\n");
+  UnityPrintf("Testing Sensor Hub sampling timer  \n");
+  sl_status_t status;
+  sl_sensor_sampling_stats_t stats;
+
+  UnityPrintf("Testing with null parameters \n");
+  status = sl_si91x_sensorhub_get_sampling_stats(NULL);
+  TEST_ASSERT_EQUAL_HEX(SL_SH_INVALID_PARAMETERS, status);
+  UnityPrintf("Testing with null parameters successfully\n");
+
+  UnityPrintf("Testing with correct parameters \n");
+  // Let the started sensors be sampled for a while
+  osDelay(1000);
+  status = sl_si91x_sensorhub_get_sampling_stats(&stats);
+  TEST_ASSERT_EQUAL_HEX(SL_STATUS_OK, status);
+  TEST_ASSERT_TRUE(stats.wakeups <= stats.samples);
+  TEST_ASSERT_TRUE(stats.coalesced <= stats.samples);
+  TEST_ASSERT_TRUE(stats.max_early <= SL_SH_SAMPLING_SLACK);
+  if (stats.samples > 0) {
+    TEST_ASSERT_TRUE(sl_si91x_sensorhub_get_next_sampling_delay() != osWaitForever);
+  }
+  UnityPrintf("Status of API is correct, Sensor Hub sampling timer statistics read successfully \n");
+
+  UnityPrintf("Sensor Hub sampling timer test completed \n");
+}
+
+/*******************************************************************************
+ * Function to test that the started sensor with the ring buffer produces samples
+ * and that the application consumes them
+ ******************************************************************************/
+void test_sensorhub_ring_buffer_delivery(void)
+{
+  UnityPrintf("\n");
+  UnityPrintf("Testing Sensor Hub ring buffer delivery  \n");
+  sl_status_t status;
+  sl_sensor_data_t *samples;
+  const uint32_t *timestamps;
+  uint16_t count;
+  uint32_t released = 0;
+  sl_sensor_ring_stats_t stats;
+
+  if (test_ring_sensor_index == SL_MAX_NUM_SENSORS) {
+    UnityPrintf("No sensor with a ring buffer, skipped \n");
+    return;
+  }
+  sl_sensor_id_t sensor_id = test_sensor_scan_info[test_ring_sensor_index];
+
+  UnityPrintf("Testing with correct parameters \n");
+  // Wait for the sensor task to produce at least the watermark
+  for (uint32_t waited = 0; waited < TEST_RING_WAIT_MS; waited += 100) {
+    status = sl_si91x_sensorhub_get_ring_buffer_stats(sensor_id, &stats);
+    TEST_ASSERT_EQUAL_HEX(SL_STATUS_OK, status);
+    if (stats.produced >= TEST_RING_WATERMARK) {
+      break;
+    }
+    osDelay(100);
+  }
+  TEST_ASSERT_TRUE(stats.produced >= TEST_RING_WATERMARK);
+  TEST_ASSERT_TRUE(stats.max_level <= TEST_RING_DEPTH);
+
+  // Consume everything buffered, a wrap around takes two peeks
+  while (sl_si91x_sensorhub_ring_buffer_peek(sensor_id, &samples, &timestamps, &count) == SL_STATUS_OK) {
+    TEST_ASSERT_TRUE((count > 0) && (count <= TEST_RING_DEPTH));
+    TEST_ASSERT_NOT_NULL(samples);
+    for (uint16_t i = 1; i < count; i++) {
+      TEST_ASSERT_TRUE((int32_t)(timestamps[i] - timestamps[i - 1]) >= 0);
+    }
+    status = sl_si91x_sensorhub_ring_buffer_release(sensor_id, count);
+    TEST_ASSERT_EQUAL_HEX(SL_STATUS_OK, status);
+    released += count;
+    if (released >= stats.produced) {
+      break;
+    }
+  }
+  TEST_ASSERT_TRUE(released > 0);
+
+  status = sl_si91x_sensorhub_get_ring_buffer_stats(sensor_id, &stats);
+  TEST_ASSERT_EQUAL_HEX(SL_STATUS_OK, status);
+  TEST_ASSERT_EQUAL_UINT32(released, stats.consumed);
+  TEST_ASSERT_TRUE((stats.produced - stats.consumed) <= TEST_RING_DEPTH);
+  status = sl_si91x_sensorhub_ring_buffer_release(sensor_id, TEST_RING_DEPTH + 1);
+  TEST_ASSERT_EQUAL_HEX(SL_SH_INVALID_PARAMETERS, status);
+  UnityPrintf("Status of API is correct, Sensor Hub ring buffer samples consumed successfully \n");
+
+  UnityPrintf("Sensor Hub ring buffer delivery test completed \n");
+}
+
 /*******************************************************************************
  * Function to test delete sensor to Sensor Hub
  ******************************************************************************/
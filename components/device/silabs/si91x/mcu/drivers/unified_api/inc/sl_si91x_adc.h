@@ -175,6 +175,42 @@ typedef struct {
   uint8_t minor;   ///< Minor version number
 } sl_adc_version_t;
 
+/**
+ * @brief Structure describing a half-buffer of samples handed out by an ADC stream.
+ */
+typedef struct {
+  int16_t *samples;  ///< Processed samples, in place in the ping or pong buffer of the channel.
+  uint16_t count;    ///< Number of samples, the half-buffer length divided by the decimation factor.
+  uint32_t sequence; ///< Number of the half-buffer since the stream started, gaps show overruns.
+} sl_adc_stream_block_t;
+
+/**
+ * @brief Structure to hold the statistics of an ADC stream channel.
+ */
+typedef struct {
+  uint32_t blocks;   ///< Half-buffers filled by the internal DMA.
+  uint32_t overruns; ///< Half-buffers refilled by the ADC before the application released them.
+} sl_adc_stream_stats_t;
+
+/***************************************************************************/
+/**
+ * @brief Typedef for a user-provided callback function that is invoked from the ADC interrupt
+ * each time a streamed channel completes a half-buffer.
+ * 
+ * @param[in] channel ADC channel number @ref sl_adc_channel_id_t.
+ * @param[in] block   Half-buffer that was completed, see \ref sl_adc_stream_block_t.
+ ******************************************************************************/
+typedef void (*sl_adc_stream_callback_t)(uint8_t channel, const sl_adc_stream_block_t *block);
+
+/**
+ * @brief Structure to hold the ADC stream configuration parameters.
+ */
+typedef struct {
+  uint16_t channel_mask;             ///< Streamed channels, bit n for channel n.
+  uint8_t decimation;                ///< Number of consecutive samples averaged into one, 1 disables averaging.
+  sl_adc_stream_callback_t callback; ///< Called from the ADC interrupt for each completed half-buffer, can be NULL.
+} sl_adc_stream_config_t;
+
 // -----------------------------------------------------------------------------
 // Prototypes
 
@@ -818,6 +854,130 @@ sl_status_t sl_si91x_adc_start(sl_adc_config_t adc_config);
  ******************************************************************************/
 sl_status_t sl_si91x_adc_stop(sl_adc_config_t adc_config);
 
+/***************************************************************************/
+/**
+ * @brief To start streaming the ADC channels continuously through their ping-pong buffers.
+ * 
+ * @details This API starts the ADC in FIFO mode and keeps the internal DMA running on the ping and pong
+ * buffers of the given channels, until \ref sl_si91x_adc_stream_stop is called.
+ * Each time a half-buffer is filled, the ADC interrupt converts its samples in place, averaging
+ * every `decimation` samples into one, and hands it out without copying:
+ *  - through the stream callback, from the interrupt, and
+ *  - through \ref sl_si91x_adc_stream_get_block, from a task.
+ * 
+ * The ADC refills a half-buffer once the other one is full, so a half-buffer must be released
+ * within the time it takes to fill the other one (sample length / sampling rate). Otherwise it is
+ * counted as an overrun in \ref sl_adc_stream_stats_t.
+ * 
+ * @pre Pre-conditions:
+ *  - \ref sl_si91x_adc_configure_clock
+ *  - \ref sl_si91x_adc_init
+ *  - \ref sl_si91x_adc_set_channel_configuration
+ * 
+ * @param[in] adc_channel_config ADC channels configuration structure variable, see \ref sl_adc_channel_config_t.
+ * @param[in] adc_config ADC operation configuration structure variable, see \ref sl_adc_config_t.
+ * @param[in] stream_config Pointer to the stream configuration, see \ref sl_adc_stream_config_t.
+ * 
+ * @return sl_status_t Status code indicating the result:
+ *         - SL_STATUS_OK                 - Successfully started the stream.
+ *         - SL_STATUS_NULL_POINTER       - The parameter is a null pointer.
+ *         - SL_STATUS_INVALID_PARAMETER  - Parameters are invalid, or a sample length is not a multiple of the decimation.
+ *         - SL_STATUS_INVALID_MODE       - The ADC is not configured in FIFO mode.
+ *         - SL_STATUS_BUSY               - A stream is already running.
+ * 
+ * For more information on status codes, see [SL STATUS DOCUMENTATION](
+ * https://docs.silabs.com/gecko-platform/latest/platform-common/status).
+ * 
+ * @note The samples are converted in the ADC interrupt, so large half-buffers at high sampling rates
+ * should use decimation to keep the interrupt short.
+ ******************************************************************************/
+sl_status_t sl_si91x_adc_stream_start(sl_adc_channel_config_t adc_channel_config,
+                                      sl_adc_config_t adc_config,
+                                      const sl_adc_stream_config_t *stream_config);
+
+/***************************************************************************/
+/**
+ * @brief To stop the ADC stream.
+ * 
+ * @details This API stops the ADC and drops the half-buffers that were not taken.
+ * 
+ * @pre Pre-condition:
+ *  - \ref sl_si91x_adc_stream_start
+ * 
+ * @param[in] adc_config ADC operation configuration structure variable, see \ref sl_adc_config_t.
+ * 
+ * @return sl_status_t Status code indicating the result:
+ *         - SL_STATUS_OK                 - Successfully stopped the stream.
+ *         - SL_STATUS_INVALID_PARAMETER  - Parameters are invalid.
+ *         - SL_STATUS_NOT_INITIALIZED    - No stream is running.
+ * 
+ * For more information on status codes, see [SL STATUS DOCUMENTATION](
+ * https://docs.silabs.com/gecko-platform/latest/platform-common/status).
+ ******************************************************************************/
+sl_status_t sl_si91x_adc_stream_stop(sl_adc_config_t adc_config);
+
+/***************************************************************************/
+/**
+ * @brief To take the last completed half-buffer of a streamed channel.
+ * 
+ * @details This API hands out the last half-buffer completed by the channel, without copying it.
+ * The half-buffer belongs to the application until \ref sl_si91x_adc_stream_release_block is called.
+ * 
+ * @pre Pre-condition:
+ *  - \ref sl_si91x_adc_stream_start
+ * 
+ * @param[in] channel_num Channel number.
+ * @param[out] block Pointer to the half-buffer description, see \ref sl_adc_stream_block_t.
+ * 
+ * @return sl_status_t Status code indicating the result:
+ *         - SL_STATUS_OK                 - Successfully took a half-buffer.
+ *         - SL_STATUS_NULL_POINTER       - The parameter is a null pointer.
+ *         - SL_STATUS_INVALID_PARAMETER  - The channel is not streamed.
+ *         - SL_STATUS_EMPTY              - No new half-buffer was completed.
+ *         - SL_STATUS_BUSY               - The previous half-buffer was not released.
+ * 
+ * For more information on status codes, see [SL STATUS DOCUMENTATION](
+ * https://docs.silabs.com/gecko-platform/latest/platform-common/status).
+ ******************************************************************************/
+sl_status_t sl_si91x_adc_stream_get_block(uint8_t channel_num, sl_adc_stream_block_t *block);
+
+/***************************************************************************/
+/**
+ * @brief To give a half-buffer taken with \ref sl_si91x_adc_stream_get_block back to the ADC.
+ * 
+ * @pre Pre-condition:
+ *  - \ref sl_si91x_adc_stream_get_block
+ * 
+ * @param[in] channel_num Channel number.
+ * 
+ * @return sl_status_t Status code indicating the result:
+ *         - SL_STATUS_OK                 - Successfully released the half-buffer.
+ *         - SL_STATUS_INVALID_PARAMETER  - The channel is not streamed.
+ *         - SL_STATUS_INVALID_STATE      - No half-buffer is taken.
+ *         - SL_STATUS_ABORT              - The ADC refilled the half-buffer while it was taken, its content is not valid.
+ * 
+ * For more information on status codes, see [SL STATUS DOCUMENTATION](
+ * https://docs.silabs.com/gecko-platform/latest/platform-common/status).
+ ******************************************************************************/
+sl_status_t sl_si91x_adc_stream_release_block(uint8_t channel_num);
+
+/***************************************************************************/
+/**
+ * @brief To get the statistics of a streamed channel.
+ * 
+ * @param[in] channel_num Channel number.
+ * @param[out] stats Pointer to the statistics, see \ref sl_adc_stream_stats_t.
+ * 
+ * @return sl_status_t Status code indicating the result:
+ *         - SL_STATUS_OK                 - Successfully read the statistics.
+ *         - SL_STATUS_NULL_POINTER       - The parameter is a null pointer.
+ *         - SL_STATUS_INVALID_PARAMETER  - Parameters are invalid.
+ * 
+ * For more information on status codes, see [SL STATUS DOCUMENTATION](
+ * https://docs.silabs.com/gecko-platform/latest/platform-common/status).
+ ******************************************************************************/
+sl_status_t sl_si91x_adc_stream_get_stats(uint8_t channel_num, sl_adc_stream_stats_t *stats);
+
 /***************************************************************************/
 /**
  * @brief To get the ADC version.
@@ -889,6 +1049,10 @@ float sl_si91x_adc_get_chip_voltage(void);
  * 6. **Read Data**: @ref sl_si91x_adc_read_data
  * 7. **Deinitialize ADC**: @ref sl_si91x_adc_deinit
  *
+ * To sample continuously, start the ADC with @ref sl_si91x_adc_stream_start instead of steps 4 to 6. The ping and pong buffers of
+ * each streamed channel are then handed out in turn with @ref sl_si91x_adc_stream_get_block and @ref sl_si91x_adc_stream_release_block,
+ * or through the stream callback, without copying. Stop the stream with @ref sl_si91x_adc_stream_stop.
+ *
  * @} (end addtogroup ADC)
  */
 
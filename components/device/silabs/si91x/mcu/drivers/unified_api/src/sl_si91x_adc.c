@@ -68,12 +68,39 @@
 #define ADC_RELEASE_VERSION       0          // ADC Release version
 #define ADC_SQA_VERSION           0          // ADC SQA version
 #define ADC_DEV_VERSION           1          // ADC Developer version
+#define ADC_STREAM_PING           0          // Ping half-buffer of a streamed channel
+#define ADC_STREAM_PONG           1          // Pong half-buffer of a streamed channel
+#define ADC_STREAM_NO_BLOCK       0xFF       // No half-buffer
+#define ADC_CONVERTED_MAX_VALUE   4095       // Maximum converted sample value
+#define ADC_CONVERTED_MID_VALUE   2048       // Converted sample value of a zero input
+
+/*******************************************************************************
+ ***************************  LOCAL TYPES   ************************************
+ ******************************************************************************/
+typedef struct {
+  int16_t *half[2];              // Ping and pong sample buffers
+  uint16_t length;               // Samples per half-buffer
+  uint16_t count;                // Samples in the last completed half-buffer, after decimation
+  uint8_t input_type;            // Single ended or differential input
+  volatile uint8_t ready;        // Completed half-buffer not taken yet
+  volatile uint8_t held;         // Half-buffer taken by the application
+  volatile uint8_t held_overrun; // Set when the ADC refilled the taken half-buffer
+  uint32_t sequence;             // Half-buffers completed since the stream started
+  sl_adc_stream_stats_t stats;   // Statistics of the channel
+} adc_stream_channel_t;
 
 /*******************************************************************************
  *************************** LOCAL VARIABLES   *******************************
  ******************************************************************************/
 static sl_adc_callback_t user_callback = NULL;
 static uint8_t num_of_channels_enabled;
+static adc_stream_channel_t adc_stream[MAXIMUM_CHANNEL_ID];
+static volatile uint16_t adc_stream_channels        = 0;
+static uint8_t adc_stream_decimation                = 1;
+static sl_adc_stream_callback_t adc_stream_callback = NULL;
+// Calibration and ping/pong selection of the ADC peripheral driver
+extern adc_commn_config_t adc_commn_config;
+extern uint8_t pong_enable_sel[];
 /*******************************************************************************
  *********************   LOCAL FUNCTION PROTOTYPES   ***************************
  ******************************************************************************/
@@ -85,6 +112,8 @@ static sl_status_t validate_adc_internal_parameters(const sl_adc_internal_config
 static sl_status_t sl_si91x_adc_channel_interrupt_clear(sl_adc_config_t adc_config, uint8_t channel_num);
 static sl_status_t sl_si91x_adc_configure_reference_voltage(float vref_value, float chip_voltage);
 static void callback_event_handler(uint8_t channel_no, uint8_t event);
+static void adc_stream_complete_block(uint8_t channel_no);
+static uint16_t adc_stream_convert_block(int16_t *samples, uint16_t length, uint8_t decimation, uint8_t input_type);
 
 /*******************************************************************************
  * To get the driver version
@@ -866,11 +895,195 @@ sl_status_t sl_si91x_adc_deinit(sl_adc_config_t adc_config)
     error_status = ADC_Deinit(adc_config);
     status       = convert_rsi_to_sl_error_code(error_status);
   }
-  // NULL the user callback function.
-  user_callback = NULL;
+  // NULL the user callback function and drop the stream.
+  user_callback       = NULL;
+  adc_stream_channels = 0;
+  return status;
+}
+
+/*******************************************************************************
+ * To start streaming the ADC channels.
+ * It records the ping and pong buffers of each streamed channel, at the
+ * addresses RSI_ADC_ReadData() reads them from, and starts the ADC.
+ * From then on, the ADC interrupt converts each completed half-buffer in place
+ * and hands it out, see adc_stream_complete_block().
+ ******************************************************************************/
+sl_status_t sl_si91x_adc_stream_start(sl_adc_channel_config_t adc_channel_config,
+                                      sl_adc_config_t adc_config,
+                                      const sl_adc_stream_config_t *stream_config)
+{
+  sl_status_t status;
+
+  if (stream_config == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+  if (adc_stream_channels != 0) {
+    return SL_STATUS_BUSY;
+  }
+  if (adc_config.operation_mode != SL_ADC_FIFO_MODE) {
+    return SL_STATUS_INVALID_MODE;
+  }
+  status = validate_adc_parameters(&adc_config);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+  status = validate_adc_channel_parameters(&adc_channel_config);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+  if ((stream_config->channel_mask == 0) || (stream_config->decimation == 0)) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  // Decimation averages whole groups of samples, it must divide the sample length of every channel
+  for (uint8_t ch_num = 0; ch_num < MAXIMUM_CHANNEL_ID; ch_num++) {
+    if ((stream_config->channel_mask & BIT(ch_num))
+        && ((adc_channel_config.num_of_samples[ch_num] < MINIMUM_SAMPLING_LENGTH)
+            || ((adc_channel_config.num_of_samples[ch_num] % stream_config->decimation) != 0))) {
+      return SL_STATUS_INVALID_PARAMETER;
+    }
+  }
+
+  for (uint8_t ch_num = 0; ch_num < MAXIMUM_CHANNEL_ID; ch_num++) {
+    adc_stream_channel_t *stream = &adc_stream[ch_num];
+
+    if (!(stream_config->channel_mask & BIT(ch_num))) {
+      continue;
+    }
+    stream->half[ADC_STREAM_PING] = (int16_t *)adc_channel_config.chnl_ping_address[ch_num];
+    stream->half[ADC_STREAM_PONG] =
+      (int16_t *)(adc_channel_config.chnl_pong_address[ch_num] + adc_channel_config.num_of_samples[ch_num]);
+    stream->length         = adc_channel_config.num_of_samples[ch_num];
+    stream->count          = 0;
+    stream->input_type     = adc_channel_config.input_type[ch_num];
+    stream->ready          = ADC_STREAM_NO_BLOCK;
+    stream->held           = ADC_STREAM_NO_BLOCK;
+    stream->held_overrun   = 0;
+    stream->sequence       = 0;
+    stream->stats.blocks   = 0;
+    stream->stats.overruns = 0;
+  }
+  adc_stream_decimation = stream_config->decimation;
+  adc_stream_callback   = stream_config->callback;
+  adc_stream_channels   = stream_config->channel_mask;
+
+  status = sl_si91x_adc_start(adc_config);
+  if (status != SL_STATUS_OK) {
+    adc_stream_channels = 0;
+  }
+  return status;
+}
+
+/*******************************************************************************
+ * To stop the ADC stream.
+ * The ADC is stopped before the stream state is cleared, so that the
+ * interrupt does not complete a half-buffer of a channel being stopped.
+ ******************************************************************************/
+sl_status_t sl_si91x_adc_stream_stop(sl_adc_config_t adc_config)
+{
+  sl_status_t status;
+
+  if (adc_stream_channels == 0) {
+    return SL_STATUS_NOT_INITIALIZED;
+  }
+  status = sl_si91x_adc_stop(adc_config);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+  adc_stream_channels = 0;
+  adc_stream_callback = NULL;
+
+  return SL_STATUS_OK;
+}
+
+/*******************************************************************************
+ * To take the last completed half-buffer of a streamed channel.
+ * The state is shared with the ADC interrupt, so it is updated with
+ * interrupts disabled.
+ ******************************************************************************/
+sl_status_t sl_si91x_adc_stream_get_block(uint8_t channel_num, sl_adc_stream_block_t *block)
+{
+  adc_stream_channel_t *stream;
+  sl_status_t status = SL_STATUS_OK;
+  uint32_t primask;
+
+  if (block == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+  if ((channel_num >= MAXIMUM_CHANNEL_ID) || !(adc_stream_channels & BIT(channel_num))) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  stream = &adc_stream[channel_num];
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (stream->held != ADC_STREAM_NO_BLOCK) {
+    status = SL_STATUS_BUSY;
+  } else if (stream->ready == ADC_STREAM_NO_BLOCK) {
+    status = SL_STATUS_EMPTY;
+  } else {
+    block->samples       = stream->half[stream->ready];
+    block->count         = stream->count;
+    block->sequence      = stream->sequence;
+    stream->held         = stream->ready;
+    stream->held_overrun = 0;
+    stream->ready        = ADC_STREAM_NO_BLOCK;
+  }
+  __set_PRIMASK(primask);
+
   return status;
 }
 
+/*******************************************************************************
+ * To release the half-buffer taken with sl_si91x_adc_stream_get_block().
+ * Returns SL_STATUS_ABORT if the ADC refilled it in the meantime.
+ ******************************************************************************/
+sl_status_t sl_si91x_adc_stream_release_block(uint8_t channel_num)
+{
+  adc_stream_channel_t *stream;
+  sl_status_t status = SL_STATUS_OK;
+  uint32_t primask;
+
+  if ((channel_num >= MAXIMUM_CHANNEL_ID) || !(adc_stream_channels & BIT(channel_num))) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  stream = &adc_stream[channel_num];
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (stream->held_overrun) {
+    stream->held_overrun = 0;
+    status               = SL_STATUS_ABORT;
+  } else if (stream->held == ADC_STREAM_NO_BLOCK) {
+    status = SL_STATUS_INVALID_STATE;
+  } else {
+    stream->held = ADC_STREAM_NO_BLOCK;
+  }
+  __set_PRIMASK(primask);
+
+  return status;
+}
+
+/*******************************************************************************
+ * To get the statistics of a streamed channel.
+ ******************************************************************************/
+sl_status_t sl_si91x_adc_stream_get_stats(uint8_t channel_num, sl_adc_stream_stats_t *stats)
+{
+  uint32_t primask;
+
+  if (stats == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+  if (channel_num >= MAXIMUM_CHANNEL_ID) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  primask = __get_PRIMASK();
+  __disable_irq();
+  *stats = adc_stream[channel_num].stats;
+  __set_PRIMASK(primask);
+
+  return SL_STATUS_OK;
+}
+
 /*******************************************************************************
  * To validate the RSI error code
  * While calling the RSI APIs, it returns the RSI Error codes.
@@ -1084,7 +1297,11 @@ static void callback_event_handler(uint8_t channel_no, uint8_t event)
 {
   switch (event) {
     case SL_INTERNAL_DMA:
-      user_callback(channel_no, SL_INTERNAL_DMA);
+      if ((channel_no < MAXIMUM_CHANNEL_ID) && (adc_stream_channels & BIT(channel_no))) {
+        adc_stream_complete_block(channel_no);
+      } else if (user_callback != NULL) {
+        user_callback(channel_no, SL_INTERNAL_DMA);
+      }
       break;
     case SL_ADC_STATIC_MODE_EVENT:
       user_callback(channel_no, SL_ADC_STATIC_MODE_EVENT);
@@ -1093,3 +1310,80 @@ static void callback_event_handler(uint8_t channel_no, uint8_t event)
       break;
   }
 }
+
+/*******************************************************************************
+ * Completes a half-buffer of a streamed channel, from the ADC interrupt.
+ * The peripheral driver has already re-armed the completed half-buffer, and
+ * the ADC is now refilling the other one: if the application still has it,
+ * it is an overrun. The completed half-buffer is then converted in place and
+ * handed out.
+ ******************************************************************************/
+static void adc_stream_complete_block(uint8_t channel_no)
+{
+  adc_stream_channel_t *stream = &adc_stream[channel_no];
+  sl_adc_stream_block_t block;
+  // pong_enable_sel is toggled after this callback, it still selects the completed half-buffer
+  uint8_t completed = (pong_enable_sel[channel_no] == 0) ? ADC_STREAM_PING : ADC_STREAM_PONG;
+  uint8_t refilled  = (completed == ADC_STREAM_PING) ? ADC_STREAM_PONG : ADC_STREAM_PING;
+
+  stream->stats.blocks++;
+  if (stream->ready == refilled) {
+    stream->ready = ADC_STREAM_NO_BLOCK;
+    stream->stats.overruns++;
+  }
+  if (stream->held == refilled) {
+    stream->held         = ADC_STREAM_NO_BLOCK;
+    stream->held_overrun = 1;
+    stream->stats.overruns++;
+  }
+
+  stream->count =
+    adc_stream_convert_block(stream->half[completed], stream->length, adc_stream_decimation, stream->input_type);
+  stream->sequence++;
+  stream->ready = completed;
+
+  if (adc_stream_callback != NULL) {
+    block.samples  = stream->half[completed];
+    block.count    = stream->count;
+    block.sequence = stream->sequence;
+    adc_stream_callback(channel_no, &block);
+  }
+}
+
+/*******************************************************************************
+ * Converts a half-buffer in place, averaging every decimation raw samples into
+ * one. The conversion is the one of RSI_ADC_ReadData() with data processing
+ * enabled, applied once per averaged sample. Returns the number of samples.
+ ******************************************************************************/
+static uint16_t adc_stream_convert_block(int16_t *samples, uint16_t length, uint8_t decimation, uint8_t input_type)
+{
+  uint16_t count = 0;
+
+  for (uint16_t index = 0; index < length; index += decimation) {
+    int32_t sum = 0;
+    int16_t value;
+
+    for (uint8_t n = 0; n < decimation; n++) {
+      sum += (int16_t)(samples[index + n] ^ (int16_t)SIGN_BIT);
+    }
+    value = (int16_t)(sum / decimation);
+    if (input_type == SL_ADC_DIFFERENTIAL) {
+      value = (int16_t)((value - adc_commn_config.adc_diff_offset) * adc_commn_config.adc_diff_gain);
+    } else {
+      value = (int16_t)((value - adc_commn_config.adc_sing_offset) * adc_commn_config.adc_sing_gain);
+    }
+    if (value > ADC_CONVERTED_MAX_VALUE) {
+      value = ADC_CONVERTED_MAX_VALUE;
+    } else if (value <= 0) {
+      value = 0;
+    }
+    if (value >= ADC_CONVERTED_MID_VALUE) {
+      value -= ADC_CONVERTED_MID_VALUE;
+    } else {
+      value += ADC_CONVERTED_MID_VALUE;
+    }
+    samples[count++] = value;
+  }
+
+  return count;
+}
@@ -547,6 +547,75 @@ int sl_si91x_select(int nfds,
                     sl_si91x_socket_select_callback_t callback);
 #endif
 
+/**
+ * @brief
+ * Creates a readiness poll instance for offloaded sockets.
+ * @details
+ * A poll instance holds a set of registered sockets and reports the ones that became ready for reading or writing,
+ * or were closed by the peer. Readiness is tracked on the host from the asynchronous events the NWP already delivers,
+ * so registering a socket or waiting on an instance does not issue any command to the device.
+ * Unlike sl_si91x_select(), the cost of sl_si91x_socket_poll_wait() grows with the number of ready sockets, not with the
+ * number of registered ones.
+ * @return
+ *   Poll identifier on success, or -1 on failure with errno set to EMFILE when all SL_SI91X_SOCKET_POLL_MAX_INSTANCES are in use, or ENOMEM.
+ */
+int sl_si91x_socket_poll_create(void);
+
+/**
+ * @brief
+ * Adds, modifies, or removes a socket in a poll instance.
+ * @details
+ * Events are edge-triggered: a socket is reported once per transition to ready. When a socket is added or modified,
+ * readiness that is already present on the host (queued receive data, free transmit buffers, or a closed connection) is
+ * reported by the next sl_si91x_socket_poll_wait().
+ * @param[in] poll
+ *   Poll identifier returned by @ref sl_si91x_socket_poll_create.
+ * @param[in] operation
+ *   Operation of type @ref sl_si91x_socket_poll_operation_t.
+ * @param[in] socket
+ *   Socket identifier.
+ * @param[in] events
+ *   Bitmap of SL_SI91X_SOCKET_POLL_READ and SL_SI91X_SOCKET_POLL_WRITE. SL_SI91X_SOCKET_POLL_HANGUP is always reported. Ignored for SL_SI91X_SOCKET_POLL_DELETE.
+ * @param[in] context
+ *   User context returned with every event of this socket. Ignored for SL_SI91X_SOCKET_POLL_DELETE.
+ * @return
+ *   Returns 0 on success, or -1 on failure with errno set to EBADF, EEXIST, ENOENT, or EINVAL.
+ * @note
+ *   Closed sockets are removed from all poll instances automatically.
+ */
+int sl_si91x_socket_poll_control(int poll,
+                                 sl_si91x_socket_poll_operation_t operation,
+                                 int socket,
+                                 uint8_t events,
+                                 void *context);
+
+/**
+ * @brief
+ * Waits for registered sockets to become ready.
+ * @param[in] poll
+ *   Poll identifier returned by @ref sl_si91x_socket_poll_create.
+ * @param[out] events
+ *   Array of @ref sl_si91x_socket_poll_event_t filled with the ready sockets.
+ * @param[in] max_events
+ *   Number of entries in events. Sockets that do not fit are reported by the next call.
+ * @param[in] timeout
+ *   Time to wait in milliseconds. 0 returns immediately and osWaitForever waits indefinitely.
+ * @return
+ *   Number of entries filled in events, 0 on timeout, or -1 on failure with errno set to EBADF or EINVAL.
+ */
+int sl_si91x_socket_poll_wait(int poll, sl_si91x_socket_poll_event_t *events, int max_events, uint32_t timeout);
+
+/**
+ * @brief
+ * Deletes a poll instance.
+ * @param[in] poll
+ *   Poll identifier returned by @ref sl_si91x_socket_poll_create.
+ * @return
+ *   Returns 0 on success, or -1 on failure with errno set to EBADF, or to EBUSY while a thread waits on the instance
+ *   in @ref sl_si91x_socket_poll_wait.
+ */
+int sl_si91x_socket_poll_close(int poll);
+
 /**
  * @brief Registers a callback for remote socket termination events.
  *
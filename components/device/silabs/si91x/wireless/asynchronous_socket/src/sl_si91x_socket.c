@@ -628,3 +628,27 @@ int sl_si91x_select(int nfds,
 {
   return sli_si91x_select(nfds, readfds, writefds, exceptfds, timeout, callback);
 }
+
+int sl_si91x_socket_poll_create(void)
+{
+  return sli_si91x_socket_poll_create();
+}
+
+int sl_si91x_socket_poll_control(int poll,
+                                 sl_si91x_socket_poll_operation_t operation,
+                                 int socket,
+                                 uint8_t events,
+                                 void *context)
+{
+  return sli_si91x_socket_poll_control(poll, operation, socket, events, context);
+}
+
+int sl_si91x_socket_poll_wait(int poll, sl_si91x_socket_poll_event_t *events, int max_events, uint32_t timeout)
+{
+  return sli_si91x_socket_poll_wait(poll, events, max_events, timeout);
+}
+
+int sl_si91x_socket_poll_close(int poll)
+{
+  return sli_si91x_socket_poll_close(poll);
+}
@@ -696,6 +696,38 @@ typedef struct rsi_ble_req_add_att_s {
   /** Attribute data. The maximum value is 240, refer to RSI_DEV_ATT_LEN Macro*/
   uint8_t data[RSI_DEV_ATT_LEN];
 } rsi_ble_req_add_att_t;
+
+/**
+ * @brief Structure representing a characteristic of a GATT database table added with rsi_ble_add_gatt_db().
+ *
+ * Each characteristic takes the declaration attribute handle, the value attribute handle (declaration handle + 1),
+ * and, when the property has RSI_BLE_ATT_PROPERTY_NOTIFY or RSI_BLE_ATT_PROPERTY_INDICATE, a client characteristic
+ * configuration descriptor handle (value handle + 1).
+ */
+typedef struct rsi_ble_gatt_db_char_s {
+  /** Characteristic value UUID */
+  uuid_t uuid;
+  /** Characteristic value property */
+  uint8_t property;
+  /** Characteristic value configuration bitmap, refer to rsi_ble_req_add_att_s */
+  uint16_t config_bitmap;
+  /** Characteristic value length. The maximum value is 240, refer to RSI_DEV_ATT_LEN Macro */
+  uint16_t data_len;
+  /** Initial characteristic value of data_len bytes. NULL initializes the value with zeros */
+  const uint8_t *p_data;
+} rsi_ble_gatt_db_char_t;
+
+/**
+ * @brief Structure representing a service of a GATT database table added with rsi_ble_add_gatt_db().
+ */
+typedef struct rsi_ble_gatt_db_service_s {
+  /** Service UUID */
+  uuid_t uuid;
+  /** Characteristics of the service, in handle order */
+  const rsi_ble_gatt_db_char_t *chars;
+  /** Number of characteristics */
+  uint16_t char_count;
+} rsi_ble_gatt_db_service_t;
 /** @} */
 
 // GATT Response structures
@@ -1910,6 +1942,21 @@ typedef struct chip_ble_buffers_stats_s {
   uint8_t cp_buffer_utilization;
 } chip_ble_buffers_stats_t;
 
+/**
+ * @brief Structure representing one notification of a batch.
+ *
+ * This structure is used to define the notifications sent with rsi_ble_notify_multiple_values(),
+ * including the local attribute handle and the attribute value.
+ */
+typedef struct rsi_ble_notify_entry_s {
+  /** Local attribute handle */
+  uint16_t handle;
+  /** Attribute value length */
+  uint16_t data_len;
+  /** Attribute value (data) */
+  const uint8_t *p_data;
+} rsi_ble_notify_entry_t;
+
 /******************************************************
  * *              GAP API's Declarations
  * ******************************************************/
@@ -3456,6 +3503,37 @@ int32_t rsi_ble_set_att_value(uint8_t *dev_addr, uint16_t handle, uint8_t data_l
  */
 int32_t rsi_ble_set_att_cmd(uint8_t *dev_addr, uint16_t handle, uint8_t data_len, const uint8_t *p_data);
 
+/*==============================================*/
+/**
+ * @fn         int32_t rsi_ble_set_att_cmd_wait(uint8_t *dev_addr, uint16_t handle,
+ *                                              uint8_t data_len, const uint8_t *p_data, uint32_t timeout_ms)
+ * @brief      Set the attribute value without waiting for an ACK from the remote device. This is a blocking API.
+ *             If no buffer of the remote device is available, the API waits until the module gives buffers back,
+ *             instead of returning an RSI_ERROR_BLE_DEV_BUF_FULL (-31) error.
+ * @pre Pre-conditions:
+ *        \ref rsi_ble_connect() API needs to be called before this API.
+ * @param[in]  dev_addr   - remote device address
+ * @param[in]  handle 	- attribute value handle
+ * @param[in]  data_len   - attribute value length
+ * @param[in]  p_data 	- attribute value
+ * @param[in]  timeout_ms - maximum time to wait for a buffer, in milliseconds
+ * @return The following values are returned:
+ *     - 0		-	Success 
+ *     - -31  -  No buffer was given back within timeout_ms (RSI_ERROR_BLE_DEV_BUF_FULL)
+ *     - Non-Zero Value	-	Failure 
+ *     - 0x4E60  -  Invalid Handle range 
+ *     - 0x4E62  -  Invalid Parameters 
+ *     - 0x4D04  -  BLE not connected 
+ *     - 0x4D05  -  BLE Socket not available 
+ *     - 0x4E65  -  Invalid Attribute Length When Small Buffer Mode is Configured 
+ * @note       Refer to the Status Codes section for the above error codes at [wiseconnect-status-codes](../wiseconnect-api-reference-guide-err-codes/wiseconnect-status-codes) .
+ */
+int32_t rsi_ble_set_att_cmd_wait(uint8_t *dev_addr,
+                                 uint16_t handle,
+                                 uint8_t data_len,
+                                 const uint8_t *p_data,
+                                 uint32_t timeout_ms);
+
 /*==============================================*/
 /**
  * @fn         int32_t rsi_ble_set_att_cmd_async(uint8_t *dev_addr, uint16_t handle,
@@ -3597,6 +3675,36 @@ int32_t rsi_ble_add_service(uuid_t service_uuid, rsi_ble_resp_add_serv_t *p_resp
  */
 int32_t rsi_ble_add_attribute(rsi_ble_req_add_att_t *p_attribute);
 
+/*==============================================*/
+/**
+ * @fn         int32_t rsi_ble_add_gatt_db(const rsi_ble_gatt_db_service_t *services, uint16_t service_count,
+ *                                         rsi_ble_resp_add_serv_t *p_resp_serv, uint16_t *p_value_handles)
+ * @brief      Add the services and characteristics of a GATT database table to the local GATT Server. This is a blocking API.
+ *             Each service is added with one command, and the attributes of its characteristics are sent without
+ *             waiting for the response of each one, up to RSI_BLE_MAX_ASYNC_CMDS at a time.
+ * @pre Pre-conditions:
+ *        - Call [sl_wifi_init()](../wiseconnect-api-reference-guide-wi-fi/wifi-common-api#sl-wifi-init) before calling this API.
+ * @param[in]  services        - services to add, refer to rsi_ble_gatt_db_service_s structure for more details. The table can be const.
+ * @param[in]  service_count   - number of services
+ * @param[out] p_resp_serv     - array of service_count entries filled with the service handler and start handle of each service, can be NULL
+ * @param[out] p_value_handles - array filled with the value handle of each characteristic, in table order, can be NULL
+ * @return The following values are returned:
+ *             - 0		-	Success 
+ *             - -2   -  Invalid parameters, such as a characteristic value longer than RSI_DEV_ATT_LEN. Nothing is added.
+ *             - -30  -  The responses of the attributes were not received (RSI_ERROR_RESPONSE_TIMEOUT)
+ *             - -41  -  Semaphore creation failed (RSI_ERROR_SEMAPHORE_CREATE_FAILED)
+ *             - Non-Zero Value	-	Failure, first error returned by \ref rsi_ble_add_service() or \ref rsi_ble_add_attribute()
+ *             - 0x4046  -  Invalid Arguments 
+ *             - 0x4D08  -  Profile record full 
+ *             - 0x4D09  -  Attribute record full  
+ * @note       Refer to the Status Codes section for the above error codes at [wiseconnect-status-codes](../wiseconnect-api-reference-guide-err-codes/wiseconnect-status-codes) .
+ * @note       On failure, the services added before the error stay in the database.
+ */
+int32_t rsi_ble_add_gatt_db(const rsi_ble_gatt_db_service_t *services,
+                            uint16_t service_count,
+                            rsi_ble_resp_add_serv_t *p_resp_serv,
+                            uint16_t *p_value_handles);
+
 /*==============================================*/
 /**
  * @fn         int32_t rsi_ble_set_local_att_value(uint16_t handle, uint16_t data_len,
@@ -3681,6 +3789,65 @@ int32_t rsi_ble_set_wo_resp_notify_buf_info(const uint8_t *dev_addr, uint8_t buf
  */
 int32_t rsi_ble_notify_value(const uint8_t *dev_addr, uint16_t handle, uint16_t data_len, const uint8_t *p_data);
 
+/*==============================================*/
+/**
+ * @fn         int32_t rsi_ble_notify_value_wait(const uint8_t *dev_addr, uint16_t handle,
+ *                                               uint16_t data_len, const uint8_t *p_data, uint32_t timeout_ms)
+ * @brief      Notify the local value to the remote device. This is a blocking API.
+ *             If no buffer of the remote device is available, the API waits until the module gives buffers back,
+ *             instead of returning an RSI_ERROR_BLE_DEV_BUF_FULL (-31) error.
+ * @pre Pre-conditions:
+ *        - \ref rsi_ble_connect() API needs to be called before this API.
+ * @param[in]  dev_addr   - remote device address
+ * @param[in]  handle 	- local attribute handle
+ * @param[in]  data_len   - attribute value length
+ * @param[in]  p_data 	- attribute value
+ * @param[in]  timeout_ms - maximum time to wait for a buffer, in milliseconds
+ * @return The following values are returned:
+ *             - 0		-	Success 
+ *             - -31  -  No buffer was given back within timeout_ms (RSI_ERROR_BLE_DEV_BUF_FULL)
+ *             - Non-Zero Value	-	Failure 
+ *             - 0x4046  -  Invalid Arguments 
+ *             - 0x4A0D  -  Invalid attribute value length 
+ *             - 0x4D05  -  BLE socket not available 
+ *             - 0x4D06  -  Attribute record not found 
+ *             - 0x4E60  -  Invalid Handle Range 
+ *             - 0x4E65  -  Invalid Attribute Length When Small Buffer Mode is Configured  
+ * @note       Refer to the Status Codes section for the above error codes at [wiseconnect-status-codes](../wiseconnect-api-reference-guide-err-codes/wiseconnect-status-codes) 
+ */
+int32_t rsi_ble_notify_value_wait(const uint8_t *dev_addr,
+                                  uint16_t handle,
+                                  uint16_t data_len,
+                                  const uint8_t *p_data,
+                                  uint32_t timeout_ms);
+
+/*==============================================*/
+/**
+ * @fn         int32_t rsi_ble_notify_multiple_values(const uint8_t *dev_addr, const rsi_ble_notify_entry_t *entries,
+ *                                                    uint16_t count, uint32_t timeout_ms, uint16_t *sent_count)
+ * @brief      Notify several local values to the remote device, in order. This is a blocking API.
+ *             The notifications are sent back to back while the remote device has buffers, and the API waits for
+ *             the module to give buffers back when they run out. It stops at the first notification that fails.
+ * @pre Pre-conditions:
+ *        - \ref rsi_ble_connect() API needs to be called before this API.
+ * @param[in]  dev_addr   - remote device address
+ * @param[in]  entries    - notifications to send, of type \ref rsi_ble_notify_entry_t
+ * @param[in]  count      - number of entries
+ * @param[in]  timeout_ms - maximum time to wait for a buffer, for each notification, in milliseconds
+ * @param[out] sent_count - number of notifications sent, can be NULL
+ * @return The following values are returned:
+ *             - 0		-	Success 
+ *             - -2   -  Invalid parameters
+ *             - -31  -  No buffer was given back within timeout_ms (RSI_ERROR_BLE_DEV_BUF_FULL)
+ *             - Non-Zero Value	-	Failure, see \ref rsi_ble_notify_value()
+ * @note       Refer to the Status Codes section for the above error codes at [wiseconnect-status-codes](../wiseconnect-api-reference-guide-err-codes/wiseconnect-status-codes) 
+ */
+int32_t rsi_ble_notify_multiple_values(const uint8_t *dev_addr,
+                                       const rsi_ble_notify_entry_t *entries,
+                                       uint16_t count,
+                                       uint32_t timeout_ms,
+                                       uint16_t *sent_count);
+
 /*==============================================*/
 /**
  * @fn         int32_t rsi_ble_indicate_value(const uint8_t *dev_addr, uint16_t handle,
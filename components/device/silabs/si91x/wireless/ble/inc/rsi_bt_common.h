@@ -280,6 +280,57 @@ typedef struct rsi_remote_ble_info_s {
   /** Mutex handle for avail_buf_info update */
   osMutexId_t ble_buff_mutex;
 } rsi_remote_ble_info_t;
+
+/** @addtogroup BT_BLE_CONSTANTS
+ *  @{
+ */
+
+/** Maximum number of BLE commands sent with rsi_ble_driver_send_cmd_async() waiting for their response */
+#ifndef RSI_BLE_MAX_ASYNC_CMDS
+#define RSI_BLE_MAX_ASYNC_CMDS 4
+#endif
+/** @} */
+
+/**
+ * @brief Callback called when the response of a command sent with rsi_ble_driver_send_cmd_async() is received.
+ *
+ * @details It runs on the driver RX thread, which also processes the responses of synchronous commands, so it must
+ *          not block. In particular it must not call rsi_bt_driver_send_cmd() or any other synchronous BLE API, which
+ *          would wait for a response that can only be processed once the callback returns.
+ *          A command without response within its timeout, or still waiting when the BLE driver is deinitialized,
+ *          is completed with RSI_ERROR_RESPONSE_TIMEOUT and no payload. That call is made from the thread that
+ *          detects it: the driver RX thread, a caller of rsi_ble_driver_send_cmd_async() or
+ *          rsi_ble_driver_wait_async_cmds(), or the driver deinitialization.
+ *
+ * @param[in] cmd           Command the response belongs to.
+ * @param[in] status        Command status, 0 on success.
+ * @param[in] resp          Response payload, only valid during the callback. NULL on timeout.
+ * @param[in] resp_length   Response payload length.
+ * @param[in] context       Context given with the command.
+ */
+typedef void (*rsi_ble_cmd_complete_cb_t)(uint16_t cmd,
+                                          int32_t status,
+                                          const uint8_t *resp,
+                                          uint16_t resp_length,
+                                          void *context);
+
+/**
+ * @brief Structure represents a BLE command waiting for its response.
+ */
+typedef struct rsi_ble_async_cmd_s {
+  /** Flag for entry used or not, set last when the command is added and cleared last when it completes */
+  volatile uint8_t used;
+  /** Command sent, which is also the type of its response */
+  uint16_t cmd;
+  /** Sequence number, responses of the same type complete the oldest command first */
+  uint32_t seq;
+  /** Kernel tick by which the response is expected */
+  uint32_t deadline;
+  /** Completion callback, can be NULL */
+  rsi_ble_cmd_complete_cb_t callback;
+  /** Context given to the callback */
+  void *context;
+} rsi_ble_async_cmd_t;
 // Driver BT/BLE/PROP_PROTOCOL control block
 /**
  * @brief Structure represents the Bluetooth control block.
@@ -331,6 +382,16 @@ typedef struct rsi_bt_cb_s {
   uint8_t remote_ble_index;
   /** Driver BT control block asynchronous status */
   volatile int32_t async_status;
+  /** Event flags set when a remote LE device gets buffers back or disconnects, one flag per remote_ble_info entry */
+  osEventFlagsId_t le_buf_event;
+  /** Commands sent with rsi_ble_driver_send_cmd_async() waiting for their response */
+  rsi_ble_async_cmd_t async_cmd[RSI_BLE_MAX_ASYNC_CMDS];
+  /** Sequence number of the next asynchronous command */
+  uint32_t async_cmd_seq;
+  /** Counting semaphore of the free async_cmd entries */
+  osSemaphoreId_t async_cmd_sem;
+  /** Mutex protecting the async_cmd entries, which are completed from the RX thread and expired from the callers */
+  osMutexId_t async_cmd_mutex;
 } rsi_bt_cb_t;
 
 // Set local name command structure
@@ -521,6 +582,13 @@ void rsi_bt_set_status(rsi_bt_cb_t *bt_cb, int32_t status);
 void rsi_bt_common_tx_done(sl_wifi_system_packet_t *pkt);
 int8_t rsi_bt_cb_init(rsi_bt_cb_t *bt_cb, uint16_t protocol_type);
 int32_t rsi_bt_driver_send_cmd(uint16_t cmd, void *cmd_struct, void *resp);
+int32_t rsi_ble_driver_send_cmd_wait_buf(uint16_t cmd, void *cmd_struct, uint32_t timeout_ms);
+int32_t rsi_ble_driver_send_cmd_async(uint16_t cmd,
+                                      void *cmd_struct,
+                                      rsi_ble_cmd_complete_cb_t callback,
+                                      void *context);
+int32_t rsi_ble_driver_wait_async_cmds(uint32_t timeout_ms);
+uint32_t rsi_ble_expire_async_cmds(rsi_bt_cb_t *bt_cb, uint8_t expire_all);
 uint16_t rsi_bt_global_cb_init(struct rsi_driver_cb_s *driver_cb, uint8_t *buffer);
 uint16_t rsi_driver_process_bt_resp_handler(void *rx_pkt);
 uint16_t rsi_bt_get_proto_type(uint16_t rsp_type, rsi_bt_cb_t **bt_cb);
@@ -47,6 +47,9 @@
  * *                      Macros
  * ******************************************************/
 //SL_PRINTF logging call
+#if defined(PRINT_DEBUG_LOG) && defined(SL_WLAN_LOGGER_DEFERRED)
+#include "sl_deferred_log.h"
+#endif
 #ifndef SL_PRINTF
 #define SL_PRINTF(...)
 #endif
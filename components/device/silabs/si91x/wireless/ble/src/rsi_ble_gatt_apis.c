@@ -17,6 +17,7 @@
 #include "rsi_ble_apis.h"
 #include "ble_config.h"
 #include "rsi_ble.h"
+#include "rsi_ble_common_config.h"
 #include "rsi_bt_common_apis.h"
 
 #include "rsi_common.h"
@@ -1053,6 +1054,52 @@ int32_t rsi_ble_set_att_cmd(uint8_t *dev_addr, uint16_t handle, uint8_t data_len
   return rsi_bt_driver_send_cmd(RSI_BLE_REQ_WRITE_NO_ACK, &set_att_cmd, NULL);
 }
 
+/*==============================================*/
+/**
+ * @fn         int32_t rsi_ble_set_att_cmd_wait(uint8_t *dev_addr, uint16_t handle,
+ *                                              uint8_t data_len, const uint8_t *p_data, uint32_t timeout_ms)
+ * @brief      Set the attribute value without waiting for an ACK from the remote device. This is a Blocking API.
+ *             If no buffer of the remote device is available, wait until the module gives buffers back instead of
+ *             returning RSI_ERROR_BLE_DEV_BUF_FULL (-31).
+ * @pre        \ref rsi_ble_connect() API needs to be called before this API.
+ * @param[in]  dev_addr   - remote device address
+ * @param[in]  handle     - attribute value handle
+ * @param[in]  data_len   - attribute value length
+ * @param[in]  p_data     - attribute value
+ * @param[in]  timeout_ms - maximum time to wait for a buffer, in milliseconds
+ * @return     0		-	Success \n
+ *             -31    -  No buffer was given back within timeout_ms (RSI_ERROR_BLE_DEV_BUF_FULL) \n
+ *             Non-Zero Value	-	Failure \n
+ *             0x4E60  -  Invalid Handle range \n
+ *             0x4E62  -  Invalid Parameters \n
+ *             0x4D04  -  BLE not connected \n
+ *             0x4D05  -  BLE Socket not available \n
+ *             0x4E65  -  Invalid Attribute Length When Small Buffer Mode is Configured \n
+ * @note       Refer to the Status Codes section for the above error codes at [wiseconnect-status-codes](../wiseconnect-api-reference-guide-err-codes/wiseconnect-status-codes) .
+ *
+ */
+
+int32_t rsi_ble_set_att_cmd_wait(uint8_t *dev_addr,
+                                 uint16_t handle,
+                                 uint8_t data_len,
+                                 const uint8_t *p_data,
+                                 uint32_t timeout_ms)
+{
+
+  SL_PRINTF(SL_RSI_BLE_SET_ATT_COMMAND, BLE, LOG_INFO);
+  rsi_ble_set_att_cmd_t set_att_cmd;
+  memset(&set_att_cmd, 0, sizeof(set_att_cmd));
+#ifdef BD_ADDR_IN_ASCII
+  rsi_ascii_dev_address_to_6bytes_rev(set_att_cmd.dev_addr, dev_addr);
+#else
+  memcpy((uint8_t *)set_att_cmd.dev_addr, (int8_t *)dev_addr, 6);
+#endif
+  rsi_uint16_to_2bytes(set_att_cmd.handle, handle);
+  set_att_cmd.length = (uint8_t)(RSI_MIN(sizeof(set_att_cmd.att_value), data_len));
+  memcpy(set_att_cmd.att_value, p_data, set_att_cmd.length);
+  return rsi_ble_driver_send_cmd_wait_buf(RSI_BLE_REQ_WRITE_NO_ACK, &set_att_cmd, timeout_ms);
+}
+
 /*==============================================*/
 /**
  * @fn         int32_t rsi_ble_set_long_att_value(uint8_t *dev_addr,
@@ -1232,6 +1279,253 @@ int32_t rsi_ble_add_attribute(rsi_ble_req_add_att_t *p_attribute)
   return rsi_bt_driver_send_cmd(RSI_BLE_ADD_ATTRIBUTE, p_attribute, NULL);
 }
 
+/**
+ * @brief      State of one rsi_ble_add_gatt_db() call, given as context to the responses of its attributes
+ */
+typedef struct rsi_ble_gatt_db_ctx_s {
+  /** Released once by each completed attribute */
+  osSemaphoreId_t done_sem;
+  /** Attributes sent and not collected from done_sem yet */
+  uint16_t pending;
+  /** First error of the attributes */
+  volatile int32_t status;
+} rsi_ble_gatt_db_ctx_t;
+
+/**
+ * @brief      Record the status of an attribute added by rsi_ble_add_gatt_db()
+ */
+static void rsi_ble_gatt_db_att_done(uint16_t cmd,
+                                     int32_t status,
+                                     const uint8_t *resp,
+                                     uint16_t resp_length,
+                                     void *context)
+{
+  rsi_ble_gatt_db_ctx_t *ctx = (rsi_ble_gatt_db_ctx_t *)context;
+
+  UNUSED_PARAMETER(cmd);
+  UNUSED_PARAMETER(resp);
+  UNUSED_PARAMETER(resp_length);
+
+  if ((status != RSI_SUCCESS) && (ctx->status == RSI_SUCCESS)) {
+    ctx->status = status;
+  }
+  // Last access to the context, rsi_ble_add_gatt_db() may return as soon as it is released
+  osSemaphoreRelease(ctx->done_sem);
+}
+
+/**
+ * @brief      Send an attribute of rsi_ble_add_gatt_db() without waiting for its response
+ */
+static int32_t rsi_ble_gatt_db_add_att(rsi_ble_gatt_db_ctx_t *ctx, rsi_ble_req_add_att_t *p_attribute)
+{
+  int32_t status = ctx->status;
+
+  if (status == RSI_SUCCESS) {
+    status = rsi_ble_driver_send_cmd_async(RSI_BLE_ADD_ATTRIBUTE, p_attribute, rsi_ble_gatt_db_att_done, ctx);
+    if (status == RSI_SUCCESS) {
+      ctx->pending++;
+    }
+  }
+  return status;
+}
+
+/**
+ * @brief      Wait until every attribute sent by rsi_ble_add_gatt_db() is completed, so that no callback uses the
+ *             context after it returns
+ */
+static void rsi_ble_gatt_db_wait_atts(rsi_ble_gatt_db_ctx_t *ctx)
+{
+  uint32_t wait_ms = 0;
+
+  while (ctx->pending > 0) {
+    // Attributes without response are only completed once their deadline is checked
+    wait_ms = rsi_ble_expire_async_cmds(rsi_driver_cb->ble_cb, 0);
+    if (osSemaphoreAcquire(ctx->done_sem, wait_ms) == osOK) {
+      ctx->pending--;
+    }
+  }
+}
+
+/**
+ * @brief      Check a service of rsi_ble_add_gatt_db() and fill the add service request with its attribute count
+ *             and the total size of its attribute values
+ */
+static int32_t rsi_ble_gatt_db_prepare_service(const rsi_ble_gatt_db_service_t *service,
+                                               rsi_ble_req_add_serv_t *p_req_serv)
+{
+  const rsi_ble_gatt_db_char_t *db_char = NULL;
+  uint32_t num_of_attributes            = 0;
+  uint32_t total_att_datasize           = 0;
+
+  if ((service->chars == NULL) && (service->char_count != 0)) {
+    return RSI_ERROR_INVALID_PARAM;
+  }
+  for (uint16_t char_inx = 0; char_inx < service->char_count; char_inx++) {
+    db_char = &service->chars[char_inx];
+    if ((db_char->data_len > RSI_DEV_ATT_LEN)
+        || ((db_char->uuid.size != 2) && (db_char->uuid.size != 4) && (db_char->uuid.size != 16))) {
+      return RSI_ERROR_INVALID_PARAM;
+    }
+    // Declaration and value, then the client characteristic configuration descriptor
+    num_of_attributes += 2;
+    total_att_datasize += (uint32_t)(db_char->uuid.size + 4) + db_char->data_len;
+    if (db_char->property & (RSI_BLE_ATT_PROPERTY_NOTIFY | RSI_BLE_ATT_PROPERTY_INDICATE)) {
+      num_of_attributes += 1;
+      total_att_datasize += 2;
+    }
+  }
+  if (num_of_attributes > UINT8_MAX) {
+    return RSI_ERROR_INVALID_PARAM;
+  }
+
+  memset(p_req_serv, 0, sizeof(rsi_ble_req_add_serv_t));
+  memcpy(&p_req_serv->service_uuid, &service->uuid, sizeof(uuid_t));
+  p_req_serv->num_of_attributes = (uint8_t)num_of_attributes;
+  // The field is one byte wide, larger services report the maximum
+  p_req_serv->total_att_datasize = (uint8_t)RSI_MIN(total_att_datasize, UINT8_MAX);
+  return RSI_SUCCESS;
+}
+
+/*==============================================*/
+/**
+ * @fn         int32_t rsi_ble_add_gatt_db(const rsi_ble_gatt_db_service_t *services, uint16_t service_count,
+ *                                         rsi_ble_resp_add_serv_t *p_resp_serv, uint16_t *p_value_handles)
+ * @brief      Add the services and characteristics of a GATT database table to the local GATT Server. This is a Blocking API.
+ * @pre        Device should be initialized before calling this API.
+ * @param[in]  services        - services to add, please refer rsi_ble_gatt_db_service_s structure for more info.
+ * @param[in]  service_count   - number of services
+ * @param[out] p_resp_serv     - service handler and start handle of each service, can be NULL
+ * @param[out] p_value_handles - value handle of each characteristic, in table order, can be NULL
+ * @return     0		-	Success \n
+ *             -2     -  Invalid parameters, such as a characteristic value longer than RSI_DEV_ATT_LEN \n
+ *             -30    -  The responses of the attributes were not received (RSI_ERROR_RESPONSE_TIMEOUT) \n
+ *             -41    -  Semaphore creation failed (RSI_ERROR_SEMAPHORE_CREATE_FAILED) \n
+ *             Non-Zero Value	-	Failure \n
+ *             0x4046  -  Invalid Arguments \n
+ *             0x4D08  -  Profile record full \n
+ *             0x4D09  -  Attribute record full  \n
+ * @note       Refer to the Status Codes section for the above error codes at [wiseconnect-status-codes](../wiseconnect-api-reference-guide-err-codes/wiseconnect-status-codes) .
+ *
+ */
+
+int32_t rsi_ble_add_gatt_db(const rsi_ble_gatt_db_service_t *services,
+                            uint16_t service_count,
+                            rsi_ble_resp_add_serv_t *p_resp_serv,
+                            uint16_t *p_value_handles)
+{
+  rsi_ble_resp_add_serv_t new_serv = { 0 };
+  rsi_ble_req_add_serv_t req_serv;
+  rsi_ble_req_add_att_t new_att;
+  rsi_ble_gatt_db_ctx_t ctx             = { 0 };
+  const rsi_ble_gatt_db_char_t *db_char = NULL;
+  uint16_t handle                       = 0;
+  int32_t status                        = RSI_SUCCESS;
+
+  if ((services == NULL) && (service_count != 0)) {
+    return RSI_ERROR_INVALID_PARAM;
+  }
+  // Reject an invalid table before any of it is added
+  for (uint16_t serv_inx = 0; serv_inx < service_count; serv_inx++) {
+    status = rsi_ble_gatt_db_prepare_service(&services[serv_inx], &req_serv);
+    if (status != RSI_SUCCESS) {
+      return status;
+    }
+  }
+
+  ctx.done_sem = osSemaphoreNew(UINT16_MAX, 0, NULL);
+  if (ctx.done_sem == NULL) {
+    return RSI_ERROR_SEMAPHORE_CREATE_FAILED;
+  }
+  ctx.status = RSI_SUCCESS;
+
+  for (uint16_t serv_inx = 0; (serv_inx < service_count) && (status == RSI_SUCCESS); serv_inx++) {
+    // The service handler of the response is needed by its attributes, so the service is added synchronously.
+    // The attributes of the previous service complete first, the add service response would otherwise be
+    // matched with one of them
+    rsi_ble_gatt_db_wait_atts(&ctx);
+    if (ctx.status != RSI_SUCCESS) {
+      break;
+    }
+    rsi_ble_gatt_db_prepare_service(&services[serv_inx], &req_serv);
+    status = rsi_bt_driver_send_cmd(RSI_BLE_ADD_SERVICE, &req_serv, &new_serv);
+    if (status != RSI_SUCCESS) {
+      break;
+    }
+    if (p_resp_serv != NULL) {
+      p_resp_serv[serv_inx] = new_serv;
+    }
+
+    handle = new_serv.start_handle;
+    for (uint16_t char_inx = 0; char_inx < services[serv_inx].char_count; char_inx++) {
+      db_char = &services[serv_inx].chars[char_inx];
+
+      // Characteristic declaration, holding the property, the handle and the UUID of the value
+      memset(&new_att, 0, sizeof(new_att));
+      new_att.serv_handler       = new_serv.serv_handler;
+      new_att.handle             = ++handle;
+      new_att.att_uuid.size      = 2;
+      new_att.att_uuid.val.val16 = RSI_BLE_CHAR_SERV_UUID;
+      new_att.property           = RSI_BLE_ATT_PROPERTY_READ;
+      new_att.data_len           = (uint16_t)(db_char->uuid.size + 4);
+      new_att.data[0]            = db_char->property;
+      rsi_uint16_to_2bytes(&new_att.data[2], (uint16_t)(handle + 1));
+      if (db_char->uuid.size == 2) {
+        rsi_uint16_to_2bytes(&new_att.data[4], db_char->uuid.val.val16);
+      } else {
+        memcpy(&new_att.data[4], &db_char->uuid.val.val128, db_char->uuid.size);
+      }
+      status = rsi_ble_gatt_db_add_att(&ctx, &new_att);
+      if (status != RSI_SUCCESS) {
+        break;
+      }
+
+      // Characteristic value
+      memset(&new_att, 0, sizeof(new_att));
+      new_att.serv_handler  = new_serv.serv_handler;
+      new_att.handle        = ++handle;
+      new_att.config_bitmap = db_char->config_bitmap;
+      new_att.property      = db_char->property;
+      new_att.data_len      = db_char->data_len;
+      memcpy(&new_att.att_uuid, &db_char->uuid, sizeof(uuid_t));
+      if (db_char->p_data != NULL) {
+        memcpy(new_att.data, db_char->p_data, new_att.data_len);
+      }
+      status = rsi_ble_gatt_db_add_att(&ctx, &new_att);
+      if (status != RSI_SUCCESS) {
+        break;
+      }
+      if (p_value_handles != NULL) {
+        *p_value_handles++ = handle;
+      }
+
+      // Client characteristic configuration descriptor
+      if (db_char->property & (RSI_BLE_ATT_PROPERTY_NOTIFY | RSI_BLE_ATT_PROPERTY_INDICATE)) {
+        memset(&new_att, 0, sizeof(new_att));
+        new_att.serv_handler       = new_serv.serv_handler;
+        new_att.handle             = ++handle;
+        new_att.att_uuid.size      = 2;
+        new_att.att_uuid.val.val16 = RSI_BLE_CLIENT_CHAR_UUID;
+        new_att.property           = RSI_BLE_ATT_PROPERTY_READ | RSI_BLE_ATT_PROPERTY_WRITE;
+        new_att.data_len           = 2;
+        status                     = rsi_ble_gatt_db_add_att(&ctx, &new_att);
+        if (status != RSI_SUCCESS) {
+          break;
+        }
+      }
+    }
+  }
+
+  // Wait for the attributes still in flight, even after an error. Those without response complete with
+  // RSI_ERROR_RESPONSE_TIMEOUT at their command deadline
+  rsi_ble_gatt_db_wait_atts(&ctx);
+  osSemaphoreDelete(ctx.done_sem);
+  if (status == RSI_SUCCESS) {
+    status = ctx.status;
+  }
+
+  return status;
+}
+
 /*==============================================*/
 /**
  * @fn         int32_t rsi_ble_set_local_att_value(uint16_t handle, uint16_t data_len,
@@ -1359,6 +1653,116 @@ int32_t rsi_ble_notify_value(const uint8_t *dev_addr, uint16_t handle, uint16_t
   return rsi_bt_driver_send_cmd(RSI_BLE_CMD_NOTIFY, &rec_data, NULL);
 }
 
+/*==============================================*/
+/**
+ * @fn         int32_t rsi_ble_notify_value_wait(const uint8_t *dev_addr, uint16_t handle,
+ *                                               uint16_t data_len, const uint8_t *p_data, uint32_t timeout_ms)
+ * @brief      Notify the local value to the remote device. This is a Blocking API.
+ *             If no buffer of the remote device is available, wait until the module gives buffers back instead of
+ *             returning RSI_ERROR_BLE_DEV_BUF_FULL (-31).
+ * @pre        \ref rsi_ble_connect() API needs to be called before this API.
+ * @param[in]  dev_addr   - remote device address
+ * @param[in]  handle     - local attribute handle
+ * @param[in]  data_len   - attribute value length
+ * @param[in]  p_data     - attribute value
+ * @param[in]  timeout_ms - maximum time to wait for a buffer, in milliseconds
+ * @return     0		-	Success \n
+ *             -31    -  No buffer was given back within timeout_ms (RSI_ERROR_BLE_DEV_BUF_FULL) \n
+ *             Non-Zero Value	-	Failure \n
+ *             0x4046  -  Invalid Arguments \n
+ *             0x4A0D  -  Invalid attribute value length \n
+ *             0x4D05  -  BLE socket not available \n
+ *             0x4D06  -  Attribute record not found \n
+ *             0x4E60  -  Invalid Handle Range \n
+ *             0x4E65  -  Invalid Attribute Length When Small Buffer Mode is Configured  \n
+ * @note       Refer to the Status Codes section for the above error codes at [wiseconnect-status-codes](../wiseconnect-api-reference-guide-err-codes/wiseconnect-status-codes) \n
+ *
+ */
+int32_t rsi_ble_notify_value_wait(const uint8_t *dev_addr,
+                                  uint16_t handle,
+                                  uint16_t data_len,
+                                  const uint8_t *p_data,
+                                  uint32_t timeout_ms)
+{
+
+  SL_PRINTF(SL_RSI_BLE_NOTIFY_VALUE_TRIGGER, BLE, LOG_INFO, "HANDLE: %2x", handle);
+  rsi_ble_notify_att_value_t rec_data;
+  memset(&rec_data, 0, sizeof(rec_data));
+#ifdef BD_ADDR_IN_ASCII
+  rsi_ascii_dev_address_to_6bytes_rev(rec_data.dev_addr, dev_addr);
+#else
+  memcpy(rec_data.dev_addr, dev_addr, 6);
+#endif
+
+  rec_data.handle   = handle;
+  rec_data.data_len = (uint16_t)(RSI_MIN(data_len, sizeof(rec_data.data)));
+  memcpy(rec_data.data, p_data, rec_data.data_len);
+
+  return rsi_ble_driver_send_cmd_wait_buf(RSI_BLE_CMD_NOTIFY, &rec_data, timeout_ms);
+}
+
+/*==============================================*/
+/**
+ * @fn         int32_t rsi_ble_notify_multiple_values(const uint8_t *dev_addr, const rsi_ble_notify_entry_t *entries,
+ *                                                    uint16_t count, uint32_t timeout_ms, uint16_t *sent_count)
+ * @brief      Notify several local values to the remote device, in order. This is a Blocking API.
+ *             The notifications are sent back to back while the remote device has buffers, and the API waits for
+ *             the module to give buffers back when they run out.
+ * @pre        \ref rsi_ble_connect() API needs to be called before this API.
+ * @param[in]  dev_addr   - remote device address
+ * @param[in]  entries    - notifications to send
+ * @param[in]  count      - number of entries
+ * @param[in]  timeout_ms - maximum time to wait for a buffer, for each notification, in milliseconds
+ * @param[out] sent_count - number of notifications sent, can be NULL
+ * @return     0		-	Success \n
+ *             -2     -  Invalid parameters \n
+ *             -31    -  No buffer was given back within timeout_ms (RSI_ERROR_BLE_DEV_BUF_FULL) \n
+ *             Non-Zero Value	-	Failure of the first notification not sent, see \ref rsi_ble_notify_value() \n
+ * @note       Refer to the Status Codes section for the above error codes at [wiseconnect-status-codes](../wiseconnect-api-reference-guide-err-codes/wiseconnect-status-codes) \n
+ *
+ */
+int32_t rsi_ble_notify_multiple_values(const uint8_t *dev_addr,
+                                       const rsi_ble_notify_entry_t *entries,
+                                       uint16_t count,
+                                       uint32_t timeout_ms,
+                                       uint16_t *sent_count)
+{
+  rsi_ble_notify_att_value_t rec_data;
+  int32_t status = RSI_SUCCESS;
+  uint16_t inx;
+
+  if (sent_count != NULL) {
+    *sent_count = 0;
+  }
+  if ((entries == NULL) && (count != 0)) {
+    return RSI_ERROR_INVALID_PARAM;
+  }
+
+  // The address is copied once, the remaining fields are rewritten for each notification
+  memset(&rec_data, 0, sizeof(rec_data));
+#ifdef BD_ADDR_IN_ASCII
+  rsi_ascii_dev_address_to_6bytes_rev(rec_data.dev_addr, dev_addr);
+#else
+  memcpy(rec_data.dev_addr, dev_addr, 6);
+#endif
+
+  for (inx = 0; inx < count; inx++) {
+    rec_data.handle   = entries[inx].handle;
+    rec_data.data_len = (uint16_t)(RSI_MIN(entries[inx].data_len, sizeof(rec_data.data)));
+    memcpy(rec_data.data, entries[inx].p_data, rec_data.data_len);
+
+    status = rsi_ble_driver_send_cmd_wait_buf(RSI_BLE_CMD_NOTIFY, &rec_data, timeout_ms);
+    if (status != RSI_SUCCESS) {
+      break;
+    }
+    if (sent_count != NULL) {
+      (*sent_count)++;
+    }
+  }
+
+  return status;
+}
+
 /*==============================================*/
 /**
  * @fn         int32_t rsi_ble_indicate_value(uint8_t *dev_addr, uint16_t handle,
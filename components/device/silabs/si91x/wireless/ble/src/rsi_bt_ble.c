@@ -64,6 +64,7 @@ uint32_t rsi_bt_get_status(const rsi_bt_cb_t *bt_cb);
 void rsi_ble_update_le_dev_buf(const rsi_ble_event_le_dev_buf_ind_t *rsi_ble_event_le_dev_buf_ind);
 void rsi_add_remote_ble_dev_info(const rsi_ble_event_enhance_conn_status_t *remote_dev_info);
 void rsi_remove_remote_ble_dev_info(const rsi_ble_event_disconnect_t *remote_dev_info);
+int32_t rsi_ble_get_remote_dev_index(const rsi_bt_cb_t *le_cb, const uint8_t *remote_bd_addr);
 int32_t rsi_driver_process_bt_resp(
   rsi_bt_cb_t *bt_cb,
   sl_wifi_system_packet_t *pkt,
@@ -72,6 +73,18 @@ int32_t rsi_driver_process_bt_resp(
 void rsi_ble_on_chip_memory_status_callbacks_register(chip_ble_buffers_stats_handler_t ble_on_chip_memory_status_event);
 uint16_t rsi_bt_prepare_common_pkt(uint16_t cmd_type, void *cmd_struct, sl_wifi_system_packet_t *pkt);
 uint16_t rsi_bt_prepare_le_pkt(uint16_t cmd_type, void *cmd_struct, sl_wifi_system_packet_t *pkt);
+int32_t rsi_bt_prepare_cmd_buffer(uint16_t *cmd,
+                                  void *cmd_struct,
+                                  rsi_bt_cb_t *bt_cb,
+                                  uint16_t protocol_type,
+                                  uint32_t timeout_ms,
+                                  sl_wifi_buffer_t **buffer);
+uint8_t rsi_ble_async_cmd_supported(uint16_t cmd);
+uint8_t rsi_ble_complete_async_cmd(rsi_bt_cb_t *bt_cb,
+                                   uint16_t rsp_type,
+                                   int32_t status,
+                                   const uint8_t *payload,
+                                   uint16_t payload_length);
 
 /*
  Global Variables
@@ -301,22 +314,43 @@ void rsi_ble_update_le_dev_buf(const rsi_ble_event_le_dev_buf_ind_t *rsi_ble_eve
 
   SL_PRINTF(SL_RSI_BT_UPDATE_LE_DEV_BUF_TRIGGER, BLUETOOTH, LOG_INFO);
   rsi_bt_cb_t *le_cb = rsi_driver_cb->ble_cb;
+  int32_t inx        = rsi_ble_get_remote_dev_index(le_cb, rsi_ble_event_le_dev_buf_ind->remote_dev_bd_addr);
 
-  for (uint8_t inx = 0; inx < (RSI_BLE_MAX_NBR_PERIPHERALS + RSI_BLE_MAX_NBR_CENTRALS); inx++) {
-    if (!memcmp(rsi_ble_event_le_dev_buf_ind->remote_dev_bd_addr,
-                le_cb->remote_ble_info[inx].remote_dev_bd_addr,
-                RSI_DEV_ADDR_LEN)) {
-      if (le_cb->remote_ble_info[inx].ble_buff_mutex) {
-        osMutexAcquire(le_cb->remote_ble_info[inx].ble_buff_mutex, 0xFFFFFFFFUL);
-      }
+  if (inx < 0) {
+    return;
+  }
+  if (le_cb->remote_ble_info[inx].ble_buff_mutex) {
+    osMutexAcquire(le_cb->remote_ble_info[inx].ble_buff_mutex, 0xFFFFFFFFUL);
+  }
 
-      le_cb->remote_ble_info[inx].avail_buf_cnt += rsi_ble_event_le_dev_buf_ind->avail_buf_cnt;
-      if (le_cb->remote_ble_info[inx].ble_buff_mutex) {
-        osMutexRelease(le_cb->remote_ble_info[inx].ble_buff_mutex);
-      }
-      break;
+  le_cb->remote_ble_info[inx].avail_buf_cnt += rsi_ble_event_le_dev_buf_ind->avail_buf_cnt;
+  if (le_cb->remote_ble_info[inx].ble_buff_mutex) {
+    osMutexRelease(le_cb->remote_ble_info[inx].ble_buff_mutex);
+  }
+
+  // Wake up the senders waiting for buffers of this device, all the returned buffers are used before they wait again
+  if (le_cb->le_buf_event) {
+    osEventFlagsSet(le_cb->le_buf_event, (1UL << inx));
+  }
+}
+
+/**
+ * @brief       Find a connected remote LE device in the global ble cb structure
+ * @param[in]   le_cb          - BLE control block
+ * @param[in]   remote_bd_addr - Remote device address
+ * @return      Index of the device in remote_ble_info, -1 if it is not connected
+ *
+ */
+
+int32_t rsi_ble_get_remote_dev_index(const rsi_bt_cb_t *le_cb, const uint8_t *remote_bd_addr)
+{
+  for (uint8_t inx = 0; inx < (RSI_BLE_MAX_NBR_PERIPHERALS + RSI_BLE_MAX_NBR_CENTRALS); inx++) {
+    if (le_cb->remote_ble_info[inx].used
+        && !memcmp(remote_bd_addr, le_cb->remote_ble_info[inx].remote_dev_bd_addr, RSI_DEV_ADDR_LEN)) {
+      return inx;
     }
   }
+  return -1;
 }
 
 /**
@@ -342,6 +376,9 @@ void rsi_add_remote_ble_dev_info(const rsi_ble_event_enhance_conn_status_t *remo
       le_cb->remote_ble_info[inx].avail_buf_cnt  = 1;
       le_cb->remote_ble_info[inx].mode           = 1;
       le_cb->remote_ble_info[inx].ble_buff_mutex = osMutexNew(NULL);
+      if (le_cb->le_buf_event) {
+        osEventFlagsClear(le_cb->le_buf_event, (1UL << inx));
+      }
       break;
     }
   }
@@ -375,6 +412,10 @@ void rsi_remove_remote_ble_dev_info(const rsi_ble_event_disconnect_t *remote_dev
       if (le_cb->remote_ble_info[inx].ble_buff_mutex) {
         osMutexDelete(le_cb->remote_ble_info[inx].ble_buff_mutex);
       }
+      // Wake up the senders waiting for buffers of this device, their next command fails as not connected
+      if (le_cb->le_buf_event) {
+        osEventFlagsSet(le_cb->le_buf_event, (1UL << inx));
+      }
       break;
     }
   }
@@ -421,6 +462,11 @@ int32_t rsi_driver_process_bt_resp(
   // Get Status
   status = rsi_bytes2R_to_uint16(host_desc + RSI_BT_STATUS_OFFSET);
 
+  // Responses of asynchronous commands were sent before any command still waiting in rsi_bt_driver_send_cmd()
+  if (rsi_ble_complete_async_cmd(bt_cb, rsp_type, status, payload, payload_length)) {
+    return status;
+  }
+
   // Check bt_cb for any task is waiting for response
   if (bt_cb->expected_response_type == rsp_type) {
     // Update the status in bt_cb
@@ -583,6 +629,26 @@ int8_t rsi_bt_cb_init(rsi_bt_cb_t *bt_cb, uint16_t protocol_type)
   osSemaphoreRelease(bt_cb->bt_cmd_sem);
   bt_cb->app_buffer = 0;
 
+  // Create the LE buffer availability event flags and the asynchronous command window
+  bt_cb->le_buf_event    = NULL;
+  bt_cb->async_cmd_sem   = NULL;
+  bt_cb->async_cmd_mutex = NULL;
+  memset(bt_cb->async_cmd, 0, sizeof(bt_cb->async_cmd));
+  if (protocol_type == RSI_PROTO_BLE) {
+    bt_cb->le_buf_event = osEventFlagsNew(NULL);
+    if (bt_cb->le_buf_event == NULL) {
+      retval = RSI_ERROR_SEMAPHORE_CREATE_FAILED;
+    }
+    bt_cb->async_cmd_sem = osSemaphoreNew(RSI_BLE_MAX_ASYNC_CMDS, RSI_BLE_MAX_ASYNC_CMDS, NULL);
+    if (bt_cb->async_cmd_sem == NULL) {
+      retval = RSI_ERROR_SEMAPHORE_CREATE_FAILED;
+    }
+    bt_cb->async_cmd_mutex = osMutexNew(NULL);
+    if (bt_cb->async_cmd_mutex == NULL) {
+      retval = RSI_ERROR_SEMAPHORE_CREATE_FAILED;
+    }
+  }
+
   return retval;
 }
 
@@ -2105,11 +2171,8 @@ int32_t rsi_bt_driver_send_cmd(uint16_t cmd, void *cmd_struct, void *resp)
 {
 
   SL_PRINTF(SL_RSI_BT_SEND_CMD_TRIGGER, BLUETOOTH, LOG_INFO, "COMMAND: %2x", cmd);
-  uint16_t payload_size         = 0;
   uint16_t protocol_type        = 0;
   int32_t status                = RSI_SUCCESS;
-  sl_wifi_system_packet_t *pkt  = NULL;
-  uint8_t *host_desc            = NULL;
   rsi_bt_cb_t *bt_cb            = NULL;
   uint32_t calculate_timeout_ms = 0;
 
@@ -2149,17 +2212,85 @@ int32_t rsi_bt_driver_send_cmd(uint16_t cmd, void *cmd_struct, void *resp)
     return RSI_ERROR_BT_BLE_CMD_IN_PROGRESS;
   }
 
-  // Allocate command buffer from ble pool
-  status = sli_si91x_allocate_command_buffer(&buffer,
-                                             (void **)&pkt,
-                                             sizeof(sl_wifi_system_packet_t) + RSI_BT_COMMON_CMD_LEN,
-                                             calculate_timeout_ms);
-  // If allocation of packet fails
-  if (pkt == NULL) {
+  bt_cb->sync_rsp = 1;
+
+  status = rsi_bt_prepare_cmd_buffer(&cmd, cmd_struct, bt_cb, protocol_type, calculate_timeout_ms, &buffer);
+  if (status != RSI_SUCCESS) {
     osSemaphoreRelease(bt_cb->bt_cmd_sem);
+    return status;
+  }
+
+  // Save expected response type
+  bt_cb->expected_response_type = cmd;
+
+  // Save expected response type
+  bt_cb->expected_response_buffer = resp;
 
+  if (cmd == RSI_BLE_ONLY_OPER_MODE) {
+    // Save expected response type
+    bt_cb->expected_response_type = RSI_BT_EVENT_CARD_READY;
+    bt_cb->sync_rsp               = 1;
+  }
+
+  sli_si91x_driver_send_bt_command(cmd, SLI_SI91X_BT_CMD, buffer, bt_cb->sync_rsp);
+
+  if (bt_cb->bt_sem == NULL || (osSemaphoreAcquire(bt_cb->bt_sem, calculate_timeout_ms) != osOK)) {
+    rsi_bt_set_status(bt_cb, RSI_ERROR_RESPONSE_TIMEOUT);
+    SL_PRINTF(SL_RSI_SEMAPHORE_TIMEOUT,
+              BLUETOOTH,
+              LOG_ERROR,
+              " Command: %2x , Calculate_timeout_ms: %4x",
+              cmd,
+              calculate_timeout_ms);
+  }
+  // Get command response status
+  status = rsi_bt_get_status(bt_cb);
+
+  SL_PRINTF(SL_RSI_BT_COMMAND_RESPONSE_STATUS, BLUETOOTH, LOG_INFO, "STATUS: %4x", status);
+  // Clear sync rsp variable
+  bt_cb->sync_rsp = 0;
+
+  // Post the semaphore which is waiting on driver_send API
+  osSemaphoreRelease(bt_cb->bt_cmd_sem);
+
+  // Return status
+  return status;
+}
+
+/**
+ * @brief       Allocate a command buffer and fill it with the command
+ * @param[in,out] cmd         - Type of the command to send, updated with the type of its response
+ * @param[in]   cmd_struct    - Pointer of the packet structure to send
+ * @param[in]   bt_cb         - BT control block of the command
+ * @param[in]   protocol_type - Protocol type of the command
+ * @param[in]   timeout_ms    - Maximum time to wait for a command buffer, in milliseconds
+ * @param[out]  buffer        - Command buffer ready to be sent, only on success
+ * @return      0              - Success \n
+ *              Non-Zero Value - Failure
+ */
+
+int32_t rsi_bt_prepare_cmd_buffer(uint16_t *cmd,
+                                  void *cmd_struct,
+                                  rsi_bt_cb_t *bt_cb,
+                                  uint16_t protocol_type,
+                                  uint32_t timeout_ms,
+                                  sl_wifi_buffer_t **buffer)
+{
+  uint16_t payload_size        = 0;
+  int32_t status               = RSI_SUCCESS;
+  sl_wifi_system_packet_t *pkt = NULL;
+  uint8_t *host_desc           = NULL;
+
+  // Allocate command buffer from ble pool
+  sl_status_t allocation_status = sli_si91x_allocate_command_buffer(buffer,
+                                                                    (void **)&pkt,
+                                                                    sizeof(sl_wifi_system_packet_t)
+                                                                      + RSI_BT_COMMON_CMD_LEN,
+                                                                    timeout_ms);
+  // If allocation of packet fails
+  if ((allocation_status != SL_STATUS_OK) || (pkt == NULL)) {
     // Return packet allocation failure error
-    SL_PRINTF(SL_RSI_ERROR_PKT_ALLOCATION_FAILURE, BLUETOOTH, LOG_ERROR, "COMMAND: %2x", cmd);
+    SL_PRINTF(SL_RSI_ERROR_PKT_ALLOCATION_FAILURE, BLUETOOTH, LOG_ERROR, "COMMAND: %2x", *cmd);
 
     return RSI_ERROR_PKT_ALLOCATION_FAILURE;
   }
@@ -2170,24 +2301,20 @@ int32_t rsi_bt_driver_send_cmd(uint16_t cmd, void *cmd_struct, void *resp)
   // Get host descriptor pointer
   host_desc = (pkt->desc);
 
-  bt_cb->sync_rsp = 1;
-  payload_size    = 0;
-
   if (protocol_type == RSI_PROTO_BT_COMMON) {
     // Memset data
     memset(pkt->data, 0, (RSI_BT_COMMON_CMD_LEN - sizeof(sl_wifi_system_packet_t)));
-    payload_size = rsi_bt_prepare_common_pkt(cmd, cmd_struct, pkt);
+    payload_size = rsi_bt_prepare_common_pkt(*cmd, cmd_struct, pkt);
   } else if (protocol_type == RSI_PROTO_BLE) {
-    // Memset data
-    memset(pkt->data, 0, (RSI_BLE_CMD_LEN - sizeof(sl_wifi_system_packet_t)));
-    payload_size = rsi_bt_prepare_le_pkt(cmd, cmd_struct, pkt);
-    if (cmd == RSI_BLE_REQ_CONN_ENHANCE) {
-      cmd = RSI_BLE_REQ_CONN;
+    // Every LE command copies its whole payload, only payload_size bytes are sent, so the data is not cleared
+    payload_size = rsi_bt_prepare_le_pkt(*cmd, cmd_struct, pkt);
+    if (*cmd == RSI_BLE_REQ_CONN_ENHANCE) {
+      *cmd = RSI_BLE_REQ_CONN;
     }
   }
 
   if (bt_cb->buf_status || bt_cb->cmd_status || (bt_cb->state & RSI_BLE_CHECK_CMD)) {
-    sli_si91x_host_free_buffer(buffer);
+    sli_si91x_host_free_buffer(*buffer);
 
     if (bt_cb->buf_status == SI_LE_BUFFER_IN_PROGRESS) {
       status = RSI_ERROR_BLE_DEV_BUF_IS_IN_PROGRESS;
@@ -2207,54 +2334,345 @@ int32_t rsi_bt_driver_send_cmd(uint16_t cmd, void *cmd_struct, void *resp)
 
     bt_cb->buf_status = SI_LE_BUFFER_AVL;
     bt_cb->cmd_status = 0;
-    osSemaphoreRelease(bt_cb->bt_cmd_sem);
     SL_PRINTF(SL_RSI_BLE_ERROR, BLUETOOTH, LOG_ERROR, "Status: %4x", status);
 
     return status;
   }
-  if (cmd == RSI_BLE_REQ_HCI_RAW) {
+  if (*cmd == RSI_BLE_REQ_HCI_RAW) {
     host_desc[14] = *(uint8_t *)cmd_struct;
   }
 
   rsi_uint16_to_2bytes(host_desc, (payload_size & 0xFFF));
-  rsi_uint16_to_2bytes(&host_desc[2], cmd);
+  rsi_uint16_to_2bytes(&host_desc[2], *cmd);
 
-  // Save expected response type
-  bt_cb->expected_response_type = cmd;
+  return RSI_SUCCESS;
+}
 
-  // Save expected response type
-  bt_cb->expected_response_buffer = resp;
+/**
+ * @brief       Check whether a command can be sent with rsi_ble_driver_send_cmd_async(). It must be a BLE command
+ *              completed by its own response, and must not change the driver state when the response is received.
+ * @param[in]   cmd - Type of the command
+ * @return      1 - Supported \n
+ *              0 - Not supported
+ */
 
-  if (cmd == RSI_BLE_ONLY_OPER_MODE) {
-    // Save expected response type
-    bt_cb->expected_response_type = RSI_BT_EVENT_CARD_READY;
-    bt_cb->sync_rsp               = 1;
+uint8_t rsi_ble_async_cmd_supported(uint16_t cmd)
+{
+  switch (cmd) {
+    // Completed on the transmission, not on a response
+    case RSI_BLE_REQ_HCI_RAW:
+    case RSI_BLE_REQ_PROFILES:
+    case RSI_BLE_REQ_PROFILE:
+    case RSI_BLE_REQ_CHAR_SERVICES:
+    case RSI_BLE_REQ_INC_SERVICES:
+    case RSI_BLE_REQ_READ_BY_UUID:
+    case RSI_BLE_REQ_DESC:
+    case RSI_BLE_REQ_READ_VAL:
+    case RSI_BLE_REQ_MULTIPLE_READ:
+    case RSI_BLE_REQ_LONG_READ:
+    case RSI_BLE_REQ_WRITE:
+    case RSI_BLE_REQ_LONG_WRITE:
+    case RSI_BLE_REQ_PREPARE_WRITE:
+    case RSI_BLE_REQ_EXECUTE_WRITE:
+    // The response updates the driver state
+    case RSI_BLE_ONLY_OPER_MODE:
+    case RSI_BLE_CMD_SET_WWO_RESP_NOTIFY_BUF_INFO:
+      return 0;
+    default:
+      return 1;
   }
+}
 
-  sli_si91x_driver_send_bt_command(cmd, SLI_SI91X_BT_CMD, buffer, bt_cb->sync_rsp);
+/**
+ * @brief       Complete the oldest asynchronous command of the response type, if any
+ * @param[in]   bt_cb          - BT control block
+ * @param[in]   rsp_type       - Response type
+ * @param[in]   status         - Response status
+ * @param[in]   payload        - Response payload
+ * @param[in]   payload_length - Response payload length
+ * @return      1 - The response belonged to an asynchronous command \n
+ *              0 - No asynchronous command of this type
+ */
 
-  if (bt_cb->bt_sem == NULL || (osSemaphoreAcquire(bt_cb->bt_sem, calculate_timeout_ms) != osOK)) {
-    rsi_bt_set_status(bt_cb, RSI_ERROR_RESPONSE_TIMEOUT);
-    SL_PRINTF(SL_RSI_SEMAPHORE_TIMEOUT,
-              BLUETOOTH,
-              LOG_ERROR,
-              " Command: %2x , Calculate_timeout_ms: %4x",
-              cmd,
-              calculate_timeout_ms);
+uint8_t rsi_ble_complete_async_cmd(rsi_bt_cb_t *bt_cb,
+                                   uint16_t rsp_type,
+                                   int32_t status,
+                                   const uint8_t *payload,
+                                   uint16_t payload_length)
+{
+  rsi_ble_async_cmd_t *async_cmd     = NULL;
+  rsi_ble_cmd_complete_cb_t callback = NULL;
+  void *context                      = NULL;
+
+  if ((bt_cb->async_cmd_sem == NULL) || (bt_cb->async_cmd_mutex == NULL)) {
+    return 0;
+  }
+  osMutexAcquire(bt_cb->async_cmd_mutex, osWaitForever);
+  for (uint8_t inx = 0; inx < RSI_BLE_MAX_ASYNC_CMDS; inx++) {
+    if (bt_cb->async_cmd[inx].used && (bt_cb->async_cmd[inx].cmd == rsp_type)
+        && ((async_cmd == NULL) || ((int32_t)(bt_cb->async_cmd[inx].seq - async_cmd->seq) < 0))) {
+      async_cmd = &bt_cb->async_cmd[inx];
+    }
+  }
+  if (async_cmd == NULL) {
+    osMutexRelease(bt_cb->async_cmd_mutex);
+    // Commands of other types may have gone past their deadline meanwhile
+    rsi_ble_expire_async_cmds(bt_cb, 0);
+    return 0;
   }
-  // Get command response status
-  status = rsi_bt_get_status(bt_cb);
 
-  SL_PRINTF(SL_RSI_BT_COMMAND_RESPONSE_STATUS, BLUETOOTH, LOG_INFO, "STATUS: %4x", status);
-  // Clear sync rsp variable
-  bt_cb->sync_rsp = 0;
+  //To not allow BT SetAddress after these states are triggered
+  if ((status == RSI_SUCCESS)
+      && (rsp_type == RSI_BLE_REQ_ADV || rsp_type == RSI_BLE_REQ_SCAN || rsp_type == RSI_BLE_REQ_CONN)) {
+    rsi_driver_cb->bt_common_cb->state = RSI_BT_STATE_NONE;
+  }
+
+  // Free the entry before calling back, so that the callback can send the next command
+  callback        = async_cmd->callback;
+  context         = async_cmd->context;
+  async_cmd->used = 0;
+  osMutexRelease(bt_cb->async_cmd_mutex);
+  osSemaphoreRelease(bt_cb->async_cmd_sem);
+
+  if (callback != NULL) {
+    callback(rsp_type, status, payload, payload_length, context);
+  }
+  rsi_ble_expire_async_cmds(bt_cb, 0);
+  return 1;
+}
+
+/**
+ * @brief       Complete with RSI_ERROR_RESPONSE_TIMEOUT the asynchronous commands whose deadline has passed
+ * @param[in]   bt_cb        - BT control block
+ * @param[in]   expire_all   - 1 to complete every waiting command regardless of its deadline, used on deinit
+ * @return      Time in milliseconds until the next deadline, osWaitForever if no command is waiting
+ */
+
+uint32_t rsi_ble_expire_async_cmds(rsi_bt_cb_t *bt_cb, uint8_t expire_all)
+{
+  uint32_t next_deadline_ms = osWaitForever;
+
+  if ((bt_cb == NULL) || (bt_cb->async_cmd_sem == NULL) || (bt_cb->async_cmd_mutex == NULL)) {
+    return next_deadline_ms;
+  }
+
+  for (uint8_t inx = 0; inx < RSI_BLE_MAX_ASYNC_CMDS; inx++) {
+    rsi_ble_async_cmd_t *async_cmd     = &bt_cb->async_cmd[inx];
+    rsi_ble_cmd_complete_cb_t callback = NULL;
+    void *context                      = NULL;
+    uint16_t cmd                       = 0;
+    uint8_t expired                    = 0;
+
+    osMutexAcquire(bt_cb->async_cmd_mutex, osWaitForever);
+    if (async_cmd->used) {
+      int32_t remaining_ms = (int32_t)(async_cmd->deadline - osKernelGetTickCount());
+      if (expire_all || (remaining_ms <= 0)) {
+        cmd             = async_cmd->cmd;
+        callback        = async_cmd->callback;
+        context         = async_cmd->context;
+        async_cmd->used = 0;
+        expired         = 1;
+      } else if ((uint32_t)remaining_ms < next_deadline_ms) {
+        next_deadline_ms = (uint32_t)remaining_ms;
+      }
+    }
+    osMutexRelease(bt_cb->async_cmd_mutex);
+
+    if (expired) {
+      osSemaphoreRelease(bt_cb->async_cmd_sem);
+      if (callback != NULL) {
+        callback(cmd, RSI_ERROR_RESPONSE_TIMEOUT, NULL, 0, context);
+      }
+    }
+  }
+  return next_deadline_ms;
+}
+
+/**
+ * @brief       Take a free entry of the asynchronous command window, expiring the commands whose deadline passes
+ *              while waiting
+ * @param[in]   bt_cb        - BT control block
+ * @param[in]   start        - Kernel tick the wait started at
+ * @param[in]   timeout_ms   - Maximum time to wait from start, in milliseconds
+ * @return      1 - An entry was taken \n
+ *              0 - Timeout
+ */
+
+static uint8_t rsi_ble_take_async_cmd_entry(rsi_bt_cb_t *bt_cb, uint32_t start, uint32_t timeout_ms)
+{
+  uint32_t next_deadline_ms = rsi_ble_expire_async_cmds(bt_cb, 0);
+  uint32_t elapsed          = 0;
+  uint32_t wait_ms          = 0;
+
+  while (1) {
+    elapsed = osKernelGetTickCount() - start;
+    wait_ms = (elapsed < timeout_ms) ? (timeout_ms - elapsed) : 0;
+    if (next_deadline_ms < wait_ms) {
+      wait_ms = next_deadline_ms;
+    }
+    if (osSemaphoreAcquire(bt_cb->async_cmd_sem, wait_ms) == osOK) {
+      return 1;
+    }
+    if ((osKernelGetTickCount() - start) >= timeout_ms) {
+      return 0;
+    }
+    next_deadline_ms = rsi_ble_expire_async_cmds(bt_cb, 0);
+  }
+}
+
+/**
+ * @brief       Send a BLE command without waiting for its response. Up to RSI_BLE_MAX_ASYNC_CMDS commands are in
+ *              flight, and the callback is called from the driver RX thread when the response is received, or with
+ *              RSI_ERROR_RESPONSE_TIMEOUT if none is received within the command timeout. See
+ *              rsi_ble_cmd_complete_cb_t for the restrictions on the callback.
+ *              Commands that are completed on the transmission or that change the driver state on their response
+ *              must be sent with rsi_bt_driver_send_cmd().
+ * @param[in]   cmd          - Type of the command to send
+ * @param[in]   cmd_struct   - Pointer of the packet structure to send, copied before this function returns
+ * @param[in]   callback     - Function called with the response status and payload, can be NULL
+ * @param[in]   context      - Context given to the callback
+ * @return      0              - Success, the callback is called when the response is received \n
+ *              -2             - The command cannot be sent asynchronously (RSI_ERROR_INVALID_PARAM) \n
+ *              Non-Zero Value - Failure, the command is not sent and the callback is not called
+ */
+
+int32_t rsi_ble_driver_send_cmd_async(uint16_t cmd,
+                                      void *cmd_struct,
+                                      rsi_ble_cmd_complete_cb_t callback,
+                                      void *context)
+{
+  uint16_t protocol_type         = 0;
+  int32_t status                 = RSI_SUCCESS;
+  rsi_bt_cb_t *bt_cb             = NULL;
+  uint32_t calculate_timeout_ms  = 0;
+  sl_wifi_buffer_t *buffer       = NULL;
+  rsi_ble_async_cmd_t *async_cmd = NULL;
+
+  protocol_type = rsi_bt_get_proto_type(cmd, &bt_cb);
+  if ((protocol_type != RSI_PROTO_BLE) || !rsi_ble_async_cmd_supported(cmd)) {
+    return RSI_ERROR_INVALID_PARAM;
+  }
+
+  // Wait for a free entry in the window, then for the commands being prepared or waiting for a sync response
+  calculate_timeout_ms = rsi_bt_get_timeout(cmd, protocol_type);
+  if ((bt_cb->async_cmd_sem == NULL) || (bt_cb->async_cmd_mutex == NULL)
+      || !rsi_ble_take_async_cmd_entry(bt_cb, osKernelGetTickCount(), calculate_timeout_ms)) {
+    return RSI_ERROR_BT_BLE_CMD_IN_PROGRESS;
+  }
+  if (bt_cb->bt_cmd_sem == NULL || (osSemaphoreAcquire(bt_cb->bt_cmd_sem, calculate_timeout_ms) != osOK)) {
+    osSemaphoreRelease(bt_cb->async_cmd_sem);
+    return RSI_ERROR_BT_BLE_CMD_IN_PROGRESS;
+  }
+
+  status = rsi_bt_prepare_cmd_buffer(&cmd, cmd_struct, bt_cb, protocol_type, calculate_timeout_ms, &buffer);
+  if (status != RSI_SUCCESS) {
+    osSemaphoreRelease(bt_cb->bt_cmd_sem);
+    osSemaphoreRelease(bt_cb->async_cmd_sem);
+    return status;
+  }
+
+  // The entry is added before sending, the response can be received before sli_si91x_driver_send_bt_command returns
+  osMutexAcquire(bt_cb->async_cmd_mutex, osWaitForever);
+  for (uint8_t inx = 0; inx < RSI_BLE_MAX_ASYNC_CMDS; inx++) {
+    if (!bt_cb->async_cmd[inx].used) {
+      async_cmd = &bt_cb->async_cmd[inx];
+      break;
+    }
+  }
+  async_cmd->cmd      = cmd;
+  async_cmd->seq      = bt_cb->async_cmd_seq++;
+  async_cmd->deadline = osKernelGetTickCount() + calculate_timeout_ms;
+  async_cmd->callback = callback;
+  async_cmd->context  = context;
+  async_cmd->used     = 1;
+  osMutexRelease(bt_cb->async_cmd_mutex);
+
+  // Tagged so that its TX done does not release bt_sem, which belongs to the synchronous commands
+  sli_si91x_driver_send_bt_command(cmd, SLI_SI91X_BT_CMD, buffer, SLI_SI91X_BT_COMMAND_WITH_CALLBACK);
 
-  // Post the semaphore which is waiting on driver_send API
   osSemaphoreRelease(bt_cb->bt_cmd_sem);
 
-  // Return status
+  return RSI_SUCCESS;
+}
+
+/**
+ * @brief       Wait for the responses of all the commands sent with rsi_ble_driver_send_cmd_async()
+ * @param[in]   timeout_ms   - Maximum time to wait, in milliseconds
+ * @return      0              - Success \n
+ *              Non-Zero Value - Failure
+ */
+
+int32_t rsi_ble_driver_wait_async_cmds(uint32_t timeout_ms)
+{
+  rsi_bt_cb_t *le_cb = rsi_driver_cb->ble_cb;
+  uint32_t start     = osKernelGetTickCount();
+  uint8_t acquired   = 0;
+  int32_t status     = RSI_SUCCESS;
+
+  if ((le_cb->async_cmd_sem == NULL) || (le_cb->async_cmd_mutex == NULL)) {
+    return RSI_ERROR_INVALID_PARAM;
+  }
+
+  // All the entries are free once every entry of the window can be taken
+  while (acquired < RSI_BLE_MAX_ASYNC_CMDS) {
+    if (!rsi_ble_take_async_cmd_entry(le_cb, start, timeout_ms)) {
+      status = RSI_ERROR_RESPONSE_TIMEOUT;
+      break;
+    }
+    acquired++;
+  }
+  while (acquired > 0) {
+    osSemaphoreRelease(le_cb->async_cmd_sem);
+    acquired--;
+  }
+
   return status;
 }
+
+/**
+ * @brief       Send a command that uses an LE buffer of the remote device (notification or write without response),
+ *              waiting for the buffers to be given back by the module instead of failing when none is available.
+ * @param[in]   cmd          - Type of the command to send
+ * @param[in]   cmd_struct   - Pointer of the packet structure to send, starting with the remote device address
+ * @param[in]   timeout_ms   - Maximum time to wait for a buffer, in milliseconds
+ * @return      0              - Success \n
+ *              -31            - No buffer was given back within timeout_ms (RSI_ERROR_BLE_DEV_BUF_FULL) \n
+ *              Non-Zero Value - Failure
+ */
+
+int32_t rsi_ble_driver_send_cmd_wait_buf(uint16_t cmd, void *cmd_struct, uint32_t timeout_ms)
+{
+  rsi_bt_cb_t *le_cb = rsi_driver_cb->ble_cb;
+  uint32_t start     = osKernelGetTickCount();
+  uint32_t elapsed   = 0;
+  uint32_t flag      = 0;
+  int32_t status     = RSI_SUCCESS;
+  int32_t inx;
+
+  while (1) {
+    inx = rsi_ble_get_remote_dev_index(le_cb, (const uint8_t *)cmd_struct);
+    if ((inx < 0) || (le_cb->le_buf_event == NULL)) {
+      // Not connected, the module returns the error
+      return rsi_bt_driver_send_cmd(cmd, cmd_struct, NULL);
+    }
+    flag = (1UL << inx);
+
+    // Cleared before checking the buffers, so that buffers given back from now on wake up the wait below
+    osEventFlagsClear(le_cb->le_buf_event, flag);
+    if (le_cb->remote_ble_info[inx].avail_buf_cnt != 0) {
+      status = rsi_bt_driver_send_cmd(cmd, cmd_struct, NULL);
+      if (status != RSI_ERROR_BLE_DEV_BUF_FULL) {
+        return status;
+      }
+    }
+
+    elapsed = osKernelGetTickCount() - start;
+    if (elapsed >= timeout_ms) {
+      return RSI_ERROR_BLE_DEV_BUF_FULL;
+    }
+    osEventFlagsWait(le_cb->le_buf_event, flag, osFlagsWaitAny | osFlagsNoClear, timeout_ms - elapsed);
+  }
+}
 /** @} */
 
 /*==============================================*/
@@ -204,6 +204,24 @@ int32_t rsi_ble_driver_deinit(void)
     osSemaphoreDelete(rsi_driver_cb->ble_cb->bt_sem);
   }
 
+  if (rsi_driver_cb->ble_cb->le_buf_event) {
+    osEventFlagsDelete(rsi_driver_cb->ble_cb->le_buf_event);
+    rsi_driver_cb->ble_cb->le_buf_event = NULL;
+  }
+
+  // Commands still waiting for their response will not get one, complete them before the window goes away
+  rsi_ble_expire_async_cmds(rsi_driver_cb->ble_cb, 1);
+
+  if (rsi_driver_cb->ble_cb->async_cmd_mutex) {
+    osMutexDelete(rsi_driver_cb->ble_cb->async_cmd_mutex);
+    rsi_driver_cb->ble_cb->async_cmd_mutex = NULL;
+  }
+
+  if (rsi_driver_cb->ble_cb->async_cmd_sem) {
+    osSemaphoreDelete(rsi_driver_cb->ble_cb->async_cmd_sem);
+    rsi_driver_cb->ble_cb->async_cmd_sem = NULL;
+  }
+
   rsi_driver_cb->device_state = RSI_DEVICE_STATE_NONE;
   SL_PRINTF(SL_DRIVER_DEINIT_SEMAPHORE_DESTROY_FAILED_26, COMMON, LOG_INFO);
   return RSI_SUCCESS;
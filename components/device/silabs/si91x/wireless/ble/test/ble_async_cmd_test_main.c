@@ -0,0 +1,167 @@
+/***************************************************************************/
+/**
+ * @file ble_async_cmd_test_main.c
+ * @brief BLE asynchronous command Unity Test Functions
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * The licensor of this software is Silicon Laboratories Inc. Your use of this
+ * software is governed by the terms of Silicon Labs Master Software License
+ * Agreement (MSLA) available at
+ * www.silabs.com/about-us/legal/master-software-license-agreement. This
+ * software is distributed to you in Source Code format and is governed by the
+ * sections of the MSLA applicable to Source Code.
+ *
+ ******************************************************************************/
+#include <string.h>
+#include "sl_wifi.h"
+#include "sl_wifi_callback_framework.h"
+#include "cmsis_os2.h"
+#include "rsi_ble.h"
+#include "rsi_ble_apis.h"
+#include "rsi_bt_common.h"
+#include "rsi_bt_common_apis.h"
+#include "rsi_common_apis.h"
+#include "unity.h"
+
+/*******************************************************************************
+ ***************************  Defines / Macros  ********************************
+ ******************************************************************************/
+#define ASYNC_CMD_WAIT_MS 2000 // Maximum wait for the asynchronous commands to complete
+
+/*******************************************************************************
+ ***************************  Local Variables   *******************************
+ ******************************************************************************/
+static const sl_wifi_device_configuration_t config = {
+  .boot_option = LOAD_NWP_FW,
+  .mac_address = NULL,
+  .band        = SL_SI91X_WIFI_BAND_2_4GHZ,
+  .region_code = US,
+  .boot_config = { .oper_mode                  = SL_SI91X_CLIENT_MODE,
+                   .coex_mode                  = SL_SI91X_BLE_MODE,
+                   .feature_bit_map            = SL_SI91X_FEAT_SECURITY_OPEN,
+                   .tcp_ip_feature_bit_map     = SL_SI91X_TCP_IP_FEAT_EXTENSION_VALID,
+                   .custom_feature_bit_map     = SL_SI91X_CUSTOM_FEAT_EXTENTION_VALID,
+                   .ext_custom_feature_bit_map = SL_SI91X_EXT_FEAT_BT_CUSTOM_FEAT_ENABLE,
+                   .bt_feature_bit_map         = (SL_SI91X_BT_RF_TYPE | SL_SI91X_ENABLE_BLE_PROTOCOL),
+                   .ext_tcp_ip_feature_bit_map = SL_SI91X_CONFIG_FEAT_EXTENTION_VALID,
+                   .ble_feature_bit_map        = SL_SI91X_FEAT_BLE_CUSTOM_FEAT_EXTENTION_VALID,
+                   .ble_ext_feature_bit_map    = 0,
+                   .config_feature_bit_map     = 0 }
+};
+
+static const osThreadAttr_t test_thread_attributes = {
+  .name       = "ble_async_cmd_test",
+  .stack_size = 3072,
+  .priority   = osPriorityNormal,
+};
+
+static volatile uint8_t async_cmd_completions = 0;
+static volatile int32_t async_cmd_status      = -1;
+
+/*******************************************************************************
+ ************************  Test Function Prototypes  ****************************
+ ******************************************************************************/
+void test_ble_async_cmd_init(void);
+void test_ble_async_cmd_then_sync_cmd(void);
+
+/*******************************************************************************
+ ************************  Static Function Prototypes   ************************
+ ******************************************************************************/
+static void test_thread(void *argument);
+static void async_cmd_done(uint16_t cmd, int32_t status, const uint8_t *resp, uint16_t resp_length, void *context);
+
+/******************************************************************************
+ * Main function in which all the test cases are tested using unity framework
+ ******************************************************************************/
+int app_init()
+{
+  osThreadNew((osThreadFunc_t)test_thread, NULL, &test_thread_attributes);
+  return 0;
+}
+
+static void test_thread(void *argument)
+{
+  UNUSED_PARAMETER(argument);
+  UnityBeginGroup("BLE async commands");
+
+  RUN_TEST(test_ble_async_cmd_init, __LINE__);
+  RUN_TEST(test_ble_async_cmd_then_sync_cmd, __LINE__);
+
+  UnityEnd();
+  UnityPrintf("END");
+  while (1) {
+  }
+}
+
+static void async_cmd_done(uint16_t cmd, int32_t status, const uint8_t *resp, uint16_t resp_length, void *context)
+{
+  UNUSED_PARAMETER(cmd);
+  UNUSED_PARAMETER(resp);
+  UNUSED_PARAMETER(resp_length);
+  UNUSED_PARAMETER(context);
+  async_cmd_status = status;
+  async_cmd_completions++;
+}
+
+/*******************************************************************************
+ * Function to test the initialization of the device in BLE mode
+ ******************************************************************************/
+void test_ble_async_cmd_init(void)
+{
+  UnityPrintf("\n");
+  UnityPrintf("Testing BLE init \n");
+  sl_status_t status;
+
+  status = sl_wifi_init(&config, NULL, sl_wifi_default_event_handler);
+  TEST_ASSERT_EQUAL_HEX(SL_STATUS_OK, status);
+
+  UnityPrintf("BLE init test completed successfully \n");
+}
+
+/*******************************************************************************
+ * Function to test a synchronous command sent while an asynchronous command is
+ * in flight. The synchronous command must wait for its own response and get
+ * its payload before returning, the TX done of the asynchronous command must
+ * not release it early.
+ ******************************************************************************/
+void test_ble_async_cmd_then_sync_cmd(void)
+{
+  UnityPrintf("\n");
+  UnityPrintf("Testing BLE async command followed by a sync command \n");
+  rsi_ble_req_adv_data_t adv_data = { 0 };
+  uint8_t expected_addr[RSI_DEV_ADDR_LEN];
+  uint8_t local_addr[RSI_DEV_ADDR_LEN];
+  int32_t status;
+
+  // Reference address, read without any asynchronous command in flight
+  status = rsi_bt_get_local_device_address(expected_addr);
+  TEST_ASSERT_EQUAL_HEX(RSI_SUCCESS, status);
+
+  for (uint8_t iteration = 0; iteration < RSI_BLE_MAX_ASYNC_CMDS; iteration++) {
+    async_cmd_completions = 0;
+    async_cmd_status      = -1;
+    memset(local_addr, 0, sizeof(local_addr));
+
+    adv_data.data_len    = 3;
+    adv_data.adv_data[0] = 2;
+    adv_data.adv_data[1] = 1;
+    adv_data.adv_data[2] = 6;
+    status = rsi_ble_driver_send_cmd_async(RSI_BLE_SET_ADVERTISE_DATA, &adv_data, async_cmd_done, NULL);
+    TEST_ASSERT_EQUAL_HEX(RSI_SUCCESS, status);
+
+    // The response must be in local_addr as soon as the call returns
+    status = rsi_bt_get_local_device_address(local_addr);
+    TEST_ASSERT_EQUAL_HEX(RSI_SUCCESS, status);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_addr, local_addr, RSI_DEV_ADDR_LEN);
+
+    status = rsi_ble_driver_wait_async_cmds(ASYNC_CMD_WAIT_MS);
+    TEST_ASSERT_EQUAL_HEX(RSI_SUCCESS, status);
+    TEST_ASSERT_EQUAL_UINT8(1, async_cmd_completions);
+    TEST_ASSERT_EQUAL_HEX(RSI_SUCCESS, async_cmd_status);
+  }
+
+  UnityPrintf("BLE async command followed by a sync command test completed successfully \n");
+}
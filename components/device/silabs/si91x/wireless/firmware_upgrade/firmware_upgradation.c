@@ -34,6 +34,8 @@
 #include "sl_si91x_driver.h"
 #include <string.h>
 #include "firmware_upgradation.h"
+#include "sl_rsi_utility.h"
+#include "cmsis_os2.h"
 #ifdef SLI_SI91X_OFFLOAD_NETWORK_STACK
 #include "sl_si91x_socket_utility.h"
 #endif
@@ -47,11 +49,38 @@
 
 #define IP_VERSION_6 BIT(1)
 
+#ifndef SL_SI91X_FWUP_PIPELINE_THREAD_PRIORITY
+#define SL_SI91X_FWUP_PIPELINE_THREAD_PRIORITY osPriorityNormal
+#endif
+
+#ifndef SL_SI91X_FWUP_PIPELINE_THREAD_STACK_SIZE
+#define SL_SI91X_FWUP_PIPELINE_THREAD_STACK_SIZE 1536
+#endif
+
 /******************************************************
  *                 Global Variables
  ******************************************************/
 extern bool device_initialized;
 
+/// State of the pipelined firmware upgrade engine
+typedef struct {
+  sli_si91x_req_fwup_t slots[SL_SI91X_FWUP_PIPELINE_DEPTH]; ///< Chunk buffers, copied into the command when sent
+  uint8_t fill_index;                                       ///< Slot being filled by the writer
+  uint8_t send_index;                                       ///< Next slot the worker sends
+  bool fill_slot_owned;                                     ///< Writer holds a free-slot token for fill_index
+  bool active;                                              ///< Pipeline started and not yet finished
+  volatile sl_status_t status;                              ///< First error reported by the worker
+  osSemaphoreId_t free_slots;                               ///< Slots available to the writer
+  osSemaphoreId_t filled_slots;                             ///< Slots waiting to be sent
+  osSemaphoreId_t worker_done;                              ///< Released when the worker thread exits
+  sl_si91x_fwup_progress_callback_t callback;               ///< Optional progress callback
+  void *callback_context;                                   ///< Argument passed to the callback
+  sl_si91x_fwup_progress_t progress;                        ///< Progress counters
+  uint32_t start_time;                                      ///< Timestamp of sl_si91x_fwup_pipeline_start()
+} sli_si91x_fwup_pipeline_t;
+
+static sli_si91x_fwup_pipeline_t fwup_pipeline;
+
 /***************************************************************************/ /**
  * @brief  
  *   Helper function for actual APIs
@@ -114,6 +143,232 @@ sl_status_t sl_si91x_fwup_abort()
   return status;
 }
 
+static void sli_si91x_fwup_pipeline_update_progress(uint16_t length, sl_status_t status)
+{
+  sl_si91x_fwup_progress_t *progress = &fwup_pipeline.progress;
+
+  if (status == SL_STATUS_OK) {
+    progress->bytes_written += length;
+    progress->chunks_written++;
+  }
+  progress->status     = fwup_pipeline.status;
+  progress->elapsed_ms = sl_si91x_host_elapsed_time(fwup_pipeline.start_time);
+  if (progress->elapsed_ms != 0) {
+    progress->throughput = (uint32_t)(((uint64_t)progress->bytes_written * 1000) / progress->elapsed_ms);
+  }
+
+  if (fwup_pipeline.callback != NULL) {
+    fwup_pipeline.callback(progress, fwup_pipeline.callback_context);
+  }
+}
+
+// Sends filled slots in order. A zero-length slot marks the end of the image.
+static void sli_si91x_fwup_pipeline_thread(void *argument)
+{
+  UNUSED_PARAMETER(argument);
+  sl_status_t status;
+
+  while (1) {
+    osSemaphoreAcquire(fwup_pipeline.filled_slots, osWaitForever);
+
+    sli_si91x_req_fwup_t *slot = &fwup_pipeline.slots[fwup_pipeline.send_index];
+    uint16_t length;
+    memcpy(&length, &slot->length, sizeof(length));
+
+    if (length == 0) {
+      break;
+    }
+
+    // After the first error, keep draining slots so the writer never blocks, but stop talking to the NWP
+    if (fwup_pipeline.status == SL_STATUS_OK) {
+      status = sli_si91x_driver_send_command(SLI_WLAN_REQ_FWUP,
+                                             SLI_SI91X_WLAN_CMD,
+                                             slot,
+                                             sizeof(sli_si91x_req_fwup_t),
+                                             SL_SI91X_WAIT_FOR_RESPONSE(5000),
+                                             NULL,
+                                             NULL);
+      // The NWP reports the end of the upgrade on the last chunk
+      if (status == SL_STATUS_SI91X_FW_UPDATE_DONE) {
+        status = SL_STATUS_OK;
+      }
+      if (status != SL_STATUS_OK) {
+        fwup_pipeline.status = status;
+      }
+      sli_si91x_fwup_pipeline_update_progress(length, status);
+    }
+
+    fwup_pipeline.send_index = (uint8_t)((fwup_pipeline.send_index + 1) % SL_SI91X_FWUP_PIPELINE_DEPTH);
+    osSemaphoreRelease(fwup_pipeline.free_slots);
+  }
+
+  osSemaphoreRelease(fwup_pipeline.worker_done);
+  osThreadExit();
+}
+
+static void sli_si91x_fwup_pipeline_delete(void)
+{
+  osSemaphoreDelete(fwup_pipeline.free_slots);
+  osSemaphoreDelete(fwup_pipeline.filled_slots);
+  osSemaphoreDelete(fwup_pipeline.worker_done);
+  fwup_pipeline.free_slots   = NULL;
+  fwup_pipeline.filled_slots = NULL;
+  fwup_pipeline.worker_done  = NULL;
+  fwup_pipeline.active       = false;
+}
+
+// Hands the slot being filled to the worker
+static void sli_si91x_fwup_pipeline_commit(void)
+{
+  fwup_pipeline.fill_index      = (uint8_t)((fwup_pipeline.fill_index + 1) % SL_SI91X_FWUP_PIPELINE_DEPTH);
+  fwup_pipeline.fill_slot_owned = false;
+  osSemaphoreRelease(fwup_pipeline.filled_slots);
+}
+
+// Reserves the next free slot for the writer, waiting while all slots are in flight
+static sli_si91x_req_fwup_t *sli_si91x_fwup_pipeline_get_fill_slot(void)
+{
+  sli_si91x_req_fwup_t *slot = &fwup_pipeline.slots[fwup_pipeline.fill_index];
+
+  if (!fwup_pipeline.fill_slot_owned) {
+    osSemaphoreAcquire(fwup_pipeline.free_slots, osWaitForever);
+    fwup_pipeline.fill_slot_owned = true;
+
+    uint16_t type   = SL_FWUP_RPS_CONTENT;
+    uint16_t length = 0;
+    memcpy(&slot->type, &type, sizeof(slot->type));
+    memcpy(&slot->length, &length, sizeof(slot->length));
+  }
+  return slot;
+}
+
+sl_status_t sl_si91x_fwup_pipeline_start(const uint8_t *rps_header,
+                                         sl_si91x_fwup_progress_callback_t callback,
+                                         void *context)
+{
+  sl_status_t status;
+
+  if (!device_initialized) {
+    return SL_STATUS_NOT_INITIALIZED;
+  }
+
+  SL_VERIFY_POINTER_OR_RETURN(rps_header, SL_STATUS_NULL_POINTER);
+
+  if (fwup_pipeline.active) {
+    return SL_STATUS_INVALID_STATE;
+  }
+
+  memset(&fwup_pipeline, 0, sizeof(fwup_pipeline));
+  fwup_pipeline.callback         = callback;
+  fwup_pipeline.callback_context = context;
+  fwup_pipeline.start_time       = sl_si91x_host_get_timestamp();
+
+  // The header is validated by the NWP before any content is accepted, so it is sent synchronously
+  status = sl_si91x_fwup_start(rps_header);
+  VERIFY_STATUS_AND_RETURN(status);
+
+  fwup_pipeline.free_slots   = osSemaphoreNew(SL_SI91X_FWUP_PIPELINE_DEPTH, SL_SI91X_FWUP_PIPELINE_DEPTH, NULL);
+  fwup_pipeline.filled_slots = osSemaphoreNew(SL_SI91X_FWUP_PIPELINE_DEPTH, 0, NULL);
+  fwup_pipeline.worker_done  = osSemaphoreNew(1, 0, NULL);
+  if ((fwup_pipeline.free_slots == NULL) || (fwup_pipeline.filled_slots == NULL)
+      || (fwup_pipeline.worker_done == NULL)) {
+    sli_si91x_fwup_pipeline_delete();
+    return SL_STATUS_ALLOCATION_FAILED;
+  }
+
+  const osThreadAttr_t attr = {
+    .name       = "si91x_fwup_pipeline",
+    .priority   = SL_SI91X_FWUP_PIPELINE_THREAD_PRIORITY,
+    .stack_mem  = 0,
+    .stack_size = SL_SI91X_FWUP_PIPELINE_THREAD_STACK_SIZE,
+    .cb_mem     = 0,
+    .cb_size    = 0,
+    .attr_bits  = 0u,
+    .tz_module  = 0u,
+  };
+  if (osThreadNew(&sli_si91x_fwup_pipeline_thread, NULL, &attr) == NULL) {
+    sli_si91x_fwup_pipeline_delete();
+    return SL_STATUS_ALLOCATION_FAILED;
+  }
+
+  fwup_pipeline.active = true;
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_si91x_fwup_pipeline_write(const uint8_t *content, uint32_t length)
+{
+  if (!fwup_pipeline.active) {
+    return SL_STATUS_INVALID_STATE;
+  }
+
+  SL_VERIFY_POINTER_OR_RETURN(content, SL_STATUS_NULL_POINTER);
+
+  while (length > 0) {
+    // Report a failed chunk as soon as possible so the caller can stop downloading
+    if (fwup_pipeline.status != SL_STATUS_OK) {
+      return fwup_pipeline.status;
+    }
+
+    sli_si91x_req_fwup_t *slot = sli_si91x_fwup_pipeline_get_fill_slot();
+    uint16_t slot_length;
+    memcpy(&slot_length, &slot->length, sizeof(slot_length));
+
+    uint16_t copy_length = (uint16_t)MIN(length, (uint32_t)(SLI_MAX_FWUP_CHUNK_SIZE - slot_length));
+    memcpy(&slot->content[slot_length], content, copy_length);
+    slot_length = (uint16_t)(slot_length + copy_length);
+    memcpy(&slot->length, &slot_length, sizeof(slot->length));
+
+    content += copy_length;
+    length -= copy_length;
+
+    // Only full chunks are sent here; a partial chunk waits for more data or sl_si91x_fwup_pipeline_finish()
+    if (slot_length == SLI_MAX_FWUP_CHUNK_SIZE) {
+      sli_si91x_fwup_pipeline_commit();
+    }
+  }
+
+  return fwup_pipeline.status;
+}
+
+sl_status_t sl_si91x_fwup_pipeline_finish(sl_si91x_fwup_progress_t *progress)
+{
+  sl_status_t status;
+
+  if (!fwup_pipeline.active) {
+    return SL_STATUS_INVALID_STATE;
+  }
+
+  // Send the last partial chunk, if any
+  if (fwup_pipeline.fill_slot_owned) {
+    uint16_t slot_length;
+    memcpy(&slot_length, &fwup_pipeline.slots[fwup_pipeline.fill_index].length, sizeof(slot_length));
+    if (slot_length != 0) {
+      sli_si91x_fwup_pipeline_commit();
+    }
+  }
+
+  // Queue the end marker. It is reached only after every chunk ahead of it has been sent.
+  sli_si91x_fwup_pipeline_get_fill_slot();
+  sli_si91x_fwup_pipeline_commit();
+
+  osSemaphoreAcquire(fwup_pipeline.worker_done, osWaitForever);
+
+  status = fwup_pipeline.status;
+  if (progress != NULL) {
+    *progress = fwup_pipeline.progress;
+  }
+  sli_si91x_fwup_pipeline_delete();
+  return status;
+}
+
+sl_status_t sl_si91x_fwup_pipeline_get_progress(sl_si91x_fwup_progress_t *progress)
+{
+  SL_VERIFY_POINTER_OR_RETURN(progress, SL_STATUS_NULL_POINTER);
+
+  *progress = fwup_pipeline.progress;
+  return SL_STATUS_OK;
+}
+
 #ifndef SLI_SI91X_MCU_INTERFACE /* Only for NCP mode */
 sl_status_t sl_si91x_bl_upgrade_firmware(uint8_t *firmware_image, uint32_t fw_image_size, uint8_t flags)
 {
@@ -74,6 +74,38 @@ typedef struct {
   uint8_t *user_name;       /**< Username for server authentication. */
   uint8_t *password;        /**< Password for server authentication. */
 } sl_si91x_http_otaf_params_t;
+
+/**
+ * @brief Number of firmware chunk buffers used by the pipelined firmware upgrade.
+ *
+ * @details
+ *   Each buffer holds one SLI_MAX_FWUP_CHUNK_SIZE chunk. With two buffers, the application fills one chunk while the previous one is written to flash.
+ */
+#ifndef SL_SI91X_FWUP_PIPELINE_DEPTH
+#define SL_SI91X_FWUP_PIPELINE_DEPTH 2
+#endif
+
+/**
+ * @brief Progress of a pipelined firmware upgrade.
+ */
+typedef struct {
+  uint32_t bytes_written;  /**< Firmware content bytes accepted by the NWP, excluding the RPS header. */
+  uint32_t chunks_written; /**< Number of chunks accepted by the NWP. */
+  uint32_t elapsed_ms;     /**< Time since @ref sl_si91x_fwup_pipeline_start was called, in milliseconds. */
+  uint32_t throughput;     /**< Average throughput since start, in bytes per second. */
+  sl_status_t status;      /**< First error reported by the NWP, or SL_STATUS_OK. */
+} sl_si91x_fwup_progress_t;
+
+/**
+ * @brief Callback invoked after each chunk of a pipelined firmware upgrade is processed.
+ *
+ * @details
+ *   The callback runs in the pipeline thread and must not block.
+ *
+ * @param[in] progress Current progress. Valid only during the call.
+ * @param[in] context  Context passed to @ref sl_si91x_fwup_pipeline_start.
+ */
+typedef void (*sl_si91x_fwup_progress_callback_t)(const sl_si91x_fwup_progress_t *progress, void *context);
 /** @} */
 
 /** \addtogroup SI91X_FIRMWARE_UPDATE_FROM_HOST_FUNCTIONS 
@@ -164,6 +196,92 @@ sl_status_t sl_si91x_fwup_load(const uint8_t *content, uint16_t length);
  ******************************************************************************/
 sl_status_t sl_si91x_fwup_abort(void);
 
+/***************************************************************************/ /**
+ * @brief
+ *   Start a pipelined firmware upgrade.
+ * 
+ * @details
+ *   This function sends the RPS header like @ref sl_si91x_fwup_start and then starts a worker thread that
+ *   writes firmware content to the Si91x device in the background. Content passed to
+ *   @ref sl_si91x_fwup_pipeline_write is copied into one of SL_SI91X_FWUP_PIPELINE_DEPTH chunk buffers. The
+ *   caller can then receive the next block from the network while the previous chunk is being flashed.
+ * 
+ *   The RPS header is sent synchronously. Content chunks are sent in the background.
+ * 
+ * @param[in] rps_header
+ *   Pointer to the RPS header content.
+ * 
+ * @param[in] callback
+ *   Optional @ref sl_si91x_fwup_progress_callback_t invoked after each chunk. Can be NULL.
+ * 
+ * @param[in] context
+ *   Argument passed to the callback.
+ * 
+ * @return
+ *   sl_status_t. See [Status Codes](https://docs.silabs.com/gecko-platform/latest/platform-common/status) and [WiSeConnect Status Codes](../wiseconnect-api-reference-guide-err-codes/wiseconnect-status-codes) for details.
+ * 
+ * @note
+ *   Only one pipelined firmware upgrade can run at a time. Do not mix it with @ref sl_si91x_fwup_load.
+ ******************************************************************************/
+sl_status_t sl_si91x_fwup_pipeline_start(const uint8_t *rps_header,
+                                         sl_si91x_fwup_progress_callback_t callback,
+                                         void *context);
+
+/***************************************************************************/ /**
+ * @brief
+ *   Queue firmware content for a pipelined firmware upgrade.
+ * 
+ * @details
+ *   The content can have any length. It is split into SLI_MAX_FWUP_CHUNK_SIZE chunks, which are sent in order.
+ *   A trailing partial chunk is held back until more content arrives or @ref sl_si91x_fwup_pipeline_finish is called.
+ * 
+ *   This function blocks only while all chunk buffers are in flight.
+ * 
+ * @pre Pre-conditions:
+ * - @ref sl_si91x_fwup_pipeline_start should be called before this API.
+ * 
+ * @param[in] content
+ *   Pointer to the firmware file content. It can be reused as soon as the function returns.
+ * 
+ * @param[in] length
+ *   Length of the content in bytes.
+ * 
+ * @return
+ *   sl_status_t. Returns the first error reported for an earlier chunk, so a failed upgrade can be stopped early. See [Status Codes](https://docs.silabs.com/gecko-platform/latest/platform-common/status) for details.
+ ******************************************************************************/
+sl_status_t sl_si91x_fwup_pipeline_write(const uint8_t *content, uint32_t length);
+
+/***************************************************************************/ /**
+ * @brief
+ *   Complete a pipelined firmware upgrade.
+ * 
+ * @details
+ *   This function sends any remaining content, waits until every chunk has been processed, and stops the worker thread.
+ *   On success, the device must be reset to boot the new firmware, as with @ref sl_si91x_fwup_load.
+ * 
+ * @pre Pre-conditions:
+ * - @ref sl_si91x_fwup_pipeline_start should be called before this API.
+ * 
+ * @param[out] progress
+ *   Final progress of the upgrade. Can be NULL.
+ * 
+ * @return
+ *   sl_status_t. SL_STATUS_OK if every chunk was accepted, including the last one the NWP answers with SL_STATUS_SI91X_FW_UPDATE_DONE, otherwise the first error reported. See [Status Codes](https://docs.silabs.com/gecko-platform/latest/platform-common/status) for details.
+ ******************************************************************************/
+sl_status_t sl_si91x_fwup_pipeline_finish(sl_si91x_fwup_progress_t *progress);
+
+/***************************************************************************/ /**
+ * @brief
+ *   Get the progress of the current or last pipelined firmware upgrade.
+ * 
+ * @param[out] progress
+ *   Snapshot of the progress counters.
+ * 
+ * @return
+ *   sl_status_t. See [Status Codes](https://docs.silabs.com/gecko-platform/latest/platform-common/status) for details.
+ ******************************************************************************/
+sl_status_t sl_si91x_fwup_pipeline_get_progress(sl_si91x_fwup_progress_t *progress);
+
 /***************************************************************************/ /**
  * @brief
  *   Flash firmware to the Wi-Fi module via the bootloader. 
@@ -368,6 +368,18 @@ sl_status_t sli_si91x_flush_queue_based_on_type(sli_si91x_command_queue_t *queue
 /* Function used to check whether queue is empty or not */
 uint32_t sli_si91x_host_queue_status(const sli_si91x_buffer_queue_t *queue);
 
+/* Function used to record the command just written to the bus in the in-flight window of the queue */
+void sli_si91x_command_window_push(sli_si91x_command_queue_t *queue);
+
+/* Function used to make the in-flight command matching a response frame the current command of the queue */
+int8_t sli_si91x_command_window_select(sli_si91x_command_queue_t *queue, uint16_t frame_type);
+
+/* Function used to drop the selected command from the in-flight window once its response has been handled */
+void sli_si91x_command_window_retire(sli_si91x_command_queue_t *queue, int8_t index);
+
+/* Function used to check whether the next command of the queue has to wait for the commands in flight */
+bool sli_si91x_command_window_is_full(const sli_si91x_command_queue_t *queue);
+
 // These aren't host APIs. These should go into a wifi bus API header
 /* Function used to set buffer pointer to point to specified memory address */
 sl_status_t sl_si91x_bus_read_memory(uint32_t addr, uint16_t length, uint8_t *buffer);
@@ -572,6 +584,15 @@ sl_status_t sli_si91x_flush_socket_data_queues_based_on_queue_type(uint8_t index
  */
 sl_status_t sli_si91x_flush_generic_data_queues(sli_si91x_buffer_queue_t *tx_data_queue);
 
+/**
+ * @brief Reports that the bus thread has written a buffer from the generic data queue.
+ * @details If the buffer is the oldest frame submitted with @ref sl_si91x_driver_raw_send_command_async, its slot is released and its completion callback is invoked. Other buffers are ignored.
+ *
+ * @param[in] buffer Buffer that was removed from `sli_tx_data_queue`. It must not be freed before this call.
+ * @param[in] status Result of the bus write.
+ */
+void sli_si91x_raw_data_frame_sent(const sl_wifi_buffer_t *buffer, sl_status_t status);
+
 /***************************************************************************/ /**
  * @brief
  *   Retrieves the current status of the TX command.
@@ -0,0 +1,185 @@
+/***************************************************************************/ /**
+ * @file  sl_si91x_command_trace.h
+ * @brief Latency tracing for the SI91X command engine
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+#pragma once
+
+#include <stdint.h>
+#include "sl_status.h"
+
+/**
+ * Command latency tracing is compiled in only when SL_SI91X_COMMAND_TRACE is defined.
+ *
+ * Each command sent through the command queues is timestamped with the RTOS system timer (CPU cycles on
+ * Cortex-M FreeRTOS ports) when it is queued, when the command engine starts and finishes writing it to the bus,
+ * when the NWP response is received, and when the waiting thread collects the response. Every trace point is
+ * recorded in a ring buffer, and each completed command is folded into per-command-ID latency histograms.
+ */
+
+/// Number of trace points kept in the event ring buffer. Must be a power of two.
+#ifndef SL_SI91X_COMMAND_TRACE_EVENT_COUNT
+#define SL_SI91X_COMMAND_TRACE_EVENT_COUNT 64
+#endif
+
+/// Number of distinct command IDs with their own histograms. Further commands are aggregated under SL_SI91X_COMMAND_TRACE_OTHER.
+#ifndef SL_SI91X_COMMAND_TRACE_MAX_COMMANDS
+#define SL_SI91X_COMMAND_TRACE_MAX_COMMANDS 8
+#endif
+
+/// Number of commands that can be tracked between being queued and completing. Only commands whose response is
+/// awaited by a caller are tracked, commands sent with SLI_SI91X_RETURN_IMMEDIATELY or asynchronously are not.
+#ifndef SL_SI91X_COMMAND_TRACE_MAX_PENDING
+#define SL_SI91X_COMMAND_TRACE_MAX_PENDING 8
+#endif
+
+/// Number of logarithmic histogram buckets. Bucket n counts latencies in [2^n, 2^(n+1)) microseconds.
+#ifndef SL_SI91X_COMMAND_TRACE_HISTOGRAM_BUCKETS
+#define SL_SI91X_COMMAND_TRACE_HISTOGRAM_BUCKETS 24
+#endif
+
+/// Command ID under which commands beyond SL_SI91X_COMMAND_TRACE_MAX_COMMANDS are aggregated
+#define SL_SI91X_COMMAND_TRACE_OTHER 0xFFFF
+
+/// Command type passed by trace points that do not know which command queue the frame belongs to
+#define SLI_SI91X_COMMAND_TRACE_ANY_QUEUE 0xFF
+
+/// Trace points along the command and data path
+typedef enum {
+  SL_SI91X_COMMAND_TRACE_QUEUED,        ///< Command appended to its command queue
+  SL_SI91X_COMMAND_TRACE_BUS_START,     ///< Command engine started writing the command to the bus
+  SL_SI91X_COMMAND_TRACE_BUS_DONE,      ///< Command written to the bus
+  SL_SI91X_COMMAND_TRACE_RESPONSE,      ///< Response received from the NWP
+  SL_SI91X_COMMAND_TRACE_COMPLETE,      ///< Waiting thread collected the response
+  SL_SI91X_COMMAND_TRACE_TIMEOUT,       ///< Waiting thread gave up on the response
+  SL_SI91X_COMMAND_TRACE_DATA_TX_START, ///< Command engine started writing a data frame to the bus
+  SL_SI91X_COMMAND_TRACE_DATA_TX_DONE,  ///< Data frame written to the bus
+} sl_si91x_command_trace_point_t;
+
+/// Latency stages derived from consecutive trace points
+typedef enum {
+  SL_SI91X_COMMAND_TRACE_STAGE_QUEUE,    ///< QUEUED to BUS_START, includes waking up the NWP
+  SL_SI91X_COMMAND_TRACE_STAGE_BUS,      ///< BUS_START to BUS_DONE
+  SL_SI91X_COMMAND_TRACE_STAGE_FIRMWARE, ///< BUS_DONE to RESPONSE
+  SL_SI91X_COMMAND_TRACE_STAGE_WAKEUP,   ///< RESPONSE to COMPLETE, time taken to wake up the waiting thread
+  SL_SI91X_COMMAND_TRACE_STAGE_COUNT,
+} sl_si91x_command_trace_stage_t;
+
+/// Raw trace point as stored in the event ring buffer
+typedef struct {
+  uint32_t timestamp; ///< osKernelGetSysTimerCount() when the trace point was hit
+  uint16_t frame_id;  ///< Command or data frame ID
+  uint8_t point;      ///< One of @ref sl_si91x_command_trace_point_t
+  uint8_t packet_id;  ///< Host packet ID of the command, 0 for responses and data frames
+} sl_si91x_command_trace_event_t;
+
+/// Latency histogram of one stage of one command ID
+typedef struct {
+  uint32_t count;                                             ///< Number of samples
+  uint32_t min_us;                                            ///< Shortest latency in microseconds
+  uint32_t max_us;                                            ///< Longest latency in microseconds
+  uint64_t total_us;                                          ///< Sum of all latencies in microseconds
+  uint16_t buckets[SL_SI91X_COMMAND_TRACE_HISTOGRAM_BUCKETS]; ///< Saturating sample counts per logarithmic bucket
+} sl_si91x_command_trace_histogram_t;
+
+#ifdef SL_SI91X_COMMAND_TRACE
+
+/// Record a trace point. Used by the driver, not by applications.
+#define SLI_SI91X_COMMAND_TRACE(point, command_type, packet_id, frame_id) \
+  sli_si91x_command_trace(point, (uint8_t)(command_type), (uint8_t)(packet_id), (uint16_t)(frame_id))
+
+void sli_si91x_command_trace(sl_si91x_command_trace_point_t point,
+                             uint8_t command_type,
+                             uint8_t packet_id,
+                             uint16_t frame_id);
+
+/***************************************************************************/ /**
+ * @brief
+ *   Clear the event ring buffer, the pending commands and all histograms.
+ ******************************************************************************/
+void sl_si91x_command_trace_reset(void);
+
+/***************************************************************************/ /**
+ * @brief
+ *   Copy the latency histogram of one stage of a command.
+ * @param[in] frame_id
+ *   Command ID, or SL_SI91X_COMMAND_TRACE_OTHER for the commands that did not get their own entry.
+ * @param[in] stage
+ *   Latency stage of type @ref sl_si91x_command_trace_stage_t.
+ * @param[out] histogram
+ *   Histogram of type @ref sl_si91x_command_trace_histogram_t.
+ * @return
+ *   sl_status_t. SL_STATUS_NOT_FOUND if no instance of the command has completed since the last reset.
+ ******************************************************************************/
+sl_status_t sl_si91x_command_trace_get_histogram(uint16_t frame_id,
+                                                 sl_si91x_command_trace_stage_t stage,
+                                                 sl_si91x_command_trace_histogram_t *histogram);
+
+/***************************************************************************/ /**
+ * @brief
+ *   Remove the oldest trace points from the event ring buffer.
+ * @param[out] events
+ *   Array receiving the trace points, oldest first.
+ * @param[in] max_events
+ *   Number of entries in events.
+ * @param[out] event_count
+ *   Number of trace points copied.
+ * @return
+ *   sl_status_t. See [Status Codes](https://docs.silabs.com/gecko-platform/latest/platform-common/status) for details.
+ * @note
+ *   When the ring buffer is full the oldest trace points are overwritten.
+ ******************************************************************************/
+sl_status_t sl_si91x_command_trace_read_events(sl_si91x_command_trace_event_t *events,
+                                               uint32_t max_events,
+                                               uint32_t *event_count);
+
+/***************************************************************************/ /**
+ * @brief
+ *   Serialize all histograms into a compact little-endian binary format.
+ * @details
+ *   The output starts with a 12-byte header: the magic "SLCT", a version byte, the stage count, the bucket count,
+ *   the command count and the system timer frequency (uint32_t). Each command follows as its ID (uint16_t), its
+ *   timeout count (uint16_t) and, for every stage, the sample count, minimum and maximum in microseconds (uint32_t
+ *   each) followed by the bucket counts (uint16_t each).
+ * @param[out] buffer
+ *   Destination buffer. May be NULL to query the required length.
+ * @param[in] buffer_length
+ *   Size of buffer in bytes.
+ * @param[out] length
+ *   Number of bytes written, or required when the buffer is too small.
+ * @return
+ *   sl_status_t. SL_STATUS_WOULD_OVERFLOW if buffer is too small.
+ ******************************************************************************/
+sl_status_t sl_si91x_command_trace_export(uint8_t *buffer, uint32_t buffer_length, uint32_t *length);
+
+#else
+
+#define SLI_SI91X_COMMAND_TRACE(point, command_type, packet_id, frame_id) \
+  do {                                                                     \
+  } while (0)
+
+#endif
@@ -76,6 +76,9 @@
 // Indicates RX response received for BLE command type
 #define NCP_HOST_BT_RESPONSE_EVENT SL_SI91X_RESPONSE_FLAG(SLI_SI91X_BT_CMD)
 
+// sync_command value of sli_si91x_driver_send_bt_command() for a command whose response is delivered to a callback
+#define SLI_SI91X_BT_COMMAND_WITH_CALLBACK 2
+
 // Triggered by IRQ to indicate something to read
 #define SL_SI91X_NCP_HOST_BUS_RX_EVENT           SL_SI91X_EXTRA_EVENT_FLAG(0)
 #define SL_SI91X_SOCKET_DATA_TX_PENDING_EVENT    SL_SI91X_EXTRA_EVENT_FLAG(1)
@@ -93,6 +96,56 @@ typedef enum { SL_NCP_NORMAL_POWER_MODE, SL_NCP_LOW_POWER_MODE, SL_NCP_ULTRA_LOW
 typedef struct sl_si91x_power_configuration sl_si91x_power_configuration_t;
 //! @endcond
 
+/// Maximum number of common flash chunk commands kept in flight by a single write operation
+#ifndef SL_SI91X_COMMON_FLASH_WRITE_WINDOW
+#define SL_SI91X_COMMON_FLASH_WRITE_WINDOW 4
+#endif
+
+/// State of a non-blocking common flash write started with @ref sl_si91x_command_to_write_common_flash_start
+typedef struct {
+  uint32_t start_address;            ///< Flash address of the first chunk
+  uint16_t length;                   ///< Total number of bytes to write or erase
+  uint32_t write_address;            ///< Flash address of the next chunk to be queued
+  const uint8_t *write_data;         ///< Data of the next chunk to be queued
+  uint16_t remaining_length;         ///< Number of bytes not yet queued
+  uint8_t flash_sector_erase_enable; ///< 1 for sector erase, 0 for write
+  uint32_t head_address;             ///< Flash address of the oldest outstanding chunk
+  uint8_t head;                      ///< Index of the oldest outstanding chunk in packet_id
+  uint8_t in_flight;                 ///< Number of chunks queued and not yet collected
+  uint8_t packet_id[SL_SI91X_COMMON_FLASH_WRITE_WINDOW]; ///< Packet IDs of the outstanding chunks
+  uint32_t head_tickcount;           ///< Tick at which the oldest outstanding chunk became next to be answered
+  sl_status_t status;                ///< Status of the first failed chunk, SL_STATUS_OK otherwise
+  uint32_t failed_address;           ///< Flash address of the first failed chunk, valid when status is not SL_STATUS_OK
+} sl_si91x_common_flash_write_t;
+
+/// Number of lines in the NWP common flash read cache. Set to 0 to disable the cache.
+#ifndef SL_SI91X_COMMON_FLASH_READ_CACHE_LINES
+#define SL_SI91X_COMMON_FLASH_READ_CACHE_LINES 4
+#endif
+
+/// Size in bytes of a common flash read cache line. Must not exceed MAX_CHUNK_SIZE.
+#ifndef SL_SI91X_COMMON_FLASH_READ_CACHE_LINE_SIZE
+#define SL_SI91X_COMMON_FLASH_READ_CACHE_LINE_SIZE 1024
+#endif
+
+/// Start of the common flash region the read cache may fetch lines from. Reads of lines outside the region bypass the cache.
+#ifndef SL_SI91X_COMMON_FLASH_READ_CACHE_REGION_START
+#define SL_SI91X_COMMON_FLASH_READ_CACHE_REGION_START 0x0UL
+#endif
+
+/// Size in bytes of the common flash region the read cache may fetch lines from, 0 for no limit.
+#ifndef SL_SI91X_COMMON_FLASH_READ_CACHE_REGION_SIZE
+#define SL_SI91X_COMMON_FLASH_READ_CACHE_REGION_SIZE 0x0UL
+#endif
+
+/// Counters of the common flash read cache
+typedef struct {
+  uint32_t hits;          ///< Cache lines served from the cache
+  uint32_t misses;        ///< Cache lines read from flash on demand
+  uint32_t prefetches;    ///< Cache lines read ahead during sequential reads
+  uint32_t invalidations; ///< Cache lines dropped by writes to the common flash
+} sl_si91x_common_flash_read_cache_stats_t;
+
 /***************************************************************************/ /**
  * @brief
  *   Initialize the driver.
@@ -187,6 +240,86 @@ sl_status_t sli_si91x_driver_send_async_command(uint32_t command,
                                                 sli_si91x_command_type_t queue_type,
                                                 void *data,
                                                 uint32_t data_length);
+/***************************************************************************/ /**
+ * @brief
+ *   Queue a command packet to the NWP without waiting for its response.
+ * @details
+ *   The response, if requested through @p wait_period, is held in the command queue's RX queue
+ *   until it is collected with @ref sli_si91x_driver_collect_command_response using the returned packet ID.
+ *   Several commands may be queued back to back; the bus thread sends them in order.
+ * @param[in] command
+ *   Command type to be sent to NWP firmware.
+ * @param[in] queue_type
+ *   @ref sli_si91x_command_type_t Command type
+ * @param[in] buffer
+ *   Command buffer holding the packet. Ownership is transferred to the driver.
+ * @param[in] wait_period
+ *   @ref sli_si91x_wait_period_t Timeout for the command response, measured from the time the command is queued,
+ *   or from the time it is sent for commands flagged with @ref SI91X_PACKET_TIMEOUT_FROM_SEND.
+ * @param[in] sdk_context
+ *   Pointer to the context.
+ * @param[in] response_packet
+ *   true if the response packet is to be retained for the collector.
+ * @param[in] extra_flags
+ *   Si91x packet flags added to the ones derived from the command and wait_period, usually 0.
+ * @param[out] packet_id
+ *   Packet ID assigned to the command. May be NULL.
+ * @return
+ *   SL_STATUS_IN_PROGRESS when the command is queued, otherwise an error code.
+ *   See https://docs.silabs.com/gecko-platform/latest/platform-common/status for details.
+ ******************************************************************************/
+sl_status_t sli_si91x_driver_queue_command_packet(uint32_t command,
+                                                  sli_si91x_command_type_t queue_type,
+                                                  sl_wifi_buffer_t *buffer,
+                                                  sli_si91x_wait_period_t wait_period,
+                                                  void *sdk_context,
+                                                  bool response_packet,
+                                                  uint8_t extra_flags,
+                                                  uint8_t *packet_id);
+
+/***************************************************************************/ /**
+ * @brief
+ *   Collect the response of a command queued with @ref sli_si91x_driver_queue_command_packet.
+ * @param[in] queue_type
+ *   @ref sli_si91x_command_type_t Command type the command was queued on.
+ * @param[in] packet_id
+ *   Packet ID returned when the command was queued.
+ * @param[in] wait_period
+ *   @ref sli_si91x_wait_period_t Time to wait for the response.
+ * @param[out] data_buffer
+ *   Pointer to a data buffer pointer for the response data to be returned in. May be NULL.
+ * @return
+ *   sl_status_t. SL_STATUS_TIMEOUT if the response did not arrive within @p wait_period.
+ *   See https://docs.silabs.com/gecko-platform/latest/platform-common/status for details.
+ ******************************************************************************/
+sl_status_t sli_si91x_driver_collect_command_response(sli_si91x_command_type_t queue_type,
+                                                      uint8_t packet_id,
+                                                      sli_si91x_wait_period_t wait_period,
+                                                      sl_wifi_buffer_t **data_buffer);
+
+/***************************************************************************/ /**
+ * @brief
+ *   Check for the response of a command queued with @ref sli_si91x_driver_queue_command_packet.
+ * @details
+ *   Unlike @ref sli_si91x_driver_collect_command_response, the command stays queued when its response
+ *   has not arrived within @p wait_time, so the check may be repeated.
+ * @param[in] queue_type
+ *   @ref sli_si91x_command_type_t Command type the command was queued on.
+ * @param[in] packet_id
+ *   Packet ID returned when the command was queued.
+ * @param[in] wait_time
+ *   Time in milliseconds to wait for the response. 0 polls.
+ * @param[out] data_buffer
+ *   Pointer to a data buffer pointer for the response data to be returned in. May be NULL.
+ * @return
+ *   sl_status_t. SL_STATUS_IN_PROGRESS if the response has not arrived yet.
+ *   See https://docs.silabs.com/gecko-platform/latest/platform-common/status for details.
+ ******************************************************************************/
+sl_status_t sli_si91x_driver_poll_command_response(sli_si91x_command_type_t queue_type,
+                                                   uint8_t packet_id,
+                                                   uint32_t wait_time,
+                                                   sl_wifi_buffer_t **data_buffer);
+
 /***************************************************************************/ /**
  * @brief
  *   Wait for a command response.
@@ -231,7 +364,8 @@ sl_status_t sli_si91x_driver_send_socket_data(const sli_si91x_socket_send_reques
  * @param[in] data
  *   [sl_wifi_buffer_t](../wiseconnect-api-reference-guide-wi-fi/sl-wifi-buffer-t) Pointer to Bluetooth data.
  * @param[in] sync_command
- *   Sync or Async command.
+ *   Sync or Async command, or @ref SLI_SI91X_BT_COMMAND_WITH_CALLBACK for a command that does not post
+ *   the TX done notification the synchronous commands wait for.
  * @pre Pre-conditions:
  * - 
  *   @ref sl_si91x_driver_init should be called before this API.
@@ -520,6 +654,72 @@ sl_status_t sl_si91x_command_to_write_common_flash(uint32_t write_address,
                                                    uint16_t write_data_length,
                                                    uint8_t flash_sector_erase_enable);
 
+/***************************************************************************/ /**
+ * @brief
+ *   Starts a non-blocking write or sector erase of the common flash.
+ *
+ * @details
+ *   The request is split into chunks which are queued to the NWP back to back, keeping up to
+ *   @ref SL_SI91X_COMMON_FLASH_WRITE_WINDOW chunk commands in flight. Completion is driven by
+ *   @ref sl_si91x_common_flash_write_process. The buffer pointed to by @p write_data must remain
+ *   valid until the operation completes.
+ *
+ * @param[out] operation
+ *   Pointer to the @ref sl_si91x_common_flash_write_t object tracking the operation.
+ *
+ * @param[in] write_address
+ *   The address in the common flash memory where the write operation should begin. Same constraints as @ref sl_si91x_command_to_write_common_flash.
+ *
+ * @param[in] write_data
+ *   Pointer to the data to be written.
+ *
+ * @param[in] write_data_length
+ *   The total length of the data, which should be multiples of 4K for sector erase.
+ *
+ * @param[in] flash_sector_erase_enable
+ *   - 1: Erases multiples of 4 KB of data.
+ *   - 0: Disable, allows writing data onto flash.
+ *
+ * @return
+ *   SL_STATUS_IN_PROGRESS when the first chunks are queued, otherwise an error code. See [Status Codes](https://docs.silabs.com/gecko-platform/latest/platform-common/status) for details.
+ *
+ * @note
+ *   This API is only applicable in SoC mode.
+ ******************************************************************************/
+sl_status_t sl_si91x_command_to_write_common_flash_start(sl_si91x_common_flash_write_t *operation,
+                                                         uint32_t write_address,
+                                                         const uint8_t *write_data,
+                                                         uint16_t write_data_length,
+                                                         uint8_t flash_sector_erase_enable);
+
+/***************************************************************************/ /**
+ * @brief
+ *   Advances a common flash write started with @ref sl_si91x_command_to_write_common_flash_start.
+ *
+ * @details
+ *   Collects the responses of completed chunks, waiting up to @p wait_time milliseconds for the
+ *   oldest outstanding chunk, and queues further chunks as the window frees up. Passing 0 polls.
+ *   A chunk fails with SL_STATUS_TIMEOUT when its response has not arrived within
+ *   @ref SLI_SI91X_WAIT_FOR_COMMAND_SUCCESS of being sent; shorter waits leave it outstanding.
+ *   Once a chunk fails, no further chunks are queued and the chunks not yet sent to the NWP are withdrawn.
+ *   Chunks already sent are still collected, and the address of the first failed chunk is reported in
+ *   the failed_address member of @p operation.
+ *
+ * @param[in] operation
+ *   Pointer to the operation.
+ *
+ * @param[in] wait_time
+ *   Maximum time in milliseconds to wait for a chunk to complete.
+ *
+ * @return
+ *   SL_STATUS_IN_PROGRESS while chunks remain, SL_STATUS_OK once the whole write has completed, or the
+ *   status of the first failed chunk once all sent chunks are collected. See [Status Codes](https://docs.silabs.com/gecko-platform/latest/platform-common/status) for details.
+ *
+ * @note
+ *   This API is only applicable in SoC mode.
+ ******************************************************************************/
+sl_status_t sl_si91x_common_flash_write_process(sl_si91x_common_flash_write_t *operation, uint32_t wait_time);
+
 /***************************************************************************/ /**
  * @brief
  *   Sends a command to read data from the NWP flash memory of the SI91x wireless device. 
@@ -543,6 +743,36 @@ sl_status_t sl_si91x_command_to_write_common_flash(uint32_t write_address,
  ******************************************************************************/
 sl_status_t sl_si91x_command_to_read_common_flash(uint32_t read_address, size_t length, uint8_t *output_buffer);
 
+/***************************************************************************/ /**
+ * @brief
+ *   Retrieves the counters of the common flash read cache.
+ * 
+ * @details
+ *   Reads through @ref sl_si91x_command_to_read_common_flash are served from a small LRU cache of
+ *   @ref SL_SI91X_COMMON_FLASH_READ_CACHE_LINES lines. Lines are invalidated by
+ *   @ref sl_si91x_command_to_write_common_flash, both when the write starts and when it completes, and the
+ *   line following a sequential read is queued as a prefetch and collected by the next cache access, so the
+ *   read that triggered it does not wait for it. Lines are only fetched from within the region set by
+ *   @ref SL_SI91X_COMMON_FLASH_READ_CACHE_REGION_START and @ref SL_SI91X_COMMON_FLASH_READ_CACHE_REGION_SIZE.
+ *   Hit rate is hits / (hits + misses).
+ * 
+ * @param[out] stats
+ *   Pointer to a @ref sl_si91x_common_flash_read_cache_stats_t object to be filled.
+ * 
+ * @return
+ *   sl_status_t. See [Status Codes](https://docs.silabs.com/gecko-platform/latest/platform-common/status) for details.
+ ******************************************************************************/
+sl_status_t sl_si91x_get_common_flash_read_cache_stats(sl_si91x_common_flash_read_cache_stats_t *stats);
+
+/***************************************************************************/ /**
+ * @brief
+ *   Invalidates all lines of the common flash read cache and clears its counters.
+ * 
+ * @details
+ *   Only needed when the NWP flash is modified by means other than @ref sl_si91x_command_to_write_common_flash.
+ ******************************************************************************/
+void sl_si91x_flush_common_flash_read_cache(void);
+
 /***************************************************************************/ /**
  * @brief 
  *   Reads the status of a specified id.
@@ -1099,6 +1329,39 @@ sl_status_t sl_si91x_driver_raw_send_command(uint8_t command,
                                              uint32_t data_length,
                                              uint32_t wait_time);
 
+/***************************************************************************/ /**
+ * @brief
+ *   Queue a raw frame on the data queue without waiting and report its completion through a callback.
+ * @param[in] command
+ *   Command type to be sent to NWP firmware.
+ * @param[in] data
+ *   Command data to be sent to NWP firmware. It is copied before the function returns.
+ * @param[in] data_length
+ *   Length of the data length
+ * @param[in] callback
+ *   @ref sl_wifi_raw_data_frame_callback_t invoked once the frame is written to the NWP or flushed. Can be NULL.
+ * @param[in] context
+ *   Argument passed to the callback.
+ * @pre Pre-conditions:
+ * - 
+ *   @ref sl_si91x_driver_init should be called before this API.
+ * @return
+ *   sl_status_t. SL_STATUS_WOULD_BLOCK if SL_WIFI_RAW_DATA_FRAME_WINDOW frames are already outstanding. See https://docs.silabs.com/gecko-platform/latest/platform-common/status for details.
+ ******************************************************************************/
+sl_status_t sl_si91x_driver_raw_send_command_async(uint8_t command,
+                                                   const void *data,
+                                                   uint32_t data_length,
+                                                   sl_wifi_raw_data_frame_callback_t callback,
+                                                   void *context);
+
+/***************************************************************************/ /**
+ * @brief
+ *   Get the number of frames submitted with @ref sl_si91x_driver_raw_send_command_async that are not yet completed.
+ * @return
+ *   Number of outstanding frames, at most SL_WIFI_RAW_DATA_FRAME_WINDOW.
+ ******************************************************************************/
+uint8_t sl_si91x_driver_get_pending_raw_data_frames(void);
+
 //! @cond Doxygen_Suppress
 /***************************************************************************/ /**
  * @brief
@@ -1137,6 +1400,20 @@ sl_status_t sl_si91x_driver_send_transceiver_data(sl_wifi_transceiver_tx_data_co
                                                   uint16_t payload_len,
                                                   uint32_t wait_time);
 
+/***************************************************************************/ /**
+ * @brief     Si91X specific Wi-Fi transceiver mode driver function to send a burst of Tx data frames to one peer
+ * @param[in] control      - Meta data shared by all frames. The MAC header is built once from it.
+ * @param[in] frames       - Array of frames, each with its payload and status report token.
+ * @param[in] frame_count  - Number of frames in the array.
+ * @param[in] wait_time    - Wait time for the command response.
+ * @return    sl_status_t. See https://docs.silabs.com/gecko-platform/latest/platform-common/status for details.
+ * @note      All frames are queued together. If a buffer allocation fails, none of the frames are sent.
+ *******************************************************************************/
+sl_status_t sl_si91x_driver_send_transceiver_data_burst(sl_wifi_transceiver_tx_data_control_t *control,
+                                                        const sl_wifi_transceiver_tx_frame_t *frames,
+                                                        uint16_t frame_count,
+                                                        uint32_t wait_time);
+
 //! @cond Doxygen_Suppress
 /***************************************************************************/ /**
  * @brief
@@ -53,6 +53,21 @@ typedef struct sl_si91x_fdset_s {
 /// Flag to indicate that host would receive the response from firmware in asynchronous manner.
 #define SI91X_PACKET_WITH_ASYNC_RESPONSE (1 << 4)
 
+/// Flag to indicate that the command has no side effects and may be in flight together with other independent commands of its queue.
+/// Commands without this flag stay ordered: they are sent only when no other command of the queue is in flight.
+#define SI91X_PACKET_INDEPENDENT (1 << 5)
+
+/// Flag to indicate that the command response timeout is measured from the time the command is sent rather than queued.
+#define SI91X_PACKET_TIMEOUT_FROM_SEND (1 << 6)
+
+/// Flag to indicate that the command is not reported to its protocol once sent, its response is handled on its own.
+#define SI91X_PACKET_NO_TX_DONE_NOTIFY (1 << 7)
+
+/// Maximum number of commands of a command queue awaiting their response at the same time.
+#ifndef SL_SI91X_COMMAND_QUEUE_WINDOW
+#define SL_SI91X_COMMAND_QUEUE_WINDOW 1
+#endif
+
 /// Si91x specific command type
 typedef enum {
   SI91X_COMMON_CMD      = 0, ///< SI91X Common Command
@@ -203,6 +218,17 @@ typedef struct {
 /// The summation of all three ratios should max 10 and the ratio should be in decimal value.
 typedef sl_wifi_system_dynamic_pool_t sl_si91x_dynamic_pool;
 
+/// Structure to represent a command written to the firmware and awaiting its response
+typedef struct {
+  uint16_t frame_type;        ///< Type of the frame associated with the command
+  uint16_t packet_id;         ///< ID of the packet associated with the command
+  uint8_t firmware_queue_id;  ///< ID of the firmware queue for the command
+  uint8_t flags;              ///< Flags associated with the command
+  uint32_t command_tickcount; ///< Command tick count
+  uint32_t command_timeout;   ///< Command timeout
+  void *sdk_context;          ///< Context data associated with the command
+} sli_si91x_command_in_flight_t;
+
 /// Structure to represent a command queue
 typedef struct {
   sli_si91x_buffer_queue_t tx_queue;    ///< TX queue
@@ -222,4 +248,6 @@ typedef struct {
   uint32_t command_timeout;             ///< Command timeout
   void *sdk_context;                    ///< Context data associated with the command
   bool is_queue_initialiazed;           ///< indicates queue is initialiazed or not.
+  uint8_t in_flight_count;              ///< Number of commands awaiting a response, tracked only for queues that are not sequential
+  sli_si91x_command_in_flight_t in_flight[SL_SI91X_COMMAND_QUEUE_WINDOW]; ///< Commands awaiting a response, oldest first
 } sli_si91x_command_queue_t;
@@ -205,6 +205,27 @@ typedef void (*sl_si91x_socket_select_callback_t)(sl_si91x_fdset_t *fd_read,
  */
 typedef void (*sl_si91x_socket_remote_termination_callback_t)(int socket, uint16_t port, uint32_t bytes_sent);
 
+/// Data, a new connection or the end of the stream can be read from the socket.
+#define SL_SI91X_SOCKET_POLL_READ (1 << 0)
+/// The socket can queue more data for transmission.
+#define SL_SI91X_SOCKET_POLL_WRITE (1 << 1)
+/// The connection was closed. Always reported, whether registered or not.
+#define SL_SI91X_SOCKET_POLL_HANGUP (1 << 2)
+
+/// Operations of sl_si91x_socket_poll_control()
+typedef enum {
+  SL_SI91X_SOCKET_POLL_ADD,    ///< Register a socket with a poll instance
+  SL_SI91X_SOCKET_POLL_MODIFY, ///< Change the events and context of a registered socket
+  SL_SI91X_SOCKET_POLL_DELETE, ///< Unregister a socket
+} sl_si91x_socket_poll_operation_t;
+
+/// Readiness event returned by sl_si91x_socket_poll_wait()
+typedef struct {
+  int socket;     ///< Socket that became ready
+  uint8_t events; ///< SL_SI91X_SOCKET_POLL_* events raised since the socket was last reported
+  void *context;  ///< Context given when the socket was registered
+} sl_si91x_socket_poll_event_t;
+
 /** @} */
 
 /// Internal  si91x BSD socket status
@@ -313,6 +313,21 @@ int32_t sli_get_socket_command_from_host_packet(sl_wifi_buffer_t *buffer);
 
 void sli_si91x_set_socket_event(uint32_t event_mask);
 
+int sli_si91x_socket_poll_create(void);
+
+int sli_si91x_socket_poll_close(int poll);
+
+int sli_si91x_socket_poll_control(int poll,
+                                  sl_si91x_socket_poll_operation_t operation,
+                                  int socket,
+                                  uint8_t events,
+                                  void *context);
+
+int sli_si91x_socket_poll_wait(int poll, sl_si91x_socket_poll_event_t *events, int max_events, uint32_t timeout);
+
+/* Function used to raise readiness events on a socket for every poll instance it is registered with */
+void sli_si91x_socket_poll_notify(int socket, uint8_t events);
+
 sl_status_t sli_si91x_flush_select_request_table(uint16_t error_code);
 
 sl_status_t sli_si91x_udp_connect_if_unconnected(sli_si91x_socket_t *si91x_socket,
@@ -52,6 +52,13 @@
 #define SL_SOCKET_DEFAULT_BUFFER_LIMIT 3
 #endif
 
+// Number of readiness notification instances that can exist at the same time
+#ifndef SL_SI91X_SOCKET_POLL_MAX_INSTANCES
+#define SL_SI91X_SOCKET_POLL_MAX_INSTANCES 2
+#endif
+
+#define SLI_SI91X_SOCKET_POLL_READY_EVENT (1 << 0)
+
 /******************************************************
  *                    Structures
  ******************************************************/
@@ -90,6 +97,19 @@ static uint8_t sli_si91x_max_select_count
 
 static sli_si91x_select_request_t *select_request_table = NULL;
 
+// Readiness state of the sockets registered with a poll instance, maintained from the events received from the firmware
+typedef struct {
+  osEventFlagsId_t ready_event;            // Wakes up the thread waiting on the instance
+  uint32_t registered;                     // Bitmap of registered socket indexes
+  uint32_t ready;                          // Bitmap of registered sockets with unreported events
+  uint8_t waiters;                         // Number of threads in sli_si91x_socket_poll_wait on the instance
+  uint8_t interest[SLI_NUMBER_OF_SOCKETS]; // Events each socket was registered for
+  uint8_t pending[SLI_NUMBER_OF_SOCKETS];  // Events raised since each socket was last reported
+  void *context[SLI_NUMBER_OF_SOCKETS];    // User context of each socket
+} sli_si91x_socket_poll_t;
+
+static sli_si91x_socket_poll_t *socket_poll_table[SL_SI91X_SOCKET_POLL_MAX_INSTANCES] = { 0 };
+
 sli_si91x_buffer_queue_t sli_si91x_select_response_queue;
 
 extern sli_si91x_command_queue_t cmd_queues[SI91X_CMD_MAX];
@@ -295,6 +315,7 @@ sl_status_t sli_si91x_vap_shutdown(uint8_t vap_id, sli_si91x_bsd_disconnect_reas
     if ((sli_si91x_sockets[socket_index] != NULL) && (sli_si91x_sockets[socket_index]->vap_id == vap_id)) {
       sli_si91x_sockets[socket_index]->state             = DISCONNECTED;
       sli_si91x_sockets[socket_index]->disconnect_reason = disconnect_reason;
+      sli_si91x_socket_poll_notify(socket_index, SL_SI91X_SOCKET_POLL_READ | SL_SI91X_SOCKET_POLL_HANGUP);
     }
   }
 
@@ -379,6 +400,17 @@ void sli_si91x_free_socket(int socket)
     si91x_socket->socket_events = NULL;
   }
 
+  // Unregister the socket from every poll instance so that a new socket reusing the index starts clean.
+  CORE_irqState_t state = CORE_EnterAtomic();
+  for (uint8_t i = 0; i < SL_SI91X_SOCKET_POLL_MAX_INSTANCES; i++) {
+    if (socket_poll_table[i] != NULL) {
+      socket_poll_table[i]->registered &= ~(1UL << socket);
+      socket_poll_table[i]->ready &= ~(1UL << socket);
+      socket_poll_table[i]->pending[socket] = 0;
+    }
+  }
+  CORE_ExitAtomic(state);
+
   // Free the memory allocated for the socket structure.
   free(si91x_socket);
 
@@ -453,6 +485,8 @@ void sli_get_free_socket(sli_si91x_socket_t **socket, int *socket_fd)
     sli_si91x_sockets[socket_index]->id                = -1;
     sli_si91x_sockets[socket_index]->index             = socket_index;
     sli_si91x_sockets[socket_index]->data_buffer_limit = SL_SOCKET_DEFAULT_BUFFER_LIMIT;
+    // Socket commands are always sent one at a time
+    sli_si91x_sockets[socket_index]->command_queue.sequential = true;
 
     // If a free socket is found, set the socket pointer to point to it
     *socket = sli_si91x_sockets[socket_index];
@@ -945,6 +979,7 @@ sl_status_t sli_si91x_socket_event_handler(sl_status_t status,
     sli_si91x_socket_t *client_socket = sli_get_si91x_socket(client_socket_id);
 
     sli_handle_accept_response(client_socket, accept_response);
+    sli_si91x_socket_poll_notify(server_socket->index, SL_SI91X_SOCKET_POLL_READ);
 
     if (server_socket->user_accept_callback != NULL) {
       // Call the accept callback function with relevant socket information
@@ -970,6 +1005,7 @@ sl_status_t sli_si91x_socket_event_handler(sl_status_t status,
       frame_status = (frame_status == SL_STATUS_OK) ? (SL_STATUS_SI91X_SOCKET_CLOSED & 0xFFFF) : frame_status;
       sli_si91x_flush_socket_command_queues_based_on_queue_type(index, frame_status);
       sli_si91x_flush_socket_data_queues_based_on_queue_type(index);
+      sli_si91x_socket_poll_notify(index, SL_SI91X_SOCKET_POLL_READ | SL_SI91X_SOCKET_POLL_HANGUP);
 
       if (user_remote_socket_termination_callback != NULL) {
         user_remote_socket_termination_callback(socket->id,
@@ -1003,6 +1039,7 @@ sl_status_t sli_si91x_socket_event_handler(sl_status_t status,
 
     // Call the user-defined receive data callback
     client_socket->recv_data_callback(host_socket, data, firmware_socket_response->length, firmware_socket_response);
+    sli_si91x_socket_poll_notify(host_socket, SL_SI91X_SOCKET_POLL_READ);
   } else if (rx_packet->command == SLI_WLAN_RSP_SELECT_REQUEST) {
     const sli_si91x_socket_select_rsp_t *socket_select_rsp = (sli_si91x_socket_select_rsp_t *)rx_packet->data;
 
@@ -1070,6 +1107,7 @@ sl_status_t sli_si91x_socket_event_handler(sl_status_t status,
     if (si91x_socket->socket_bitmap & SLI_SI91X_SOCKET_FEAT_TCP_ACK_INDICATION) {
       si91x_socket->is_waiting_on_ack = false;
     }
+    sli_si91x_socket_poll_notify(host_socket, SL_SI91X_SOCKET_POLL_WRITE);
     // Check if the SI91X socket and its data transfer callback function exist
     if (si91x_socket != NULL && si91x_socket->data_transfer_callback != NULL) {
       si91x_socket->data_transfer_callback(host_socket, (uint8_t)(tcp_ack->length[0] | tcp_ack->length[1] << 8));
@@ -1699,6 +1737,231 @@ void sli_si91x_set_socket_event(uint32_t event_mask)
   osEventFlagsSet(si91x_socket_events, event_mask);
 }
 
+// Must be called with interrupts disabled
+static void sli_si91x_socket_poll_raise(sli_si91x_socket_poll_t *poll, int socket, uint8_t events)
+{
+  poll->pending[socket] |= events;
+  if (poll->pending[socket] & (poll->interest[socket] | SL_SI91X_SOCKET_POLL_HANGUP)) {
+    poll->ready |= (1UL << socket);
+    osEventFlagsSet(poll->ready_event, SLI_SI91X_SOCKET_POLL_READY_EVENT);
+  }
+}
+
+// Readiness of a socket as seen from the host, used to seed newly registered sockets
+static uint8_t sli_si91x_socket_poll_current_events(const sli_si91x_socket_t *socket)
+{
+  uint8_t events = 0;
+
+  if (socket->state == DISCONNECTED) {
+    return SL_SI91X_SOCKET_POLL_READ | SL_SI91X_SOCKET_POLL_HANGUP;
+  }
+  if (!sli_si91x_buffer_queue_empty(&socket->rx_data_queue)) {
+    events |= SL_SI91X_SOCKET_POLL_READ;
+  }
+  if (!socket->is_waiting_on_ack
+      && ((socket->data_buffer_limit == 0) || (socket->data_buffer_count < socket->data_buffer_limit))) {
+    events |= SL_SI91X_SOCKET_POLL_WRITE;
+  }
+  return events;
+}
+
+void sli_si91x_socket_poll_notify(int socket, uint8_t events)
+{
+  if ((socket < 0) || (socket >= SLI_NUMBER_OF_SOCKETS)) {
+    return;
+  }
+
+  CORE_irqState_t state = CORE_EnterAtomic();
+  for (uint8_t i = 0; i < SL_SI91X_SOCKET_POLL_MAX_INSTANCES; i++) {
+    if ((socket_poll_table[i] != NULL) && (socket_poll_table[i]->registered & (1UL << socket))) {
+      sli_si91x_socket_poll_raise(socket_poll_table[i], socket, events);
+    }
+  }
+  CORE_ExitAtomic(state);
+}
+
+int sli_si91x_socket_poll_create(void)
+{
+  sli_si91x_socket_poll_t *poll = calloc(1, sizeof(sli_si91x_socket_poll_t));
+  SLI_SET_ERRNO_AND_RETURN_IF_TRUE((poll == NULL), ENOMEM);
+
+  poll->ready_event = osEventFlagsNew(NULL);
+  if (poll->ready_event == NULL) {
+    free(poll);
+    SLI_SET_ERROR_AND_RETURN(ENOMEM);
+  }
+
+  CORE_irqState_t state = CORE_EnterAtomic();
+  for (uint8_t i = 0; i < SL_SI91X_SOCKET_POLL_MAX_INSTANCES; i++) {
+    if (socket_poll_table[i] == NULL) {
+      socket_poll_table[i] = poll;
+      CORE_ExitAtomic(state);
+      return i;
+    }
+  }
+  CORE_ExitAtomic(state);
+
+  osEventFlagsDelete(poll->ready_event);
+  free(poll);
+  SLI_SET_ERROR_AND_RETURN(EMFILE);
+}
+
+int sli_si91x_socket_poll_close(int poll)
+{
+  SLI_SET_ERRNO_AND_RETURN_IF_TRUE(((poll < 0) || (poll >= SL_SI91X_SOCKET_POLL_MAX_INSTANCES)), EBADF);
+
+  // The instance cannot be freed while a thread waits on it
+  CORE_irqState_t state                  = CORE_EnterAtomic();
+  sli_si91x_socket_poll_t *poll_instance = socket_poll_table[poll];
+  if ((poll_instance != NULL) && (poll_instance->waiters != 0)) {
+    CORE_ExitAtomic(state);
+    SLI_SET_ERROR_AND_RETURN(EBUSY);
+  }
+  socket_poll_table[poll] = NULL;
+  CORE_ExitAtomic(state);
+
+  SLI_SET_ERRNO_AND_RETURN_IF_TRUE((poll_instance == NULL), EBADF);
+  osEventFlagsDelete(poll_instance->ready_event);
+  free(poll_instance);
+
+  return SLI_SI91X_NO_ERROR;
+}
+
+int sli_si91x_socket_poll_control(int poll,
+                                  sl_si91x_socket_poll_operation_t operation,
+                                  int socket,
+                                  uint8_t events,
+                                  void *context)
+{
+  SLI_SET_ERRNO_AND_RETURN_IF_TRUE(((poll < 0) || (poll >= SL_SI91X_SOCKET_POLL_MAX_INSTANCES)), EBADF);
+  const sli_si91x_socket_t *si91x_socket = sli_get_si91x_socket(socket);
+  SLI_SET_ERRNO_AND_RETURN_IF_TRUE((si91x_socket == NULL), EBADF);
+
+  CORE_irqState_t state                  = CORE_EnterAtomic();
+  sli_si91x_socket_poll_t *poll_instance = socket_poll_table[poll];
+  if (poll_instance == NULL) {
+    CORE_ExitAtomic(state);
+    SLI_SET_ERROR_AND_RETURN(EBADF);
+  }
+
+  const uint32_t socket_bit = (1UL << socket);
+  const bool registered     = (poll_instance->registered & socket_bit) != 0;
+  int error                 = 0;
+
+  switch (operation) {
+    case SL_SI91X_SOCKET_POLL_ADD:
+    case SL_SI91X_SOCKET_POLL_MODIFY:
+      if ((operation == SL_SI91X_SOCKET_POLL_ADD) == registered) {
+        error = registered ? EEXIST : ENOENT;
+        break;
+      }
+      poll_instance->registered |= socket_bit;
+      poll_instance->interest[socket] = events;
+      poll_instance->context[socket]  = context;
+      poll_instance->pending[socket]  = 0;
+      poll_instance->ready &= ~socket_bit;
+      // Report the current state so that events raised before registration are not lost
+      sli_si91x_socket_poll_raise(poll_instance, socket, sli_si91x_socket_poll_current_events(si91x_socket));
+      break;
+
+    case SL_SI91X_SOCKET_POLL_DELETE:
+      if (!registered) {
+        error = ENOENT;
+        break;
+      }
+      poll_instance->registered &= ~socket_bit;
+      poll_instance->ready &= ~socket_bit;
+      poll_instance->pending[socket] = 0;
+      break;
+
+    default:
+      error = EINVAL;
+      break;
+  }
+  CORE_ExitAtomic(state);
+
+  SLI_SET_ERRNO_AND_RETURN_IF_TRUE((error != 0), error);
+  return SLI_SI91X_NO_ERROR;
+}
+
+int sli_si91x_socket_poll_wait(int poll, sl_si91x_socket_poll_event_t *events, int max_events, uint32_t timeout)
+{
+  SLI_SET_ERRNO_AND_RETURN_IF_TRUE(((poll < 0) || (poll >= SL_SI91X_SOCKET_POLL_MAX_INSTANCES)), EBADF);
+  SLI_SET_ERRNO_AND_RETURN_IF_TRUE(((events == NULL) || (max_events <= 0)), EINVAL);
+
+  // Registered as a waiter in the same critical section as the lookup, so that the instance cannot be closed meanwhile
+  CORE_irqState_t state                  = CORE_EnterAtomic();
+  sli_si91x_socket_poll_t *poll_instance = socket_poll_table[poll];
+  if (poll_instance != NULL) {
+    poll_instance->waiters++;
+  }
+  CORE_ExitAtomic(state);
+  SLI_SET_ERRNO_AND_RETURN_IF_TRUE((poll_instance == NULL), EBADF);
+
+  int result          = 0;
+  int error           = 0;
+  uint32_t start_time = osKernelGetTickCount();
+  while (1) {
+    int count  = 0;
+    int socket = 0;
+
+    // Only the sockets with unreported events are visited
+    state          = CORE_EnterAtomic();
+    uint32_t ready = poll_instance->ready;
+    while ((ready != 0) && (count < max_events)) {
+      while ((ready & (1UL << socket)) == 0) {
+        socket++;
+      }
+      const uint32_t socket_bit = (1UL << socket);
+      uint8_t reported =
+        poll_instance->pending[socket] & (poll_instance->interest[socket] | SL_SI91X_SOCKET_POLL_HANGUP);
+
+      ready &= ~socket_bit;
+      poll_instance->ready &= ~socket_bit;
+      poll_instance->pending[socket] &= (uint8_t)~reported;
+      if (reported != 0) {
+        events[count].socket  = socket;
+        events[count].events  = reported;
+        events[count].context = poll_instance->context[socket];
+        count++;
+      }
+    }
+    if (poll_instance->ready == 0) {
+      osEventFlagsClear(poll_instance->ready_event, SLI_SI91X_SOCKET_POLL_READY_EVENT);
+    }
+    CORE_ExitAtomic(state);
+
+    if (count != 0) {
+      result = count;
+      break;
+    }
+
+    uint32_t elapsed_time = sl_si91x_host_elapsed_time(start_time);
+    if ((timeout != osWaitForever) && (elapsed_time >= timeout)) {
+      break;
+    }
+    uint32_t wait_time = (timeout == osWaitForever) ? osWaitForever : (timeout - elapsed_time);
+    uint32_t flags     = osEventFlagsWait(poll_instance->ready_event,
+                                      SLI_SI91X_SOCKET_POLL_READY_EVENT,
+                                      (osFlagsWaitAny | osFlagsNoClear),
+                                      wait_time);
+    if (flags == (uint32_t)osErrorTimeout) {
+      break;
+    }
+    if (flags & osFlagsError) {
+      error = EBADF;
+      break;
+    }
+  }
+
+  state = CORE_EnterAtomic();
+  poll_instance->waiters--;
+  CORE_ExitAtomic(state);
+
+  SLI_SET_ERRNO_AND_RETURN_IF_TRUE((error != 0), error);
+  return result;
+}
+
 sl_status_t sli_si91x_flush_select_request_table(uint16_t error_code)
 {
   // Iterate over all entries in the select_request_table
@@ -172,6 +172,10 @@ osMutexId_t malloc_free_mutex       = 0;
 osMutexId_t side_band_crypto_mutex = 0;
 #endif
 
+#ifdef SLI_SI91X_MCU_INTERFACE
+osMutexId_t common_flash_read_cache_mutex = 0;
+#endif
+
 sli_si91x_command_queue_t cmd_queues[SI91X_CMD_MAX];
 sli_si91x_buffer_queue_t sli_tx_data_queue;
 #ifndef __ZEPHYR__
@@ -1138,6 +1142,13 @@ sl_status_t sl_si91x_platform_init(void)
   side_band_crypto_mutex = osMutexNew(NULL);
 #endif
 
+#ifdef SLI_SI91X_MCU_INTERFACE
+  // Create common flash read cache mutex
+  if (common_flash_read_cache_mutex == NULL) {
+    common_flash_read_cache_mutex = osMutexNew(NULL);
+  }
+#endif
+
   return status;
 }
 
@@ -1176,6 +1187,12 @@ sl_status_t sli_si91x_platform_deinit(void)
   // Delete malloc/free mutex
   osMutexDelete(malloc_free_mutex);
   malloc_free_mutex = NULL;
+
+#ifdef SLI_SI91X_MCU_INTERFACE
+  // Delete common flash read cache mutex
+  osMutexDelete(common_flash_read_cache_mutex);
+  common_flash_read_cache_mutex = NULL;
+#endif
   return SL_STATUS_OK;
 }
 
@@ -1261,6 +1278,98 @@ sl_status_t sli_si91x_flush_generic_data_queues(sli_si91x_buffer_queue_t *tx_dat
   return SL_STATUS_OK;
 }
 
+static void sli_si91x_command_window_load(sli_si91x_command_queue_t *queue, uint8_t index)
+{
+  const sli_si91x_command_in_flight_t *command = &queue->in_flight[index];
+
+  queue->command_in_flight = true;
+  queue->frame_type        = command->frame_type;
+  queue->packet_id         = command->packet_id;
+  queue->firmware_queue_id = command->firmware_queue_id;
+  queue->flags             = command->flags;
+  queue->command_tickcount = command->command_tickcount;
+  queue->command_timeout   = command->command_timeout;
+  queue->sdk_context       = command->sdk_context;
+}
+
+static void sli_si91x_command_window_remove(sli_si91x_command_queue_t *queue, uint8_t index)
+{
+  queue->in_flight_count--;
+  memmove(&queue->in_flight[index],
+          &queue->in_flight[index + 1],
+          (queue->in_flight_count - index) * sizeof(sli_si91x_command_in_flight_t));
+}
+
+void sli_si91x_command_window_push(sli_si91x_command_queue_t *queue)
+{
+  if (queue->sequential || (queue->in_flight_count >= SL_SI91X_COMMAND_QUEUE_WINDOW)) {
+    return;
+  }
+
+  sli_si91x_command_in_flight_t *command = &queue->in_flight[queue->in_flight_count++];
+  command->frame_type                    = queue->frame_type;
+  command->packet_id                     = queue->packet_id;
+  command->firmware_queue_id             = queue->firmware_queue_id;
+  command->flags                         = queue->flags;
+  command->command_tickcount             = queue->command_tickcount;
+  command->command_timeout               = queue->command_timeout;
+  command->sdk_context                   = queue->sdk_context;
+}
+
+int8_t sli_si91x_command_window_select(sli_si91x_command_queue_t *queue, uint16_t frame_type)
+{
+  // Responses carry no host packet ID; commands of the same type are answered in the order they were sent
+  for (uint8_t index = 0; index < queue->in_flight_count; index++) {
+    if (queue->in_flight[index].frame_type == frame_type) {
+      sli_si91x_command_window_load(queue, index);
+      return (int8_t)index;
+    }
+  }
+  return -1;
+}
+
+void sli_si91x_command_window_retire(sli_si91x_command_queue_t *queue, int8_t index)
+{
+  // Nothing to do while the response handler keeps the current command in flight
+  if ((queue->in_flight_count == 0) || queue->command_in_flight) {
+    return;
+  }
+
+  if (index >= 0) {
+    sli_si91x_command_window_remove(queue, (uint8_t)index);
+  } else if (queue->in_flight_count == 1) {
+    // Ordered commands are alone in flight and may be completed by frames of another type
+    queue->in_flight_count = 0;
+  }
+
+  // The oldest command left is the next to be answered and the first to time out
+  if (queue->in_flight_count != 0) {
+    sli_si91x_command_window_load(queue, 0);
+  }
+}
+
+bool sli_si91x_command_window_is_full(const sli_si91x_command_queue_t *queue)
+{
+  if (!queue->command_in_flight) {
+    return false;
+  }
+  if (queue->sequential || (queue->in_flight_count >= SL_SI91X_COMMAND_QUEUE_WINDOW)) {
+    return true;
+  }
+
+  // Only independent commands may overlap
+  for (uint8_t index = 0; index < queue->in_flight_count; index++) {
+    if (!(queue->in_flight[index].flags & SI91X_PACKET_INDEPENDENT)) {
+      return true;
+    }
+  }
+  if (queue->tx_queue.head != NULL) {
+    const sli_si91x_queue_packet_t *node = sl_si91x_host_get_buffer_data(queue->tx_queue.head, 0, NULL);
+    return !(node->flags & SI91X_PACKET_INDEPENDENT);
+  }
+  return false;
+}
+
 void sli_reset_command_queue_trace(sli_si91x_command_queue_t *queue)
 {
   // Reset command trace for the queue
@@ -1462,7 +1571,22 @@ sl_status_t sli_si91x_flush_queue_based_on_type(sli_si91x_command_queue_t *queue
 
   // Check if the queue is not the BT command queue and has a command in flight
   if (queue != &cmd_queues[SLI_SI91X_BT_CMD] && queue->command_in_flight) {
-    status = sli_handle_command_in_flight_packet(queue, event_mask, frame_status, compare_function, user_data);
+    if (queue->in_flight_count == 0) {
+      status = sli_handle_command_in_flight_packet(queue, event_mask, frame_status, compare_function, user_data);
+    } else {
+      // Flush every command of the in-flight window, keeping those rejected by the compare function
+      uint8_t index = 0;
+      status        = SL_STATUS_OK;
+      while ((status == SL_STATUS_OK) && (index < queue->in_flight_count)) {
+        sli_si91x_command_window_load(queue, index);
+        status = sli_handle_command_in_flight_packet(queue, event_mask, frame_status, compare_function, user_data);
+        if (queue->command_in_flight) {
+          index++;
+        } else {
+          sli_si91x_command_window_retire(queue, (int8_t)index);
+        }
+      }
+    }
     if (status != SL_STATUS_OK) {
       CORE_ExitAtomic(state);
       return status;
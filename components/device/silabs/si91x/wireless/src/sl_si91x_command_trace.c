@@ -0,0 +1,354 @@
+/***************************************************************************/ /**
+ * @file  sl_si91x_command_trace.c
+ * @brief Latency tracing for the SI91X command engine
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include "sl_si91x_command_trace.h"
+
+#ifdef SL_SI91X_COMMAND_TRACE
+
+#include "cmsis_os2.h"
+#include "sl_core.h"
+#include "sl_constants.h"
+#include <stdbool.h>
+#include <string.h>
+
+#if (SL_SI91X_COMMAND_TRACE_EVENT_COUNT & (SL_SI91X_COMMAND_TRACE_EVENT_COUNT - 1)) != 0
+#error "SL_SI91X_COMMAND_TRACE_EVENT_COUNT must be a power of two"
+#endif
+
+#define SLI_COMMAND_TRACE_MAGIC       0x54434C53 // "SLCT"
+#define SLI_COMMAND_TRACE_VERSION     1
+#define SLI_COMMAND_TRACE_HEADER_SIZE 12
+#define SLI_COMMAND_TRACE_STAGE_SIZE  (3 * sizeof(uint32_t) + SL_SI91X_COMMAND_TRACE_HISTOGRAM_BUCKETS * sizeof(uint16_t))
+#define SLI_COMMAND_TRACE_ENTRY_SIZE  (2 * sizeof(uint16_t) + SL_SI91X_COMMAND_TRACE_STAGE_COUNT * SLI_COMMAND_TRACE_STAGE_SIZE)
+
+// A command between being queued and being collected by its caller
+typedef struct {
+  bool in_use;
+  uint8_t command_type;
+  uint8_t packet_id;
+  uint8_t last_point;
+  uint16_t frame_id;
+  uint32_t timestamp[SL_SI91X_COMMAND_TRACE_COMPLETE + 1]; // Indexed by trace point
+} sli_si91x_command_trace_pending_t;
+
+typedef struct {
+  uint16_t frame_id;
+  uint16_t timeouts;
+  sl_si91x_command_trace_histogram_t stage[SL_SI91X_COMMAND_TRACE_STAGE_COUNT];
+} sli_si91x_command_trace_entry_t;
+
+static sl_si91x_command_trace_event_t trace_events[SL_SI91X_COMMAND_TRACE_EVENT_COUNT];
+static uint32_t trace_write_index = 0; // Free-running
+static uint32_t trace_read_index  = 0; // Free-running
+static sli_si91x_command_trace_pending_t trace_pending[SL_SI91X_COMMAND_TRACE_MAX_PENDING];
+// The extra entry collects the commands that did not get an entry of their own
+static sli_si91x_command_trace_entry_t trace_entries[SL_SI91X_COMMAND_TRACE_MAX_COMMANDS + 1];
+static uint8_t trace_entry_count = 0;
+
+static sli_si91x_command_trace_pending_t *find_pending(uint8_t command_type,
+                                                       uint8_t packet_id,
+                                                       uint16_t frame_id,
+                                                       uint8_t last_point)
+{
+  sli_si91x_command_trace_pending_t *match = NULL;
+
+  for (uint8_t i = 0; i < SL_SI91X_COMMAND_TRACE_MAX_PENDING; i++) {
+    sli_si91x_command_trace_pending_t *pending = &trace_pending[i];
+    if (!pending->in_use || pending->last_point != last_point) {
+      continue;
+    }
+    if (command_type == SLI_SI91X_COMMAND_TRACE_ANY_QUEUE) {
+      // Responses only carry the frame ID; they complete the oldest matching command
+      if ((pending->frame_id == frame_id)
+          && ((match == NULL)
+              || ((int32_t)(pending->timestamp[SL_SI91X_COMMAND_TRACE_QUEUED]
+                            - match->timestamp[SL_SI91X_COMMAND_TRACE_QUEUED])
+                  < 0))) {
+        match = pending;
+      }
+    } else if ((pending->command_type == command_type) && (pending->packet_id == packet_id)) {
+      return pending;
+    }
+  }
+  return match;
+}
+
+static sli_si91x_command_trace_entry_t *get_entry(uint16_t frame_id)
+{
+  for (uint8_t i = 0; i < trace_entry_count; i++) {
+    if (trace_entries[i].frame_id == frame_id) {
+      return &trace_entries[i];
+    }
+  }
+  if (trace_entry_count < SL_SI91X_COMMAND_TRACE_MAX_COMMANDS) {
+    sli_si91x_command_trace_entry_t *entry = &trace_entries[trace_entry_count++];
+    entry->frame_id                        = frame_id;
+    return entry;
+  }
+  trace_entries[SL_SI91X_COMMAND_TRACE_MAX_COMMANDS].frame_id = SL_SI91X_COMMAND_TRACE_OTHER;
+  return &trace_entries[SL_SI91X_COMMAND_TRACE_MAX_COMMANDS];
+}
+
+static bool entry_in_use(uint8_t index)
+{
+  if (index < SL_SI91X_COMMAND_TRACE_MAX_COMMANDS) {
+    return index < trace_entry_count;
+  }
+  return trace_entries[index].frame_id == SL_SI91X_COMMAND_TRACE_OTHER;
+}
+
+static void add_sample(sl_si91x_command_trace_histogram_t *histogram, uint32_t cycles, uint32_t timer_frequency)
+{
+  uint32_t latency_us = (uint32_t)(((uint64_t)cycles * 1000000) / timer_frequency);
+  uint8_t bucket      = 0;
+
+  while ((bucket < (SL_SI91X_COMMAND_TRACE_HISTOGRAM_BUCKETS - 1)) && ((latency_us >> (bucket + 1)) != 0)) {
+    bucket++;
+  }
+  if (histogram->buckets[bucket] != UINT16_MAX) {
+    histogram->buckets[bucket]++;
+  }
+  if ((histogram->count == 0) || (latency_us < histogram->min_us)) {
+    histogram->min_us = latency_us;
+  }
+  if (latency_us > histogram->max_us) {
+    histogram->max_us = latency_us;
+  }
+  histogram->total_us += latency_us;
+  histogram->count++;
+}
+
+static void complete_command(const sli_si91x_command_trace_pending_t *pending)
+{
+  sli_si91x_command_trace_entry_t *entry = get_entry(pending->frame_id);
+  uint32_t timer_frequency               = osKernelGetSysTimerFreq();
+
+  if (timer_frequency == 0) {
+    return;
+  }
+  // Stage n spans from trace point n to trace point n + 1
+  for (uint8_t stage = 0; stage < SL_SI91X_COMMAND_TRACE_STAGE_COUNT; stage++) {
+    add_sample(&entry->stage[stage],
+               pending->timestamp[stage + 1] - pending->timestamp[stage],
+               timer_frequency);
+  }
+}
+
+void sli_si91x_command_trace(sl_si91x_command_trace_point_t point,
+                             uint8_t command_type,
+                             uint8_t packet_id,
+                             uint16_t frame_id)
+{
+  sli_si91x_command_trace_pending_t *pending = NULL;
+  uint32_t timestamp                         = osKernelGetSysTimerCount();
+
+  CORE_irqState_t state = CORE_EnterAtomic();
+
+  // Overwrite the oldest trace point when the ring buffer is full
+  if ((trace_write_index - trace_read_index) == SL_SI91X_COMMAND_TRACE_EVENT_COUNT) {
+    trace_read_index++;
+  }
+  sl_si91x_command_trace_event_t *event = &trace_events[trace_write_index & (SL_SI91X_COMMAND_TRACE_EVENT_COUNT - 1)];
+  event->timestamp                      = timestamp;
+  event->frame_id                       = frame_id;
+  event->point                          = (uint8_t)point;
+  event->packet_id                      = packet_id;
+  trace_write_index++;
+
+  switch (point) {
+    case SL_SI91X_COMMAND_TRACE_QUEUED:
+      for (uint8_t i = 0; i < SL_SI91X_COMMAND_TRACE_MAX_PENDING; i++) {
+        if (!trace_pending[i].in_use) {
+          pending = &trace_pending[i];
+          break;
+        }
+      }
+      // Commands queued while all pending slots are busy only show up in the event ring buffer
+      if (pending != NULL) {
+        pending->in_use       = true;
+        pending->command_type = command_type;
+        pending->packet_id    = packet_id;
+        pending->frame_id     = frame_id;
+        pending->last_point   = SL_SI91X_COMMAND_TRACE_QUEUED;
+        pending->timestamp[SL_SI91X_COMMAND_TRACE_QUEUED] = timestamp;
+      }
+      break;
+
+    case SL_SI91X_COMMAND_TRACE_BUS_START:
+    case SL_SI91X_COMMAND_TRACE_BUS_DONE:
+    case SL_SI91X_COMMAND_TRACE_RESPONSE:
+    case SL_SI91X_COMMAND_TRACE_COMPLETE:
+      pending = find_pending(command_type, packet_id, frame_id, (uint8_t)(point - 1));
+      if (pending != NULL) {
+        pending->last_point       = (uint8_t)point;
+        pending->timestamp[point] = timestamp;
+        if (point == SL_SI91X_COMMAND_TRACE_COMPLETE) {
+          complete_command(pending);
+          pending->in_use = false;
+        }
+      }
+      break;
+
+    case SL_SI91X_COMMAND_TRACE_TIMEOUT:
+      for (uint8_t i = 0; i < SL_SI91X_COMMAND_TRACE_MAX_PENDING; i++) {
+        pending = &trace_pending[i];
+        if (pending->in_use && (pending->command_type == command_type) && (pending->packet_id == packet_id)) {
+          sli_si91x_command_trace_entry_t *entry = get_entry(pending->frame_id);
+          if (entry->timeouts != UINT16_MAX) {
+            entry->timeouts++;
+          }
+          pending->in_use = false;
+          break;
+        }
+      }
+      break;
+
+    default:
+      // Data frames are only recorded in the event ring buffer
+      break;
+  }
+
+  CORE_ExitAtomic(state);
+}
+
+void sl_si91x_command_trace_reset(void)
+{
+  CORE_irqState_t state = CORE_EnterAtomic();
+  trace_write_index     = 0;
+  trace_read_index      = 0;
+  trace_entry_count     = 0;
+  memset(trace_pending, 0, sizeof(trace_pending));
+  memset(trace_entries, 0, sizeof(trace_entries));
+  CORE_ExitAtomic(state);
+}
+
+sl_status_t sl_si91x_command_trace_get_histogram(uint16_t frame_id,
+                                                 sl_si91x_command_trace_stage_t stage,
+                                                 sl_si91x_command_trace_histogram_t *histogram)
+{
+  sl_status_t status = SL_STATUS_NOT_FOUND;
+
+  SL_VERIFY_POINTER_OR_RETURN(histogram, SL_STATUS_NULL_POINTER);
+  if (stage >= SL_SI91X_COMMAND_TRACE_STAGE_COUNT) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  CORE_irqState_t state = CORE_EnterAtomic();
+  for (uint8_t i = 0; i <= SL_SI91X_COMMAND_TRACE_MAX_COMMANDS; i++) {
+    const sli_si91x_command_trace_entry_t *entry = &trace_entries[i];
+    if (entry_in_use(i) && (entry->frame_id == frame_id) && (entry->stage[stage].count != 0)) {
+      memcpy(histogram, &entry->stage[stage], sizeof(*histogram));
+      status = SL_STATUS_OK;
+      break;
+    }
+  }
+  CORE_ExitAtomic(state);
+
+  return status;
+}
+
+sl_status_t sl_si91x_command_trace_read_events(sl_si91x_command_trace_event_t *events,
+                                               uint32_t max_events,
+                                               uint32_t *event_count)
+{
+  SL_VERIFY_POINTER_OR_RETURN(events, SL_STATUS_NULL_POINTER);
+  SL_VERIFY_POINTER_OR_RETURN(event_count, SL_STATUS_NULL_POINTER);
+
+  uint32_t count        = 0;
+  CORE_irqState_t state = CORE_EnterAtomic();
+  while ((count < max_events) && (trace_read_index != trace_write_index)) {
+    events[count++] = trace_events[trace_read_index & (SL_SI91X_COMMAND_TRACE_EVENT_COUNT - 1)];
+    trace_read_index++;
+  }
+  CORE_ExitAtomic(state);
+
+  *event_count = count;
+  return SL_STATUS_OK;
+}
+
+static uint8_t *put_u16(uint8_t *out, uint16_t value)
+{
+  out[0] = (uint8_t)value;
+  out[1] = (uint8_t)(value >> 8);
+  return out + 2;
+}
+
+static uint8_t *put_u32(uint8_t *out, uint32_t value)
+{
+  out = put_u16(out, (uint16_t)value);
+  return put_u16(out, (uint16_t)(value >> 16));
+}
+
+sl_status_t sl_si91x_command_trace_export(uint8_t *buffer, uint32_t buffer_length, uint32_t *length)
+{
+  SL_VERIFY_POINTER_OR_RETURN(length, SL_STATUS_NULL_POINTER);
+
+  CORE_irqState_t state = CORE_EnterAtomic();
+
+  uint8_t entry_count = trace_entry_count;
+  if (entry_in_use(SL_SI91X_COMMAND_TRACE_MAX_COMMANDS)) {
+    entry_count++;
+  }
+  uint32_t required = SLI_COMMAND_TRACE_HEADER_SIZE + (entry_count * SLI_COMMAND_TRACE_ENTRY_SIZE);
+  *length           = required;
+  if ((buffer == NULL) || (buffer_length < required)) {
+    CORE_ExitAtomic(state);
+    return SL_STATUS_WOULD_OVERFLOW;
+  }
+
+  uint8_t *out = put_u32(buffer, SLI_COMMAND_TRACE_MAGIC);
+  *out++       = SLI_COMMAND_TRACE_VERSION;
+  *out++       = SL_SI91X_COMMAND_TRACE_STAGE_COUNT;
+  *out++       = SL_SI91X_COMMAND_TRACE_HISTOGRAM_BUCKETS;
+  *out++       = entry_count;
+  out          = put_u32(out, osKernelGetSysTimerFreq());
+
+  for (uint8_t i = 0; i <= SL_SI91X_COMMAND_TRACE_MAX_COMMANDS; i++) {
+    const sli_si91x_command_trace_entry_t *entry = &trace_entries[i];
+    if (!entry_in_use(i)) {
+      continue;
+    }
+    out = put_u16(out, entry->frame_id);
+    out = put_u16(out, entry->timeouts);
+    for (uint8_t stage = 0; stage < SL_SI91X_COMMAND_TRACE_STAGE_COUNT; stage++) {
+      out = put_u32(out, entry->stage[stage].count);
+      out = put_u32(out, entry->stage[stage].min_us);
+      out = put_u32(out, entry->stage[stage].max_us);
+      for (uint8_t bucket = 0; bucket < SL_SI91X_COMMAND_TRACE_HISTOGRAM_BUCKETS; bucket++) {
+        out = put_u16(out, entry->stage[stage].buckets[bucket]);
+      }
+    }
+  }
+
+  CORE_ExitAtomic(state);
+  return SL_STATUS_OK;
+}
+
+#endif // SL_SI91X_COMMAND_TRACE
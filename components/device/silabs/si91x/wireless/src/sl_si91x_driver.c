@@ -41,6 +41,7 @@
 #include <string.h>
 #include <assert.h>
 #include "sl_si91x_core_utilities.h"
+#include "sl_si91x_command_trace.h"
 #include "sl_core.h"
 #ifdef SLI_SI91X_MCU_INTERFACE
 #include "sli_siwx917_soc.h"
@@ -154,6 +155,14 @@ sl_status_t sli_si91x_driver_send_command_packet(uint32_t command,
                                                  void *sdk_context,
                                                  sl_wifi_buffer_t **data_buffer);
 static sl_status_t sl_si91x_driver_send_data_packet(sl_wifi_buffer_t *buffer, uint32_t wait_time);
+static sl_status_t sli_si91x_driver_complete_command_response(sli_si91x_command_type_t command_type,
+                                                              uint8_t packet_id,
+                                                              sl_wifi_buffer_t *response,
+                                                              sl_wifi_buffer_t **data_buffer);
+static void sli_si91x_abort_raw_data_frames(void);
+#ifdef SLI_SI91X_MCU_INTERFACE
+static void sli_si91x_collect_common_flash_read_prefetch(void);
+#endif
 sl_status_t sl_si91x_driver_raw_send_command(uint8_t command,
                                              const void *data,
                                              uint32_t data_length,
@@ -187,6 +196,18 @@ static uint32_t client_listen_interval_multiplier = 1;
 static sli_si91x_efuse_data_t si91x_efuse_data    = { 0 };
 //! Currently, initialized_opermode is used only to handle concurrent mode using sl_net_init()
 static uint16_t initialized_opermode = SL_SI91X_INVALID_MODE;
+
+// Raw data frames submitted with sl_si91x_driver_raw_send_command_async() that are still in sli_tx_data_queue.
+// Slots are filled in queue order, so the oldest slot always belongs to the next raw frame the bus thread sends.
+typedef struct {
+  const sl_wifi_buffer_t *buffer;
+  sl_wifi_raw_data_frame_callback_t callback;
+  void *context;
+} sli_si91x_raw_data_frame_slot_t;
+
+static sli_si91x_raw_data_frame_slot_t raw_data_frame_slots[SL_WIFI_RAW_DATA_FRAME_WINDOW];
+static volatile uint8_t raw_data_frame_head  = 0;
+static volatile uint8_t raw_data_frame_count = 0;
 extern sli_si91x_command_queue_t cmd_queues[SI91X_CMD_MAX];
 extern sli_si91x_buffer_queue_t sli_tx_data_queue;
 
@@ -639,6 +660,9 @@ sl_status_t sl_si91x_driver_deinit(void)
   }
 
 #ifdef SLI_SI91X_MCU_INTERFACE
+  // The read ahead of the common flash read cache is collected while its response can still arrive
+  sli_si91x_collect_common_flash_read_prefetch();
+
   // If the SLI_SI91X_MCU_INTERFACE is defined, perform a soft reset
   status = sl_si91x_soft_reset();
   VERIFY_STATUS_AND_RETURN(status);
@@ -670,6 +694,9 @@ sl_status_t sl_si91x_driver_deinit(void)
   // Flush the generic TX data queue
   sli_si91x_flush_generic_data_queues(&sli_tx_data_queue);
 
+  // Report the flushed asynchronous raw data frames to their submitters
+  sli_si91x_abort_raw_data_frames();
+
 #if defined(SLI_SI91X_OFFLOAD_NETWORK_STACK) && defined(SLI_SI91X_SOCKETS)
 
   // Flush all pending socket commands in the client VAP queue due to Wi-Fi connection loss
@@ -769,18 +796,17 @@ sl_status_t sli_si91x_get_flash_efuse_data(sli_si91x_efuse_data_t *efuse_data, u
   return SL_STATUS_OK;
 }
 
-sl_status_t sl_si91x_driver_raw_send_command(uint8_t command,
-                                             const void *data,
-                                             uint32_t data_length,
-                                             uint32_t wait_time)
+// Allocates a data buffer and fills in the host descriptor for a raw frame
+static sl_status_t sli_si91x_build_raw_data_packet(uint8_t command,
+                                                  const void *data,
+                                                  uint32_t data_length,
+                                                  sl_wifi_buffer_t **buffer)
 {
-  UNUSED_PARAMETER(wait_time);
-  sl_wifi_buffer_t *buffer;
   sl_wifi_system_packet_t *packet;
   sl_status_t status = SL_STATUS_OK;
 
   // Allocate a data buffer with space for the data and metadata
-  status = sl_si91x_allocate_data_buffer(&buffer,
+  status = sl_si91x_allocate_data_buffer(buffer,
                                          (void **)&packet,
                                          sizeof(sl_wifi_system_packet_t) + data_length,
                                          SLI_WIFI_ALLOCATE_COMMAND_BUFFER_WAIT_TIME);
@@ -799,10 +825,99 @@ sl_status_t sl_si91x_driver_raw_send_command(uint8_t command,
   packet->length  = data_length & 0xFFF;
   packet->command = command;
 
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_si91x_driver_raw_send_command(uint8_t command,
+                                             const void *data,
+                                             uint32_t data_length,
+                                             uint32_t wait_time)
+{
+  sl_wifi_buffer_t *buffer;
+  sl_status_t status;
+
+  status = sli_si91x_build_raw_data_packet(command, data, data_length, &buffer);
+  VERIFY_STATUS_AND_RETURN(status);
+
   // Adding the packet to the queue with atomic action
   return sl_si91x_driver_send_data_packet(buffer, wait_time);
 }
 
+sl_status_t sl_si91x_driver_raw_send_command_async(uint8_t command,
+                                                   const void *data,
+                                                   uint32_t data_length,
+                                                   sl_wifi_raw_data_frame_callback_t callback,
+                                                   void *context)
+{
+  sl_wifi_buffer_t *buffer;
+  sl_status_t status;
+
+  // Fail fast before allocating when the window is already full
+  if (raw_data_frame_count >= SL_WIFI_RAW_DATA_FRAME_WINDOW) {
+    return SL_STATUS_WOULD_BLOCK;
+  }
+
+  status = sli_si91x_build_raw_data_packet(command, data, data_length, &buffer);
+  VERIFY_STATUS_AND_RETURN(status);
+
+  // Claim the slot and queue the frame in one atomic section so slot order matches queue order
+  CORE_irqState_t state = CORE_EnterAtomic();
+  if (raw_data_frame_count >= SL_WIFI_RAW_DATA_FRAME_WINDOW) {
+    CORE_ExitAtomic(state);
+    sli_si91x_host_free_buffer(buffer);
+    return SL_STATUS_WOULD_BLOCK;
+  }
+  uint8_t slot = (uint8_t)((raw_data_frame_head + raw_data_frame_count) % SL_WIFI_RAW_DATA_FRAME_WINDOW);
+  raw_data_frame_slots[slot].buffer   = buffer;
+  raw_data_frame_slots[slot].callback = callback;
+  raw_data_frame_slots[slot].context  = context;
+  raw_data_frame_count++;
+  sli_si91x_append_to_buffer_queue(&sli_tx_data_queue, buffer);
+  tx_generic_socket_data_queues_status |= SL_SI91X_GENERIC_DATA_TX_PENDING_EVENT;
+  sli_si91x_set_event(SL_SI91X_GENERIC_DATA_TX_PENDING_EVENT);
+  CORE_ExitAtomic(state);
+
+  return SL_STATUS_OK;
+}
+
+uint8_t sl_si91x_driver_get_pending_raw_data_frames(void)
+{
+  return raw_data_frame_count;
+}
+
+void sli_si91x_raw_data_frame_sent(const sl_wifi_buffer_t *buffer, sl_status_t status)
+{
+  sl_wifi_raw_data_frame_callback_t callback;
+  void *context;
+
+  CORE_irqState_t state = CORE_EnterAtomic();
+  if ((raw_data_frame_count == 0) || (raw_data_frame_slots[raw_data_frame_head].buffer != buffer)) {
+    // Not an asynchronous raw data frame
+    CORE_ExitAtomic(state);
+    return;
+  }
+  callback = raw_data_frame_slots[raw_data_frame_head].callback;
+  context  = raw_data_frame_slots[raw_data_frame_head].context;
+
+  raw_data_frame_slots[raw_data_frame_head].buffer = NULL;
+
+  raw_data_frame_head  = (uint8_t)((raw_data_frame_head + 1) % SL_WIFI_RAW_DATA_FRAME_WINDOW);
+  raw_data_frame_count = (uint8_t)(raw_data_frame_count - 1);
+  CORE_ExitAtomic(state);
+
+  if (callback != NULL) {
+    callback(status, context);
+  }
+}
+
+// Completes every outstanding raw data frame with SL_STATUS_ABORT once sli_tx_data_queue has been flushed
+static void sli_si91x_abort_raw_data_frames(void)
+{
+  while (raw_data_frame_count != 0) {
+    sli_si91x_raw_data_frame_sent(raw_data_frame_slots[raw_data_frame_head].buffer, SL_STATUS_ABORT);
+  }
+}
+
 sl_status_t sli_si91x_driver_send_socket_data(const sli_si91x_socket_send_request_t *request,
                                               const void *data,
                                               uint32_t wait_time)
@@ -1003,7 +1118,17 @@ sl_status_t sli_si91x_driver_send_bt_command(sli_wlan_cmd_request_t command,
     return SL_STATUS_INVALID_INDEX;
   }
 
-  if (sync_command) {
+  if (sync_command == SLI_SI91X_BT_COMMAND_WITH_CALLBACK) {
+    // The response is delivered to the callback of the command, nobody waits for its TX done notification
+    return sli_si91x_driver_queue_command_packet(command,
+                                                 command_type,
+                                                 data,
+                                                 wait_period,
+                                                 NULL,
+                                                 false,
+                                                 SI91X_PACKET_NO_TX_DONE_NOTIFY,
+                                                 NULL);
+  } else if (sync_command) {
     return sli_si91x_driver_send_command_packet(command, command_type, data, wait_period, NULL, NULL);
   } else {
     return sli_si91x_driver_send_async_command(command, command_type, data, 0);
@@ -1091,22 +1216,20 @@ sl_status_t sli_si91x_driver_wait_for_response_packet(sli_si91x_buffer_queue_t *
   return SL_STATUS_FAIL;
 }
 
-sl_status_t sli_si91x_driver_send_command_packet(uint32_t command,
-                                                 sli_si91x_command_type_t command_type,
-                                                 sl_wifi_buffer_t *buffer,
-                                                 sli_si91x_wait_period_t wait_period,
-                                                 void *sdk_context,
-                                                 sl_wifi_buffer_t **data_buffer)
+sl_status_t sli_si91x_driver_queue_command_packet(uint32_t command,
+                                                  sli_si91x_command_type_t command_type,
+                                                  sl_wifi_buffer_t *buffer,
+                                                  sli_si91x_wait_period_t wait_period,
+                                                  void *sdk_context,
+                                                  bool response_packet,
+                                                  uint8_t extra_flags,
+                                                  uint8_t *packet_id)
 {
-  uint16_t firmware_status;
   sli_si91x_queue_packet_t *node = NULL;
   sl_status_t status;
   sl_wifi_buffer_t *packet;
-  sl_wifi_buffer_t *response;
-  uint8_t flags                     = 0;
-  uint16_t data_length              = 0;
-  sli_si91x_wait_period_t wait_time = 0;
-  static uint8_t command_packet_id  = 0;
+  uint8_t flags                    = 0;
+  static uint8_t command_packet_id = 0;
 
   // Allocate a command packet and set flags based on the command type
   status = sli_si91x_allocate_command_buffer(&packet,
@@ -1133,11 +1256,13 @@ sl_status_t sli_si91x_driver_send_command_packet(uint32_t command,
     // If not an immediate return, set the SI91X_PACKET_RESPONSE_STATUS flag
     flags |= SI91X_PACKET_RESPONSE_STATUS;
     // Additionally, set the SI91X_PACKET_RESPONSE_PACKET flag if the SLI_SI91X_WAIT_FOR_RESPONSE_BIT is set in wait_period
-    if (data_buffer != NULL) {
+    if (response_packet) {
       flags |= ((wait_period & SLI_SI91X_WAIT_FOR_RESPONSE_BIT) ? SI91X_PACKET_RESPONSE_PACKET : 0);
     }
   }
 
+  flags |= extra_flags;
+
   // Check the command type and set the flags accordingly
   switch (command) {
     case SLI_COMMON_REQ_PWRMODE:
@@ -1145,6 +1270,29 @@ sl_status_t sli_si91x_driver_send_command_packet(uint32_t command,
     case SLI_COMMON_REQ_SOFT_RESET:
       flags |= SI91X_PACKET_GLOBAL_QUEUE_BLOCK;
       break;
+    case SLI_COMMON_REQ_TA_M4_COMMANDS:
+      // Common flash chunks are queued a window at a time and each may take the full timeout
+      flags |= SI91X_PACKET_TIMEOUT_FROM_SEND;
+      break;
+    default:
+      break;
+  }
+
+  // Queries without side effects may be in flight together; every other command stays ordered.
+  // Crypto requests are not among them, multi-part operations keep state between requests
+  switch (command) {
+    case SLI_COMMON_REQ_GET_RTC_TIMER:
+    case SLI_WLAN_REQ_QUERY_NETWORK_PARAMS:
+    case SLI_WLAN_REQ_RSSI:
+    case SLI_WLAN_REQ_FW_VERSION:
+    case SLI_WLAN_REQ_MAC_ADDRESS:
+    case SLI_WLAN_REQ_QUERY_GO_PARAMS:
+    case SLI_WLAN_REQ_EXT_STATS:
+    case SLI_WLAN_REQ_CONNECTION_STATUS:
+    case SLI_WLAN_REQ_GET_STATS:
+    case SLI_WLAN_REQ_GET_RANDOM:
+      flags |= SI91X_PACKET_INDEPENDENT;
+      break;
     default:
       break;
   }
@@ -1156,10 +1304,6 @@ sl_status_t sli_si91x_driver_send_command_packet(uint32_t command,
   node->flags             = flags;
   node->sdk_context       = sdk_context;
 
-  // Configure the context for packet handling
-  //  context.packet = node;
-  //  context.payload = &(queue_packet_id[command_type]);
-
   if (flags != SI91X_PACKET_WITH_ASYNC_RESPONSE) {
     node->command_tickcount = osKernelGetTickCount();
     // Calculate the wait time based on wait_period
@@ -1185,15 +1329,52 @@ sl_status_t sli_si91x_driver_send_command_packet(uint32_t command,
   buffer->id        = this_packet_id;
   packet->id        = this_packet_id;
   packet->node.node = NULL;
+  // Commands nobody waits for never reach COMPLETE or TIMEOUT, they would hold a pending trace slot forever.
+  // Their bus trace points are still recorded in the event ring buffer
+  if (flags & SI91X_PACKET_RESPONSE_STATUS) {
+    SLI_SI91X_COMMAND_TRACE(SL_SI91X_COMMAND_TRACE_QUEUED, command_type, this_packet_id, command);
+  }
   sli_si91x_append_to_buffer_queue(&cmd_queues[command_type].tx_queue, packet);
   tx_command_queues_status |= SL_SI91X_TX_PENDING_FLAG(command_type);
   sli_si91x_set_event(SL_SI91X_TX_PENDING_FLAG(command_type));
   CORE_ExitAtomic(state);
 
-  // Check if the command should return immediately or wait for a response
-  if (wait_period == SLI_SI91X_RETURN_IMMEDIATELY) {
-    return SL_STATUS_IN_PROGRESS;
+  if (packet_id != NULL) {
+    *packet_id = this_packet_id;
   }
+  return SL_STATUS_IN_PROGRESS;
+}
+
+// Removes a command that has not been sent to the NWP yet from its TX queue and frees it
+static sl_status_t sli_si91x_driver_withdraw_queued_command(sli_si91x_command_type_t command_type, uint8_t packet_id)
+{
+  // Declare a temporary packet pointer to hold the packet to be removed
+  sl_wifi_buffer_t *temp_packet;
+  sl_status_t status = sli_si91x_remove_buffer_from_queue_by_comparator(&cmd_queues[command_type].tx_queue,
+                                                                        &packet_id,
+                                                                        sli_si91x_packet_identification_function,
+                                                                        &temp_packet);
+  VERIFY_STATUS_AND_RETURN(status);
+
+  // Retrieve the actual packet node data from the removed buffer
+  sli_si91x_queue_packet_t *temp_node = sl_si91x_host_get_buffer_data(temp_packet, 0, NULL);
+
+  // Free the host packet memory associated with the node (TX packet memory)
+  sli_si91x_host_free_buffer(temp_node->host_packet);
+
+  // Free the temporary buffer memory that held the packet
+  sli_si91x_host_free_buffer(temp_packet);
+  return SL_STATUS_OK;
+}
+
+sl_status_t sli_si91x_driver_collect_command_response(sli_si91x_command_type_t command_type,
+                                                      uint8_t packet_id,
+                                                      sli_si91x_wait_period_t wait_period,
+                                                      sl_wifi_buffer_t **data_buffer)
+{
+  sl_status_t status;
+  sl_wifi_buffer_t *response;
+  sli_si91x_wait_period_t wait_time = 0;
 
   // Calculate the wait time based on wait_period
   if ((wait_period & SLI_SI91X_WAIT_FOR_EVER) == SLI_SI91X_WAIT_FOR_EVER) {
@@ -1206,32 +1387,52 @@ sl_status_t sli_si91x_driver_send_command_packet(uint32_t command,
   status = sli_si91x_driver_wait_for_response_packet(&cmd_queues[command_type].rx_queue,
                                                      si91x_events,
                                                      SL_SI91X_RESPONSE_FLAG(command_type),
-                                                     this_packet_id,
+                                                     packet_id,
                                                      wait_time,
                                                      &response);
   // Check if the status is SL_STATUS_TIMEOUT, indicating a timeout has occurred
   if (status == SL_STATUS_TIMEOUT) {
-    // Declare a temporary packet pointer to hold the packet to be removed
-    sl_wifi_buffer_t *temp_packet;
-    sl_status_t temp_status = sli_si91x_remove_buffer_from_queue_by_comparator(&cmd_queues[command_type].tx_queue,
-                                                                               &this_packet_id,
-                                                                               sli_si91x_packet_identification_function,
-                                                                               &temp_packet);
-
-    // Check if the packet removal was successful
-    if (temp_status == SL_STATUS_OK) {
-
-      // Retrieve the actual packet node data from the removed buffer
-      sli_si91x_queue_packet_t *temp_node = sl_si91x_host_get_buffer_data(temp_packet, 0, NULL);
+    SLI_SI91X_COMMAND_TRACE(SL_SI91X_COMMAND_TRACE_TIMEOUT, command_type, packet_id, 0);
+    // The command may not have been sent yet
+    sli_si91x_driver_withdraw_queued_command(command_type, packet_id);
+  }
+  VERIFY_STATUS_AND_RETURN(status);
+  return sli_si91x_driver_complete_command_response(command_type, packet_id, response, data_buffer);
+}
 
-      // Free the host packet memory associated with the node (TX packet memory)
-      sli_si91x_host_free_buffer(temp_node->host_packet);
+sl_status_t sli_si91x_driver_poll_command_response(sli_si91x_command_type_t command_type,
+                                                   uint8_t packet_id,
+                                                   uint32_t wait_time,
+                                                   sl_wifi_buffer_t **data_buffer)
+{
+  sl_wifi_buffer_t *response;
 
-      // Free the temporary buffer memory that held the packet
-      sli_si91x_host_free_buffer(temp_packet);
-    }
+  // Unlike a collect, a missing response leaves the command queued
+  sl_status_t status = sli_si91x_driver_wait_for_response_packet(&cmd_queues[command_type].rx_queue,
+                                                                 si91x_events,
+                                                                 SL_SI91X_RESPONSE_FLAG(command_type),
+                                                                 packet_id,
+                                                                 wait_time,
+                                                                 &response);
+  if (status == SL_STATUS_TIMEOUT) {
+    return SL_STATUS_IN_PROGRESS;
   }
   VERIFY_STATUS_AND_RETURN(status);
+  return sli_si91x_driver_complete_command_response(command_type, packet_id, response, data_buffer);
+}
+
+static sl_status_t sli_si91x_driver_complete_command_response(sli_si91x_command_type_t command_type,
+                                                              uint8_t packet_id,
+                                                              sl_wifi_buffer_t *response,
+                                                              sl_wifi_buffer_t **data_buffer)
+{
+  uint16_t firmware_status;
+  sli_si91x_queue_packet_t *node = NULL;
+  uint16_t data_length           = 0;
+
+  SLI_SI91X_COMMAND_TRACE(SL_SI91X_COMMAND_TRACE_COMPLETE, command_type, packet_id, 0);
+  UNUSED_PARAMETER(command_type);
+  UNUSED_PARAMETER(packet_id);
 
   // Process the response packet and return the firmware status
   node            = (sli_si91x_queue_packet_t *)sl_si91x_host_get_buffer_data(response, 0, &data_length);
@@ -1251,6 +1452,34 @@ sl_status_t sli_si91x_driver_send_command_packet(uint32_t command,
   return sli_convert_and_save_firmware_status(firmware_status);
 }
 
+sl_status_t sli_si91x_driver_send_command_packet(uint32_t command,
+                                                 sli_si91x_command_type_t command_type,
+                                                 sl_wifi_buffer_t *buffer,
+                                                 sli_si91x_wait_period_t wait_period,
+                                                 void *sdk_context,
+                                                 sl_wifi_buffer_t **data_buffer)
+{
+  uint8_t packet_id  = 0;
+  sl_status_t status = sli_si91x_driver_queue_command_packet(command,
+                                                             command_type,
+                                                             buffer,
+                                                             wait_period,
+                                                             sdk_context,
+                                                             (data_buffer != NULL),
+                                                             0,
+                                                             &packet_id);
+  if (status != SL_STATUS_IN_PROGRESS) {
+    return status;
+  }
+
+  // Check if the command should return immediately or wait for a response
+  if (wait_period == SLI_SI91X_RETURN_IMMEDIATELY) {
+    return SL_STATUS_IN_PROGRESS;
+  }
+
+  return sli_si91x_driver_collect_command_response(command_type, packet_id, wait_period, data_buffer);
+}
+
 static sl_status_t sl_si91x_driver_send_data_packet(sl_wifi_buffer_t *buffer, uint32_t wait_time)
 {
   UNUSED_PARAMETER(wait_time);
@@ -1827,133 +2056,303 @@ sl_status_t sl_si91x_set_device_region(sl_wifi_operation_mode_t operation_mode,
 
 #ifdef SLI_SI91X_MCU_INTERFACE
 
-sl_status_t sl_si91x_command_to_write_common_flash(uint32_t write_address,
-                                                   const uint8_t *write_data,
-                                                   uint16_t write_data_length,
-                                                   uint8_t flash_sector_erase_enable)
+static void sli_si91x_invalidate_common_flash_read_cache(uint32_t address, uint32_t length);
+
+// Sector erase is sent in chunks of 4k, writes in chunks of MAX_CHUNK_SIZE
+static uint16_t sli_si91x_common_flash_chunk_size(const sl_si91x_common_flash_write_t *operation, uint32_t remaining)
+{
+  uint16_t max_chunk_size = (operation->flash_sector_erase_enable == 1) ? FLASH_SECTOR_SIZE : MAX_CHUNK_SIZE;
+
+  return (remaining < max_chunk_size) ? (uint16_t)remaining : max_chunk_size;
+}
+
+// Records a failed chunk, keeping the status of the one at the lowest address
+static void sli_si91x_fail_common_flash_write(sl_si91x_common_flash_write_t *operation,
+                                              uint32_t chunk_address,
+                                              sl_status_t status)
+{
+  if ((operation->status == SL_STATUS_OK) || (chunk_address < operation->failed_address)) {
+    operation->status         = status;
+    operation->failed_address = chunk_address;
+  }
+}
+
+// Removes the chunks that are still waiting in the TX queue so nothing past a failed chunk is written.
+// The TX queue is sent in order, so once a chunk is found already sent, all older ones were sent as well.
+static void sli_si91x_withdraw_common_flash_chunks(sl_si91x_common_flash_write_t *operation)
+{
+  while (operation->in_flight > 0) {
+    uint8_t slot = (uint8_t)((operation->head + operation->in_flight - 1) % SL_SI91X_COMMON_FLASH_WRITE_WINDOW);
+    if (sli_si91x_driver_withdraw_queued_command(SI91X_COMMON_CMD, operation->packet_id[slot]) != SL_STATUS_OK) {
+      break;
+    }
+    SLI_SI91X_COMMAND_TRACE(SL_SI91X_COMMAND_TRACE_TIMEOUT, SI91X_COMMON_CMD, operation->packet_id[slot], 0);
+    operation->in_flight--;
+  }
+}
+
+static sl_status_t sli_si91x_queue_common_flash_chunk(sl_si91x_common_flash_write_t *operation)
+{
+  sl_wifi_buffer_t *buffer;
+  sl_wifi_system_packet_t *packet;
+  sli_si91x_request_ta2m4_t *request;
+  uint16_t chunk_size;
+  uint32_t data_length;
+  uint8_t slot;
+  sl_status_t status;
+
+  chunk_size = sli_si91x_common_flash_chunk_size(operation, operation->remaining_length);
+  if (operation->flash_sector_erase_enable == 1) {
+    data_length = sizeof(sli_si91x_request_ta2m4_t) - MAX_CHUNK_SIZE;
+  } else {
+    data_length = sizeof(sli_si91x_request_ta2m4_t) - MAX_CHUNK_SIZE + chunk_size;
+  }
+
+  // Build the request directly in the command buffer so the chunk is copied only once
+  status = sli_si91x_allocate_command_buffer(&buffer,
+                                             (void **)&packet,
+                                             sizeof(sl_wifi_system_packet_t) + data_length,
+                                             SLI_WIFI_ALLOCATE_COMMAND_BUFFER_WAIT_TIME);
+  VERIFY_STATUS_AND_RETURN(status);
+
+  memset(packet->desc, 0, sizeof(packet->desc));
+  request                            = (sli_si91x_request_ta2m4_t *)packet->data;
+  request->sub_cmd                   = SL_SI91X_WRITE_TO_COMMON_FLASH;
+  request->addr                      = operation->write_address;
+  request->input_buffer_length       = chunk_size;
+  request->flash_sector_erase_enable = operation->flash_sector_erase_enable;
+  if (operation->flash_sector_erase_enable != 1) {
+    memcpy(request->input_data, operation->write_data, chunk_size);
+    operation->write_data += chunk_size;
+  }
+  packet->length  = data_length & 0xFFF;
+  packet->command = SLI_COMMON_REQ_TA_M4_COMMANDS;
+
+  slot   = (uint8_t)((operation->head + operation->in_flight) % SL_SI91X_COMMON_FLASH_WRITE_WINDOW);
+  status = sli_si91x_driver_queue_command_packet(SLI_COMMON_REQ_TA_M4_COMMANDS,
+                                                 SI91X_COMMON_CMD,
+                                                 buffer,
+                                                 SLI_SI91X_WAIT_FOR_COMMAND_SUCCESS,
+                                                 NULL,
+                                                 false,
+                                                 0,
+                                                 &operation->packet_id[slot]);
+  if (status != SL_STATUS_IN_PROGRESS) {
+    return status;
+  }
+
+  operation->in_flight++;
+  operation->write_address += chunk_size;
+  operation->remaining_length -= chunk_size;
+  return SL_STATUS_OK;
+}
+
+static void sli_si91x_fill_common_flash_window(sl_si91x_common_flash_write_t *operation)
 {
+  while ((operation->status == SL_STATUS_OK) && (operation->remaining_length > 0)
+         && (operation->in_flight < SL_SI91X_COMMON_FLASH_WRITE_WINDOW)) {
+    sl_status_t status = sli_si91x_queue_common_flash_chunk(operation);
+    if (status != SL_STATUS_OK) {
+      sli_si91x_fail_common_flash_write(operation, operation->write_address, status);
+    }
+  }
+}
+
+sl_status_t sl_si91x_command_to_write_common_flash_start(sl_si91x_common_flash_write_t *operation,
+                                                         uint32_t write_address,
+                                                         const uint8_t *write_data,
+                                                         uint16_t write_data_length,
+                                                         uint8_t flash_sector_erase_enable)
+{
+  SL_VERIFY_POINTER_OR_RETURN(operation, SL_STATUS_NULL_POINTER);
+
   // Check if write_data_length is non-zero
   if (write_data_length == 0) {
     return SL_STATUS_INVALID_PARAMETER;
   }
 
-  sl_status_t status                         = SL_STATUS_OK;
-  sli_si91x_request_ta2m4_t ta_to_m4_request = { 0 };
-  uint32_t send_size                         = 0;
-  uint16_t remaining_length                  = write_data_length;
+  // Check if write_data pointer is valid for flash writes
+  if (flash_sector_erase_enable != 1) {
+    SL_VERIFY_POINTER_OR_RETURN(write_data, SL_STATUS_INVALID_PARAMETER);
+  }
 
-  // If flash_sector_erase_enable is 1, Send request to NWP in chunks of 4k
-  if (flash_sector_erase_enable == 1) {
-    while (remaining_length > 0) {
-      // Calculate the chunk size, capped at 4k
-      size_t chunkSize = (remaining_length < FLASH_SECTOR_SIZE) ? remaining_length : FLASH_SECTOR_SIZE;
+  // Cached reads of the affected region would return stale data
+  sli_si91x_invalidate_common_flash_read_cache(write_address, write_data_length);
 
-      // Fill the request structure
-      memset(&ta_to_m4_request, 0, sizeof(sli_si91x_request_ta2m4_t));
-      ta_to_m4_request.sub_cmd                   = SL_SI91X_WRITE_TO_COMMON_FLASH;
-      ta_to_m4_request.addr                      = write_address;
-      ta_to_m4_request.input_buffer_length       = (uint16_t)chunkSize;
-      ta_to_m4_request.flash_sector_erase_enable = flash_sector_erase_enable;
+  memset(operation, 0, sizeof(sl_si91x_common_flash_write_t));
+  operation->start_address             = write_address;
+  operation->length                    = write_data_length;
+  operation->head_address              = write_address;
+  operation->write_address             = write_address;
+  operation->write_data                = write_data;
+  operation->remaining_length          = write_data_length;
+  operation->flash_sector_erase_enable = flash_sector_erase_enable;
+  operation->status                    = SL_STATUS_OK;
+  operation->head_tickcount            = osKernelGetTickCount();
 
-      send_size = sizeof(sli_si91x_request_ta2m4_t);
+  sli_si91x_fill_common_flash_window(operation);
+  if (operation->in_flight == 0) {
+    return operation->status;
+  }
+  return SL_STATUS_IN_PROGRESS;
+}
 
-      status = sli_si91x_driver_send_command(SLI_COMMON_REQ_TA_M4_COMMANDS,
-                                             SI91X_COMMON_CMD,
-                                             &ta_to_m4_request,
-                                             send_size,
-                                             SLI_SI91X_WAIT_FOR_COMMAND_SUCCESS,
-                                             NULL,
-                                             NULL);
-      VERIFY_STATUS_AND_RETURN(status);
+sl_status_t sl_si91x_common_flash_write_process(sl_si91x_common_flash_write_t *operation, uint32_t wait_time)
+{
+  sl_status_t status;
+  uint32_t elapsed_time;
+  uint32_t remaining_time;
+  bool collected = false;
+
+  SL_VERIFY_POINTER_OR_RETURN(operation, SL_STATUS_NULL_POINTER);
+
+  while (operation->in_flight > 0) {
+    const uint8_t packet_id     = operation->packet_id[operation->head];
+    const uint32_t head_address = operation->head_address;
+
+    if (operation->status == SL_STATUS_OK) {
+      // Chunks are sent one after another, so the oldest one was sent no earlier than head_tickcount
+      elapsed_time   = sl_si91x_host_elapsed_time(operation->head_tickcount);
+      remaining_time = (elapsed_time < SLI_SI91X_WAIT_FOR_COMMAND_SUCCESS)
+                         ? (SLI_SI91X_WAIT_FOR_COMMAND_SUCCESS - elapsed_time)
+                         : 0;
+      if (wait_time < remaining_time) {
+        status = sli_si91x_driver_poll_command_response(SI91X_COMMON_CMD, packet_id, wait_time, NULL);
+        if (status == SL_STATUS_IN_PROGRESS) {
+          // The oldest chunk has not completed yet and may still do so
+          return SL_STATUS_IN_PROGRESS;
+        }
+      } else {
+        status = sli_si91x_driver_collect_command_response(SI91X_COMMON_CMD,
+                                                           packet_id,
+                                                           SL_SI91X_WAIT_FOR(remaining_time),
+                                                           NULL);
+      }
+    } else {
+      status = sli_si91x_driver_collect_command_response(SI91X_COMMON_CMD,
+                                                         packet_id,
+                                                         SLI_SI91X_WAIT_FOR_COMMAND_SUCCESS,
+                                                         NULL);
+    }
 
-      // Adjust write_address for the next chunk
-      write_address += chunkSize;
+    operation->head = (uint8_t)((operation->head + 1) % SL_SI91X_COMMON_FLASH_WRITE_WINDOW);
+    operation->in_flight--;
+    operation->head_address +=
+      sli_si91x_common_flash_chunk_size(operation, operation->start_address + operation->length - head_address);
+    operation->head_tickcount = osKernelGetTickCount();
+    collected                 = true;
 
-      // Adjust remaining_length for the next chunk
-      remaining_length -= chunkSize;
+    // After a failure no new chunks are queued, unsent ones are withdrawn and the sent ones are drained
+    if (status != SL_STATUS_OK) {
+      sli_si91x_fail_common_flash_write(operation, head_address, status);
+      sli_si91x_withdraw_common_flash_chunks(operation);
+    }
+    if (operation->status != SL_STATUS_OK) {
+      continue;
     }
+
+    sli_si91x_fill_common_flash_window(operation);
   }
 
-  else {
-    // Check if write_data pointer is valid
-    SL_VERIFY_POINTER_OR_RETURN(write_data, SL_STATUS_INVALID_PARAMETER);
+  if (collected) {
+    // Reads served while the write was in progress may have cached the old contents
+    sli_si91x_invalidate_common_flash_read_cache(operation->start_address, operation->length);
+  }
 
-    // Write in chunks of MAX_CHUNK_SIZE for flash_sector_erase_enable != 1
-    while (write_data_length > 0) {
-      size_t chunkSize = (write_data_length < MAX_CHUNK_SIZE) ? write_data_length : MAX_CHUNK_SIZE;
-
-      // Fill the request structure
-      memset(&ta_to_m4_request, 0, sizeof(sli_si91x_request_ta2m4_t));
-      ta_to_m4_request.sub_cmd                   = SL_SI91X_WRITE_TO_COMMON_FLASH;
-      ta_to_m4_request.addr                      = write_address;
-      ta_to_m4_request.input_buffer_length       = (uint16_t)chunkSize;
-      ta_to_m4_request.flash_sector_erase_enable = flash_sector_erase_enable;
-
-      // Copy write_data into the request structure
-      memcpy(&ta_to_m4_request.input_data, write_data, chunkSize);
-
-      // Calculate the send size and send the command to write to common flash
-      send_size = sizeof(sli_si91x_request_ta2m4_t) - MAX_CHUNK_SIZE + chunkSize;
-      status    = sli_si91x_driver_send_command(SLI_COMMON_REQ_TA_M4_COMMANDS,
-                                             SI91X_COMMON_CMD,
-                                             &ta_to_m4_request,
-                                             send_size,
-                                             SLI_SI91X_WAIT_FOR_COMMAND_SUCCESS,
-                                             NULL,
-                                             NULL);
-      VERIFY_STATUS_AND_RETURN(status);
+  if ((operation->in_flight > 0) || ((operation->status == SL_STATUS_OK) && (operation->remaining_length > 0))) {
+    return SL_STATUS_IN_PROGRESS;
+  }
+  return operation->status;
+}
 
-      // Adjust pointers and counters
-      write_address += chunkSize;
-      write_data += chunkSize;
-      write_data_length -= chunkSize;
-    }
+sl_status_t sl_si91x_command_to_write_common_flash(uint32_t write_address,
+                                                   const uint8_t *write_data,
+                                                   uint16_t write_data_length,
+                                                   uint8_t flash_sector_erase_enable)
+{
+  sl_si91x_common_flash_write_t operation;
+
+  sl_status_t status = sl_si91x_command_to_write_common_flash_start(&operation,
+                                                                    write_address,
+                                                                    write_data,
+                                                                    write_data_length,
+                                                                    flash_sector_erase_enable);
+  while (status == SL_STATUS_IN_PROGRESS) {
+    status = sl_si91x_common_flash_write_process(&operation, SLI_SI91X_WAIT_FOR_COMMAND_SUCCESS);
   }
   return status;
 }
 
-sl_status_t sl_si91x_command_to_read_common_flash(uint32_t read_address, size_t length, uint8_t *output_buffer)
+static sl_status_t sli_si91x_queue_common_flash_read(uint32_t read_address, uint16_t length, uint8_t *packet_id)
 {
-  // Check if output_buffer pointer is valid
-  SL_VERIFY_POINTER_OR_RETURN(output_buffer, SL_STATUS_INVALID_PARAMETER);
+  sl_wifi_buffer_t *buffer;
+  sl_wifi_system_packet_t *packet;
+  sli_si91x_read_flash_request_t *request;
 
-  // Check if length is non-zero
-  if (length == 0) {
-    return SL_STATUS_INVALID_PARAMETER;
-  }
+  sl_status_t status = sli_si91x_allocate_command_buffer(&buffer,
+                                                         (void **)&packet,
+                                                         sizeof(sl_wifi_system_packet_t)
+                                                           + sizeof(sli_si91x_read_flash_request_t),
+                                                         SLI_WIFI_ALLOCATE_COMMAND_BUFFER_WAIT_TIME);
+  VERIFY_STATUS_AND_RETURN(status);
 
-  sl_status_t status                    = SL_STATUS_OK;
+  memset(packet->desc, 0, sizeof(packet->desc));
+  request                       = (sli_si91x_read_flash_request_t *)packet->data;
+  request->sub_cmd              = SL_SI91X_READ_FROM_COMMON_FLASH;
+  request->nwp_address          = read_address;
+  request->output_buffer_length = length;
+  packet->length                = sizeof(sli_si91x_read_flash_request_t) & 0xFFF;
+  packet->command               = SLI_COMMON_REQ_TA_M4_COMMANDS;
+
+  status = sli_si91x_driver_queue_command_packet(SLI_COMMON_REQ_TA_M4_COMMANDS,
+                                                 SI91X_COMMON_CMD,
+                                                 buffer,
+                                                 SL_SI91X_WAIT_FOR_RESPONSE(32000),
+                                                 NULL,
+                                                 true,
+                                                 0,
+                                                 packet_id);
+  return (status == SL_STATUS_IN_PROGRESS) ? SL_STATUS_OK : status;
+}
+
+static sl_status_t sli_si91x_collect_common_flash_read(uint8_t packet_id,
+                                                       uint8_t *output_buffer,
+                                                       uint16_t length,
+                                                       uint16_t *received_length)
+{
   sl_wifi_buffer_t *buffer              = NULL;
   const sl_wifi_system_packet_t *packet = NULL;
 
-  while (length > 0) {
-    size_t chunkSize = (length < MAX_CHUNK_SIZE) ? length : MAX_CHUNK_SIZE;
+  sl_status_t status =
+    sli_si91x_driver_collect_command_response(SI91X_COMMON_CMD, packet_id, SL_SI91X_WAIT_FOR_RESPONSE(32000), &buffer);
+  if (status != SL_STATUS_OK) {
+    if (buffer != NULL)
+      sli_si91x_host_free_buffer(buffer);
+    return status;
+  }
 
-    sli_si91x_read_flash_request_t m4_to_ta_read_request = { 0 };
-    memset(&m4_to_ta_read_request, 0, sizeof(sli_si91x_read_flash_request_t));
-    m4_to_ta_read_request.sub_cmd              = SL_SI91X_READ_FROM_COMMON_FLASH;
-    m4_to_ta_read_request.nwp_address          = read_address;
-    m4_to_ta_read_request.output_buffer_length = (uint16_t)chunkSize;
+  packet          = sl_si91x_host_get_buffer_data(buffer, 0, NULL);
+  uint16_t copied = (packet->length < length) ? packet->length : length;
+  memcpy(output_buffer, packet->data, copied);
+  sli_si91x_host_free_buffer(buffer);
+  if (received_length != NULL) {
+    *received_length = copied;
+  }
+  return status;
+}
 
-    uint32_t send_size = sizeof(sli_si91x_read_flash_request_t);
+static sl_status_t sli_si91x_read_common_flash_uncached(uint32_t read_address, size_t length, uint8_t *output_buffer)
+{
+  sl_status_t status = SL_STATUS_OK;
+  uint8_t packet_id  = 0;
 
-    status = sli_si91x_driver_send_command(SLI_COMMON_REQ_TA_M4_COMMANDS,
-                                           SI91X_COMMON_CMD,
-                                           &m4_to_ta_read_request,
-                                           send_size,
-                                           SL_SI91X_WAIT_FOR_RESPONSE(32000),
-                                           NULL,
-                                           &buffer);
-    if (status != SL_STATUS_OK) {
-      if (buffer != NULL)
-        sli_si91x_host_free_buffer(buffer);
-      return status;
-    }
-    VERIFY_STATUS_AND_RETURN(status);
+  while (length > 0) {
+    size_t chunkSize = (length < MAX_CHUNK_SIZE) ? length : MAX_CHUNK_SIZE;
 
-    packet = sl_si91x_host_get_buffer_data(buffer, 0, NULL);
-    memcpy(output_buffer, packet->data, packet->length);
-    sli_si91x_host_free_buffer(buffer);
+    status = sli_si91x_queue_common_flash_read(read_address, (uint16_t)chunkSize, &packet_id);
+    VERIFY_STATUS_AND_RETURN(status);
+    status = sli_si91x_collect_common_flash_read(packet_id, output_buffer, (uint16_t)chunkSize, NULL);
+    VERIFY_STATUS_AND_RETURN(status);
 
     // Adjust pointers and counters
     read_address += chunkSize;
@@ -1964,6 +2363,313 @@ sl_status_t sl_si91x_command_to_read_common_flash(uint32_t read_address, size_t
   return status;
 }
 
+#if SL_SI91X_COMMON_FLASH_READ_CACHE_LINES > 0
+
+#define SLI_COMMON_FLASH_READ_CACHE_SIZE \
+  (SL_SI91X_COMMON_FLASH_READ_CACHE_LINES * SL_SI91X_COMMON_FLASH_READ_CACHE_LINE_SIZE)
+
+typedef struct {
+  uint32_t address;   // Line aligned flash address held by this line
+  uint32_t last_used; // LRU stamp, larger is more recent
+  bool valid;         // Data holds the flash contents of address
+  uint8_t data[SL_SI91X_COMMON_FLASH_READ_CACHE_LINE_SIZE];
+} sli_si91x_common_flash_cache_line_t;
+
+extern osMutexId_t common_flash_read_cache_mutex;
+static sli_si91x_common_flash_cache_line_t common_flash_cache[SL_SI91X_COMMON_FLASH_READ_CACHE_LINES];
+static sl_si91x_common_flash_read_cache_stats_t common_flash_cache_stats;
+static uint32_t common_flash_cache_clock;
+static uint32_t common_flash_last_read_end;
+// Line read ahead by the last sequential read, collected by the next cache access
+static sli_si91x_common_flash_cache_line_t *common_flash_prefetch_line;
+static uint8_t common_flash_prefetch_packet_id;
+
+static sli_si91x_common_flash_cache_line_t *sli_si91x_find_common_flash_cache_line(uint32_t address)
+{
+  for (uint8_t i = 0; i < SL_SI91X_COMMON_FLASH_READ_CACHE_LINES; i++) {
+    if (common_flash_cache[i].valid && (common_flash_cache[i].address == address)) {
+      return &common_flash_cache[i];
+    }
+  }
+  return NULL;
+}
+
+// Must be called with common_flash_read_cache_mutex held
+static void sli_si91x_complete_common_flash_read_prefetch(void)
+{
+  sli_si91x_common_flash_cache_line_t *line = common_flash_prefetch_line;
+  uint16_t received_length                  = 0;
+
+  if (line == NULL) {
+    return;
+  }
+  common_flash_prefetch_line = NULL;
+  // A short response does not hold the whole line
+  line->valid = (sli_si91x_collect_common_flash_read(common_flash_prefetch_packet_id,
+                                                     line->data,
+                                                     SL_SI91X_COMMON_FLASH_READ_CACHE_LINE_SIZE,
+                                                     &received_length)
+                 == SL_STATUS_OK)
+                && (received_length == SL_SI91X_COMMON_FLASH_READ_CACHE_LINE_SIZE);
+}
+
+static void sli_si91x_collect_common_flash_read_prefetch(void)
+{
+  if (common_flash_read_cache_mutex == NULL) {
+    return;
+  }
+
+  osMutexAcquire(common_flash_read_cache_mutex, osWaitForever);
+  sli_si91x_complete_common_flash_read_prefetch();
+  osMutexRelease(common_flash_read_cache_mutex);
+}
+
+static sli_si91x_common_flash_cache_line_t *sli_si91x_claim_common_flash_cache_line(uint32_t address,
+                                                                                     uint32_t read_stamp)
+{
+  sli_si91x_common_flash_cache_line_t *victim = NULL;
+
+  // Lines used by the current read carry read_stamp or later and are never evicted
+  for (uint8_t i = 0; i < SL_SI91X_COMMON_FLASH_READ_CACHE_LINES; i++) {
+    sli_si91x_common_flash_cache_line_t *line = &common_flash_cache[i];
+    if (line->last_used >= read_stamp) {
+      continue;
+    }
+    if (!line->valid) {
+      victim = line;
+      break;
+    }
+    if ((victim == NULL) || (line->last_used < victim->last_used)) {
+      victim = line;
+    }
+  }
+
+  if (victim != NULL) {
+    victim->address   = address;
+    victim->valid     = false;
+    victim->last_used = ++common_flash_cache_clock;
+  }
+  return victim;
+}
+
+static bool sli_si91x_common_flash_lines_in_region(uint32_t address, size_t length)
+{
+  // Addresses below the region wrap around to large offsets
+  const uint32_t offset      = address - SL_SI91X_COMMON_FLASH_READ_CACHE_REGION_START;
+  const uint32_t region_size = (SL_SI91X_COMMON_FLASH_READ_CACHE_REGION_SIZE != 0)
+                                 ? SL_SI91X_COMMON_FLASH_READ_CACHE_REGION_SIZE
+                                 : (UINT32_MAX - SL_SI91X_COMMON_FLASH_READ_CACHE_REGION_START);
+
+  return (offset < region_size) && (length <= (region_size - offset));
+}
+
+// Reads go through the cache only if all their lines may be held at the same time
+static bool sli_si91x_common_flash_read_is_cacheable(uint32_t read_address, size_t length)
+{
+  const uint32_t offset = read_address % SL_SI91X_COMMON_FLASH_READ_CACHE_LINE_SIZE;
+
+  // Reads that do not fit in the cache would only thrash it
+  if (length > (SLI_COMMON_FLASH_READ_CACHE_SIZE / 2)) {
+    return false;
+  }
+  const size_t lines =
+    (offset + length + SL_SI91X_COMMON_FLASH_READ_CACHE_LINE_SIZE - 1) / SL_SI91X_COMMON_FLASH_READ_CACHE_LINE_SIZE;
+  return (lines <= SL_SI91X_COMMON_FLASH_READ_CACHE_LINES)
+         && sli_si91x_common_flash_lines_in_region(read_address - offset,
+                                                   lines * SL_SI91X_COMMON_FLASH_READ_CACHE_LINE_SIZE);
+}
+
+static void sli_si91x_invalidate_common_flash_read_cache(uint32_t address, uint32_t length)
+{
+  if (common_flash_read_cache_mutex == NULL) {
+    return;
+  }
+
+  osMutexAcquire(common_flash_read_cache_mutex, osWaitForever);
+  // A read ahead queued before the write may hold the old contents
+  sli_si91x_complete_common_flash_read_prefetch();
+  for (uint8_t i = 0; i < SL_SI91X_COMMON_FLASH_READ_CACHE_LINES; i++) {
+    sli_si91x_common_flash_cache_line_t *line = &common_flash_cache[i];
+    if (line->valid && (address < (line->address + SL_SI91X_COMMON_FLASH_READ_CACHE_LINE_SIZE))
+        && (line->address < (address + length))) {
+      line->valid = false;
+      common_flash_cache_stats.invalidations++;
+    }
+  }
+  osMutexRelease(common_flash_read_cache_mutex);
+}
+
+static sl_status_t sli_si91x_read_common_flash_cached(uint32_t read_address, size_t length, uint8_t *output_buffer)
+{
+  sli_si91x_common_flash_cache_line_t *fetch_line[SL_SI91X_COMMON_FLASH_READ_CACHE_LINES];
+  uint8_t packet_id[SL_SI91X_COMMON_FLASH_READ_CACHE_LINES];
+  uint8_t fetch_count = 0;
+  sl_status_t status  = SL_STATUS_OK;
+
+  const uint32_t first_line = read_address - (read_address % SL_SI91X_COMMON_FLASH_READ_CACHE_LINE_SIZE);
+  const uint32_t last_line =
+    (uint32_t)(read_address + length - 1) - ((read_address + length - 1) % SL_SI91X_COMMON_FLASH_READ_CACHE_LINE_SIZE);
+  const uint32_t line_count = ((last_line - first_line) / SL_SI91X_COMMON_FLASH_READ_CACHE_LINE_SIZE) + 1;
+  const bool sequential     = (read_address == common_flash_last_read_end);
+  uint32_t read_stamp       = 0;
+
+  // The line read ahead by the previous read is usually the first line of this one
+  sli_si91x_complete_common_flash_read_prefetch();
+  read_stamp = common_flash_cache_clock + 1;
+
+  // Mark resident lines as used so that fetches of this read do not evict them
+  for (uint32_t address = first_line; address <= last_line; address += SL_SI91X_COMMON_FLASH_READ_CACHE_LINE_SIZE) {
+    sli_si91x_common_flash_cache_line_t *line = sli_si91x_find_common_flash_cache_line(address);
+    if (line != NULL) {
+      line->last_used = ++common_flash_cache_clock;
+      common_flash_cache_stats.hits++;
+    }
+  }
+
+  // Queue reads of all missing lines back to back, plus the next line when reading sequentially
+  for (uint32_t address = first_line; address <= (last_line + SL_SI91X_COMMON_FLASH_READ_CACHE_LINE_SIZE);
+       address += SL_SI91X_COMMON_FLASH_READ_CACHE_LINE_SIZE) {
+    const bool prefetch = (address > last_line);
+    if (prefetch
+        && (!sequential || (line_count >= SL_SI91X_COMMON_FLASH_READ_CACHE_LINES)
+            || !sli_si91x_common_flash_lines_in_region(address, SL_SI91X_COMMON_FLASH_READ_CACHE_LINE_SIZE))) {
+      break;
+    }
+    if (sli_si91x_find_common_flash_cache_line(address) != NULL) {
+      continue;
+    }
+    sli_si91x_common_flash_cache_line_t *line = sli_si91x_claim_common_flash_cache_line(address, read_stamp);
+    if (line == NULL) {
+      break;
+    }
+    if (prefetch) {
+      // Collected by the next cache access, so that this read does not wait for it
+      if (sli_si91x_queue_common_flash_read(address,
+                                            SL_SI91X_COMMON_FLASH_READ_CACHE_LINE_SIZE,
+                                            &common_flash_prefetch_packet_id)
+          == SL_STATUS_OK) {
+        common_flash_prefetch_line = line;
+        common_flash_cache_stats.prefetches++;
+      }
+      break;
+    }
+    status =
+      sli_si91x_queue_common_flash_read(address, SL_SI91X_COMMON_FLASH_READ_CACHE_LINE_SIZE, &packet_id[fetch_count]);
+    if (status != SL_STATUS_OK) {
+      break;
+    }
+    fetch_line[fetch_count++] = line;
+    common_flash_cache_stats.misses++;
+  }
+
+  // Collect every queued read, even after a failure, so no response is left behind
+  for (uint8_t i = 0; i < fetch_count; i++) {
+    uint16_t received_length = 0;
+    sl_status_t line_status  = sli_si91x_collect_common_flash_read(packet_id[i],
+                                                                  fetch_line[i]->data,
+                                                                  SL_SI91X_COMMON_FLASH_READ_CACHE_LINE_SIZE,
+                                                                  &received_length);
+    // A short response does not hold the whole line
+    if ((line_status == SL_STATUS_OK) && (received_length != SL_SI91X_COMMON_FLASH_READ_CACHE_LINE_SIZE)) {
+      line_status = SL_STATUS_FAIL;
+    }
+    fetch_line[i]->valid = (line_status == SL_STATUS_OK);
+    if ((line_status != SL_STATUS_OK) && (status == SL_STATUS_OK)) {
+      status = line_status;
+    }
+  }
+  VERIFY_STATUS_AND_RETURN(status);
+
+  while (length > 0) {
+    const uint32_t offset    = read_address % SL_SI91X_COMMON_FLASH_READ_CACHE_LINE_SIZE;
+    const size_t line_remain = SL_SI91X_COMMON_FLASH_READ_CACHE_LINE_SIZE - offset;
+    const size_t copy_size   = (line_remain < length) ? line_remain : length;
+    const sli_si91x_common_flash_cache_line_t *line = sli_si91x_find_common_flash_cache_line(read_address - offset);
+    if (line == NULL) {
+      return SL_STATUS_FAIL;
+    }
+    memcpy(output_buffer, &line->data[offset], copy_size);
+    read_address += copy_size;
+    output_buffer += copy_size;
+    length -= copy_size;
+  }
+  common_flash_last_read_end = read_address;
+
+  return status;
+}
+
+sl_status_t sl_si91x_get_common_flash_read_cache_stats(sl_si91x_common_flash_read_cache_stats_t *stats)
+{
+  SL_VERIFY_POINTER_OR_RETURN(stats, SL_STATUS_NULL_POINTER);
+  SL_VERIFY_POINTER_OR_RETURN(common_flash_read_cache_mutex, SL_STATUS_NOT_INITIALIZED);
+
+  osMutexAcquire(common_flash_read_cache_mutex, osWaitForever);
+  *stats = common_flash_cache_stats;
+  osMutexRelease(common_flash_read_cache_mutex);
+  return SL_STATUS_OK;
+}
+
+void sl_si91x_flush_common_flash_read_cache(void)
+{
+  if (common_flash_read_cache_mutex == NULL) {
+    return;
+  }
+
+  osMutexAcquire(common_flash_read_cache_mutex, osWaitForever);
+  sli_si91x_complete_common_flash_read_prefetch();
+  memset(common_flash_cache, 0, sizeof(common_flash_cache));
+  memset(&common_flash_cache_stats, 0, sizeof(common_flash_cache_stats));
+  common_flash_cache_clock   = 0;
+  common_flash_last_read_end = 0;
+  osMutexRelease(common_flash_read_cache_mutex);
+}
+
+#else
+
+static void sli_si91x_collect_common_flash_read_prefetch(void)
+{
+}
+
+static void sli_si91x_invalidate_common_flash_read_cache(uint32_t address, uint32_t length)
+{
+  UNUSED_PARAMETER(address);
+  UNUSED_PARAMETER(length);
+}
+
+sl_status_t sl_si91x_get_common_flash_read_cache_stats(sl_si91x_common_flash_read_cache_stats_t *stats)
+{
+  UNUSED_PARAMETER(stats);
+  return SL_STATUS_NOT_SUPPORTED;
+}
+
+void sl_si91x_flush_common_flash_read_cache(void)
+{
+}
+
+#endif // SL_SI91X_COMMON_FLASH_READ_CACHE_LINES > 0
+
+sl_status_t sl_si91x_command_to_read_common_flash(uint32_t read_address, size_t length, uint8_t *output_buffer)
+{
+  // Check if output_buffer pointer is valid
+  SL_VERIFY_POINTER_OR_RETURN(output_buffer, SL_STATUS_INVALID_PARAMETER);
+
+  // Check if length is non-zero
+  if (length == 0) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+#if SL_SI91X_COMMON_FLASH_READ_CACHE_LINES > 0
+  if ((common_flash_read_cache_mutex != NULL) && sli_si91x_common_flash_read_is_cacheable(read_address, length)) {
+    osMutexAcquire(common_flash_read_cache_mutex, osWaitForever);
+    sl_status_t status = sli_si91x_read_common_flash_cached(read_address, length, output_buffer);
+    osMutexRelease(common_flash_read_cache_mutex);
+    return status;
+  }
+#endif
+
+  return sli_si91x_read_common_flash_uncached(read_address, length, output_buffer);
+}
+
 sl_status_t sl_si91x_m4_ta_secure_handshake(uint8_t sub_cmd_type,
                                             uint8_t input_len,
                                             const uint8_t *input_data,
@@ -2374,7 +3080,6 @@ int32_t sli_encapsulate_tx_data_packet(sl_wifi_transceiver_tx_data_control_t *co
                                        uint8_t *pkt_data,
                                        uint32_t mac_hdr_len)
 {
-  uint16_t seq_ctrl = 0;
   uint16_t *frame_ctrl;
   uint32_t qos_ctrl_off = MAC80211_HDR_MIN_LEN;
 
@@ -2420,10 +3125,10 @@ int32_t sli_encapsulate_tx_data_packet(sl_wifi_transceiver_tx_data_control_t *co
   memcpy(&pkt_data[10], control->addr2, 6);
   memcpy(&pkt_data[16], control->addr3, 6);
 
-  if (!IS_PEER_DS_SUPPORT_ENABLED(feature_bit_map)) {
-    seq_ctrl = (uint16_t)(sli_get_seq_ctrl(IS_QOS_PKT(control->ctrl_flags)) << 4);
-    memcpy(&pkt_data[22], &seq_ctrl, 2);
-  }
+  /* Sequence control (2 bytes) stays zero in the template: the MAC layer assigns it with peer DS support, otherwise
+   * it is filled per frame, see sli_si91x_allocate_transceiver_tx_packet() */
+  pkt_data[22] = 0;
+  pkt_data[23] = 0;
 
   /* Add Addr4 optionally based on ctrl_flag (6 bytes) */
   if (IS_4ADDR(control->ctrl_flags)) {
@@ -2438,82 +3143,49 @@ int32_t sli_encapsulate_tx_data_packet(sl_wifi_transceiver_tx_data_control_t *co
   return SL_STATUS_OK;
 }
 
-sl_status_t sl_si91x_driver_send_transceiver_data(sl_wifi_transceiver_tx_data_control_t *control,
-                                                  const uint8_t *payload,
-                                                  uint16_t payload_len,
-                                                  uint32_t wait_time)
+// Builds the host descriptor, extended descriptor and 802.11 MAC header shared by all frames sent with control.
+// The per-frame fields (length, token and, without peer DS support, sequence control) are filled by
+// sli_si91x_allocate_transceiver_tx_packet().
+static sl_status_t sli_si91x_build_transceiver_tx_template(sl_wifi_transceiver_tx_data_control_t *control,
+                                                           sl_wifi_system_packet_t *template,
+                                                           uint8_t *ext_desc_size,
+                                                           uint32_t *mac_hdr_len)
 {
-  sl_wifi_buffer_t *buffer;
-  sl_wifi_system_packet_t *packet;
-  sl_status_t status = SL_STATUS_OK;
-  uint8_t *pkt_offset;
-  uint8_t ext_desc_size;
-  uint8_t *host_desc;
-  uint32_t mac_hdr_len = MAC80211_HDR_MIN_LEN;
+  sl_status_t status;
+  uint8_t *host_desc = template->desc;
 
+  *mac_hdr_len = MAC80211_HDR_MIN_LEN;
   if (IS_QOS_PKT(control->ctrl_flags) && !IS_BCAST_MCAST_MAC(control->addr1[0])) {
-    mac_hdr_len += MAC80211_HDR_QOS_CTRL_LEN;
+    *mac_hdr_len += MAC80211_HDR_QOS_CTRL_LEN;
   }
 
   if (IS_4ADDR(control->ctrl_flags)) {
-    mac_hdr_len += MAC80211_HDR_ADDR4_LEN;
+    *mac_hdr_len += MAC80211_HDR_ADDR4_LEN;
   }
 
   // Initialize ext_desc_size with the base size for transceiver TX data
-  ext_desc_size = TRANSCEIVER_TX_DATA_EXT_DESC_SIZE;
+  *ext_desc_size = TRANSCEIVER_TX_DATA_EXT_DESC_SIZE;
 
   // Check if the control flags indicate an EIA packet
   // Note: Bits 6 and 7 of ctrl_flags, bit 0 of ctrl_flags1, and the channel and tx_power fields are currently not supported.
   if (SLI_IS_EIA_PKT(control->ctrl_flags)) {
     // If it is an EIA packet, add 5 bytes for the following fields: channel, tx_power, is_last_packet, reserved1, reserved2
-    ext_desc_size += SLI_EXT_DESC_SIZE_IF_EIA_PKT;
+    *ext_desc_size += SLI_EXT_DESC_SIZE_IF_EIA_PKT;
   }
 
-  // Allocate a data buffer with space for the data and metadata
-  status = sl_si91x_allocate_data_buffer(&buffer,
-                                         (void **)&packet,
-                                         sizeof(sl_wifi_system_packet_t) + ext_desc_size + mac_hdr_len + payload_len,
-                                         SLI_WIFI_ALLOCATE_COMMAND_BUFFER_WAIT_TIME);
+  status = sli_encapsulate_tx_data_packet(control, template->data + *ext_desc_size, *mac_hdr_len);
   VERIFY_STATUS_AND_RETURN(status);
 
-  // If the packet is not allocated successfully, return an allocation failed error
-  if (packet == NULL) {
-    return SL_STATUS_ALLOCATION_FAILED;
-  }
-
-  pkt_offset = packet->data + ext_desc_size;
-  status     = sli_encapsulate_tx_data_packet(control, pkt_offset, mac_hdr_len);
-  if (status != SL_STATUS_OK) {
-    sli_si91x_host_free_buffer(buffer);
-    return status;
-  }
-
-  memcpy(pkt_offset + mac_hdr_len, payload, payload_len);
-
-#ifdef TX_RX_FRAME_DUMP_BYTE_COUNT
-  print_80211_packet(pkt_offset, mac_hdr_len + payload_len, TX_RX_FRAME_DUMP_BYTE_COUNT);
-#endif
-
-  // Clear the packet descriptor and copy the command data if available
-  memset(packet->desc, 0, sizeof(packet->desc));
-
-  // Fill length in first 2 host_desc bytes
-  packet->length = (ext_desc_size + mac_hdr_len + payload_len) & 0xFFF;
-
-  // Fill packet type
-  host_desc = packet->desc;
-
-  // Clear the extended descriptor if EIA is set
-  if (SLI_IS_EIA_PKT(control->ctrl_flags)) {
-    memset(packet->data, 0, ext_desc_size); //! Clear ext_desc_size bytes starting from packet->data
-  }
+  // Clear the packet descriptor and the extended descriptor
+  memset(template->desc, 0, sizeof(template->desc));
+  memset(template->data, 0, *ext_desc_size);
 
   host_desc[2] = 0x01; //! Frame Type
   if (IS_CFM_TO_HOST_SET(control->ctrl_flags)) {
     host_desc[3] |= CONFIRM_REQUIRED_TO_HOST; //! This bit is used to set CONFIRM_REQUIRED_TO_HOST in firmware.
   }
-  host_desc[4] = ext_desc_size;                     //! xtend_desc size
-  host_desc[5] = (uint8_t)((mac_hdr_len + 3) & ~3); //! Mac_header length
+  host_desc[4] = *ext_desc_size;                     //! xtend_desc size
+  host_desc[5] = (uint8_t)((*mac_hdr_len + 3) & ~3); //! Mac_header length
 
   if (IS_BCAST_MCAST_MAC(control->addr1[0])) {
     host_desc[7] |= BCAST_INDICATION; //! Bcast_indication
@@ -2553,8 +3225,127 @@ sl_status_t sl_si91x_driver_send_transceiver_data(sl_wifi_transceiver_tx_data_co
     }
   }
 
-  // Send command packet to the SI91x socket data queue and await a response
-  return sl_si91x_driver_send_data_packet(buffer, wait_time);
+  return SL_STATUS_OK;
+}
+
+// Allocates a TX data buffer and fills it from the template built by sli_si91x_build_transceiver_tx_template()
+static sl_status_t sli_si91x_allocate_transceiver_tx_packet(const sl_wifi_system_packet_t *template,
+                                                            uint8_t ext_desc_size,
+                                                            uint32_t mac_hdr_len,
+                                                            uint8_t ctrl_flags,
+                                                            uint32_t token,
+                                                            const uint8_t *payload,
+                                                            uint16_t payload_len,
+                                                            sl_wifi_buffer_t **buffer)
+{
+  sl_wifi_system_packet_t *packet;
+  uint8_t *pkt_offset;
+  uint32_t header_length = ext_desc_size + mac_hdr_len;
+  sl_status_t status;
+
+  // Allocate a data buffer with space for the data and metadata
+  status = sl_si91x_allocate_data_buffer(buffer,
+                                         (void **)&packet,
+                                         sizeof(sl_wifi_system_packet_t) + header_length + payload_len,
+                                         SLI_WIFI_ALLOCATE_COMMAND_BUFFER_WAIT_TIME);
+  VERIFY_STATUS_AND_RETURN(status);
+
+  // If the packet is not allocated successfully, return an allocation failed error
+  if (packet == NULL) {
+    return SL_STATUS_ALLOCATION_FAILED;
+  }
+
+  memcpy(packet, template, sizeof(sl_wifi_system_packet_t) + header_length);
+  pkt_offset = packet->data + ext_desc_size;
+
+  // Fill length in first 2 host_desc bytes
+  packet->length = (header_length + payload_len) & 0xFFF;
+  memcpy(packet->data, &token, TRANSCEIVER_TX_DATA_EXT_DESC_SIZE);
+
+  // Sequence control is assigned by the host when the MAC layer doesn't track peers
+  if (!IS_PEER_DS_SUPPORT_ENABLED(feature_bit_map)) {
+    uint16_t seq_ctrl = (uint16_t)(sli_get_seq_ctrl(IS_QOS_PKT(ctrl_flags)) << 4);
+    memcpy(&pkt_offset[22], &seq_ctrl, 2);
+  }
+
+  memcpy(pkt_offset + mac_hdr_len, payload, payload_len);
+
+#ifdef TX_RX_FRAME_DUMP_BYTE_COUNT
+  print_80211_packet(pkt_offset, mac_hdr_len + payload_len, TX_RX_FRAME_DUMP_BYTE_COUNT);
+#endif
+
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_si91x_driver_send_transceiver_data(sl_wifi_transceiver_tx_data_control_t *control,
+                                                  const uint8_t *payload,
+                                                  uint16_t payload_len,
+                                                  uint32_t wait_time)
+{
+  sl_wifi_transceiver_tx_frame_t frame = { .payload = payload, .payload_len = payload_len, .token = control->token };
+
+  return sl_si91x_driver_send_transceiver_data_burst(control, &frame, 1, wait_time);
+}
+
+sl_status_t sl_si91x_driver_send_transceiver_data_burst(sl_wifi_transceiver_tx_data_control_t *control,
+                                                        const sl_wifi_transceiver_tx_frame_t *frames,
+                                                        uint16_t frame_count,
+                                                        uint32_t wait_time)
+{
+  UNUSED_PARAMETER(wait_time);
+  // Descriptor, largest extended descriptor and largest MAC header
+  uint32_t template_storage[(sizeof(sl_wifi_system_packet_t) + TRANSCEIVER_TX_DATA_EXT_DESC_SIZE
+                             + SLI_EXT_DESC_SIZE_IF_EIA_PKT + MAC80211_HDR_MIN_LEN + MAC80211_HDR_ADDR4_LEN
+                             + MAC80211_HDR_QOS_CTRL_LEN + 3)
+                            / 4];
+  sl_wifi_system_packet_t *template = (sl_wifi_system_packet_t *)template_storage;
+  sli_si91x_buffer_queue_t burst    = { 0 };
+  sl_wifi_buffer_t *buffer          = NULL;
+  uint8_t ext_desc_size             = 0;
+  uint32_t mac_hdr_len              = 0;
+  sl_status_t status;
+
+  SL_VERIFY_POINTER_OR_RETURN(control, SL_STATUS_NULL_POINTER);
+  SL_VERIFY_POINTER_OR_RETURN(frames, SL_STATUS_NULL_POINTER);
+
+  status = sli_si91x_build_transceiver_tx_template(control, template, &ext_desc_size, &mac_hdr_len);
+  VERIFY_STATUS_AND_RETURN(status);
+
+  // Fill every frame before queuing so that the burst is handed to the bus thread in one operation
+  for (uint16_t i = 0; i < frame_count; i++) {
+    status = sli_si91x_allocate_transceiver_tx_packet(template,
+                                                      ext_desc_size,
+                                                      mac_hdr_len,
+                                                      control->ctrl_flags,
+                                                      frames[i].token,
+                                                      frames[i].payload,
+                                                      frames[i].payload_len,
+                                                      &buffer);
+    if (status != SL_STATUS_OK) {
+      while (sli_si91x_pop_from_buffer_queue(&burst, &buffer) == SL_STATUS_OK) {
+        sli_si91x_host_free_buffer(buffer);
+      }
+      return status;
+    }
+
+    buffer->node.node = NULL;
+    sli_si91x_append_to_buffer_queue(&burst, buffer);
+  }
+
+  if (burst.head == NULL) {
+    return SL_STATUS_OK;
+  }
+
+  // Send the data packets to the SI91x data queue
+  CORE_irqState_t state = CORE_EnterAtomic();
+  while (sli_si91x_pop_from_buffer_queue(&burst, &buffer) == SL_STATUS_OK) {
+    sli_si91x_append_to_buffer_queue(&sli_tx_data_queue, buffer);
+  }
+  tx_generic_socket_data_queues_status |= SL_SI91X_GENERIC_DATA_TX_PENDING_EVENT;
+  sli_si91x_set_event(SL_SI91X_GENERIC_DATA_TX_PENDING_EVENT);
+  CORE_ExitAtomic(state);
+
+  return SL_STATUS_OK;
 }
 
 void sli_si91x_append_to_buffer_queue(sli_si91x_buffer_queue_t *queue, sl_wifi_buffer_t *buffer)
@@ -0,0 +1,84 @@
+/***************************************************************************/ /**
+ * @file  sl_deferred_log.h
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+
+/** @brief
+ *    Deferred binary logging.
+ *
+ *  @details
+ *    When SL_WLAN_LOGGER_DEFERRED is defined together with PRINT_DEBUG_LOG, SL_DEBUG_LOG and SL_PRINTF do not
+ *    format anything in the caller's context. Each call stores the address of its format string, a timestamp
+ *    and its arguments as raw 32-bit words in a RAM ring buffer. A low priority thread started by
+ *    sl_deferred_log_init() drains the ring buffer; it sleeps until a record is logged. It either formats the records on target or streams them
+ *    in binary form, to be decoded on the host with utilities/advanced_logging/deferred_logging/deferred_log_decoder.py.
+ *
+ *    Arguments must be integers, characters or pointers. Floating point and 64-bit arguments are not supported.
+ *    A %s argument is recorded as a pointer. The host decoder can resolve it only if it points into the firmware image.
+ */
+
+/// Size of the log ring buffer in bytes. Must be a power of two.
+#ifndef SL_DEFERRED_LOG_BUFFER_SIZE
+#define SL_DEFERRED_LOG_BUFFER_SIZE 2048
+#endif
+
+/// Maximum number of arguments recorded per log call. Extra arguments are dropped.
+#define SL_DEFERRED_LOG_MAX_ARGUMENTS 12
+
+/// Marker in the top byte of the first word of every record, used by the decoder to resynchronize
+#define SL_DEFERRED_LOG_RECORD_MARKER 0xD1
+
+/// Record the format string and arguments of a log call without formatting them
+void sl_deferred_log_record(const char *format, uint32_t argument_count, ...);
+
+/// Start the thread that drains the deferred log ring buffer. Called at service init by the
+/// wiseconnect3_deferred_logger component. Records logged before this call are kept.
+void sl_deferred_log_init(void);
+
+/// Number of records dropped because the ring buffer was full
+uint32_t sl_deferred_log_get_dropped_count(void);
+
+/// Output hook for binary mode (SL_DEFERRED_LOG_OUTPUT_BINARY). Weak; writes to stdout by default.
+void sl_deferred_log_output(const uint8_t *data, uint32_t length);
+
+// Counts the variadic arguments of a log call, up to SL_DEFERRED_LOG_MAX_ARGUMENTS
+#define SLI_DEFERRED_LOG_ARGUMENT_COUNT(...) \
+  SLI_DEFERRED_LOG_ARGUMENT_COUNT_(0, ##__VA_ARGS__, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define SLI_DEFERRED_LOG_ARGUMENT_COUNT_(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, count, ...) count
+
+/// Record a log call. The format must be a string literal.
+#define SL_DEFERRED_LOG(format, ...) \
+  sl_deferred_log_record(format, SLI_DEFERRED_LOG_ARGUMENT_COUNT(__VA_ARGS__), ##__VA_ARGS__)
+
+/// Deferred backend for the legacy SL_PRINTF(debug_id, component, level, format, ...) calls. The debug ID is kept as a string.
+#ifndef SL_PRINTF
+#define SL_PRINTF(debug_id, component, level, ...) SL_DEFERRED_LOG(#debug_id ": " __VA_ARGS__)
+#endif
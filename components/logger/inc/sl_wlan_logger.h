@@ -32,7 +32,13 @@
 #include <stdio.h>
 #include "cmsis_compiler.h"
 
-#ifdef PRINT_DEBUG_LOG
+#if defined(PRINT_DEBUG_LOG) && defined(SL_WLAN_LOGGER_DEFERRED)
+#include "sl_deferred_log.h"
+#define SL_DEBUG_LOG(format, ...)                                                                 \
+  do {                                                                                            \
+    SL_DEFERRED_LOG("%s:%s:%d:" format "\r\n", __FILE_NAME__, __func__, __LINE__, ##__VA_ARGS__); \
+  } while (0)
+#elif defined(PRINT_DEBUG_LOG)
 extern void sl_debug_log(const char *format, ...);
 #define SL_DEBUG_LOG(format, ...)                                                              \
   do {                                                                                         \
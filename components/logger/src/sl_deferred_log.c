@@ -0,0 +1,216 @@
+/***************************************************************************/ /**
+ * @file  sl_deferred_log.c
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include "sl_deferred_log.h"
+#include "cmsis_os2.h"
+#include "cmsis_compiler.h"
+#include "sl_core.h"
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifndef SL_DEFERRED_LOG_THREAD_PRIORITY
+#define SL_DEFERRED_LOG_THREAD_PRIORITY osPriorityLow
+#endif
+
+#ifndef SL_DEFERRED_LOG_THREAD_STACK_SIZE
+#define SL_DEFERRED_LOG_THREAD_STACK_SIZE 1024
+#endif
+
+// 0: format records on target with printf, 1: stream raw records through sl_deferred_log_output()
+#ifndef SL_DEFERRED_LOG_OUTPUT_BINARY
+#define SL_DEFERRED_LOG_OUTPUT_BINARY 0
+#endif
+
+#define SLI_DEFERRED_LOG_RING_WORDS  (SL_DEFERRED_LOG_BUFFER_SIZE / sizeof(uint32_t))
+#define SLI_DEFERRED_LOG_HEADER_WORDS 3 // Marker/count/sequence, format address, timestamp
+#define SLI_DEFERRED_LOG_MAX_RECORD_WORDS (SLI_DEFERRED_LOG_HEADER_WORDS + SL_DEFERRED_LOG_MAX_ARGUMENTS)
+#define SLI_DEFERRED_LOG_PENDING_FLAG     (1UL << 0)
+
+#if (SL_DEFERRED_LOG_BUFFER_SIZE & (SL_DEFERRED_LOG_BUFFER_SIZE - 1)) != 0
+#error "SL_DEFERRED_LOG_BUFFER_SIZE must be a power of two"
+#endif
+
+// Record layout, in 32-bit words:
+//   [0] marker (8 bits) | argument count (8 bits) | sequence number (16 bits)
+//   [1] address of the format string
+//   [2] kernel tick count
+//   [3...] arguments
+// A record with a NULL format reports lost records: its only argument is the number dropped.
+static uint32_t log_ring[SLI_DEFERRED_LOG_RING_WORDS];
+static volatile uint32_t log_write_index = 0; // Free-running word index, advanced by producers
+static volatile uint32_t log_read_index  = 0; // Free-running word index, advanced by the drain thread
+static volatile uint32_t log_dropped     = 0;
+static uint16_t log_sequence             = 0;
+static osThreadId_t log_thread           = NULL;
+
+void sl_deferred_log_record(const char *format, uint32_t argument_count, ...)
+{
+  uint32_t record[SLI_DEFERRED_LOG_MAX_RECORD_WORDS];
+  va_list args;
+
+  if (argument_count > SL_DEFERRED_LOG_MAX_ARGUMENTS) {
+    argument_count = SL_DEFERRED_LOG_MAX_ARGUMENTS;
+  }
+
+  // Arguments are stored as raw words; no formatting happens here
+  va_start(args, argument_count);
+  for (uint32_t i = 0; i < argument_count; i++) {
+    record[SLI_DEFERRED_LOG_HEADER_WORDS + i] = va_arg(args, uint32_t);
+  }
+  va_end(args);
+
+  uint32_t record_words = SLI_DEFERRED_LOG_HEADER_WORDS + argument_count;
+  record[1]             = (uint32_t)(uintptr_t)format;
+  record[2]             = osKernelGetTickCount();
+
+  // The critical section only covers claiming space and copying a few words, so it is safe from ISRs
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_ATOMIC();
+  if ((SLI_DEFERRED_LOG_RING_WORDS - (log_write_index - log_read_index)) < record_words) {
+    log_dropped++;
+    CORE_EXIT_ATOMIC();
+    return;
+  }
+  record[0] = ((uint32_t)SL_DEFERRED_LOG_RECORD_MARKER << 24) | (argument_count << 16) | log_sequence++;
+  for (uint32_t i = 0; i < record_words; i++) {
+    log_ring[(log_write_index + i) & (SLI_DEFERRED_LOG_RING_WORDS - 1)] = record[i];
+  }
+  // The drain thread only sleeps on an empty ring, so only the first record after that needs to wake it
+  bool wake = (log_write_index == log_read_index);
+  log_write_index += record_words;
+  CORE_EXIT_ATOMIC();
+
+  if (wake && (log_thread != NULL)) {
+    osThreadFlagsSet(log_thread, SLI_DEFERRED_LOG_PENDING_FLAG);
+  }
+}
+
+uint32_t sl_deferred_log_get_dropped_count(void)
+{
+  return log_dropped;
+}
+
+__WEAK void sl_deferred_log_output(const uint8_t *data, uint32_t length)
+{
+  fwrite(data, 1, length, stdout);
+}
+
+static void sli_deferred_log_emit(const uint32_t *record, uint32_t record_words)
+{
+#if SL_DEFERRED_LOG_OUTPUT_BINARY
+  // Words are emitted in target byte order (little endian)
+  sl_deferred_log_output((const uint8_t *)record, record_words * sizeof(uint32_t));
+#else
+  const uint32_t *a  = &record[SLI_DEFERRED_LOG_HEADER_WORDS];
+  const char *format = (const char *)(uintptr_t)record[1];
+  uint32_t argument_count = record_words - SLI_DEFERRED_LOG_HEADER_WORDS;
+  uint32_t padded[SL_DEFERRED_LOG_MAX_ARGUMENTS] = { 0 };
+
+  if (format == NULL) {
+    printf("\r\n[%lu] %lu log records dropped\r\n", (unsigned long)record[2], (unsigned long)a[0]);
+    return;
+  }
+  memcpy(padded, a, argument_count * sizeof(uint32_t));
+  // Unused trailing arguments are ignored by printf
+  printf(format,
+         padded[0],
+         padded[1],
+         padded[2],
+         padded[3],
+         padded[4],
+         padded[5],
+         padded[6],
+         padded[7],
+         padded[8],
+         padded[9],
+         padded[10],
+         padded[11]);
+#endif
+}
+
+static void sli_deferred_log_thread(void *argument)
+{
+  (void)(argument);
+  uint32_t record[SLI_DEFERRED_LOG_MAX_RECORD_WORDS];
+  uint32_t reported_dropped = 0;
+
+  while (1) {
+    // Report lost records in stream order, before the records that follow the loss
+    uint32_t dropped = log_dropped;
+    if (dropped != reported_dropped) {
+      record[0] = ((uint32_t)SL_DEFERRED_LOG_RECORD_MARKER << 24) | (1UL << 16);
+      record[1] = 0;
+      record[2] = osKernelGetTickCount();
+      record[3] = dropped - reported_dropped;
+      sli_deferred_log_emit(record, SLI_DEFERRED_LOG_HEADER_WORDS + 1);
+      reported_dropped = dropped;
+    }
+
+    if (log_read_index == log_write_index) {
+      fflush(stdout);
+      osThreadFlagsWait(SLI_DEFERRED_LOG_PENDING_FLAG, osFlagsWaitAny, osWaitForever);
+      continue;
+    }
+
+    // Single consumer: copy the record out, then release its space
+    uint32_t read_index   = log_read_index;
+    record[0]             = log_ring[read_index & (SLI_DEFERRED_LOG_RING_WORDS - 1)];
+    uint32_t record_words = SLI_DEFERRED_LOG_HEADER_WORDS + ((record[0] >> 16) & 0xFF);
+    for (uint32_t i = 1; i < record_words; i++) {
+      record[i] = log_ring[(read_index + i) & (SLI_DEFERRED_LOG_RING_WORDS - 1)];
+    }
+    CORE_DECLARE_IRQ_STATE;
+    CORE_ENTER_ATOMIC();
+    log_read_index = read_index + record_words;
+    CORE_EXIT_ATOMIC();
+
+    sli_deferred_log_emit(record, record_words);
+  }
+}
+
+void sl_deferred_log_init(void)
+{
+  if (log_thread != NULL) {
+    return;
+  }
+
+  const osThreadAttr_t attr = {
+    .name       = "sl_deferred_log",
+    .priority   = SL_DEFERRED_LOG_THREAD_PRIORITY,
+    .stack_mem  = 0,
+    .stack_size = SL_DEFERRED_LOG_THREAD_STACK_SIZE,
+    .cb_mem     = 0,
+    .cb_size    = 0,
+    .attr_bits  = 0u,
+    .tz_module  = 0u,
+  };
+  log_thread = osThreadNew(&sli_deferred_log_thread, NULL, &attr);
+}
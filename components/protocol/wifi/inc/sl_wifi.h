@@ -1179,6 +1179,37 @@ sl_status_t sl_wifi_set_advanced_client_configuration(sl_wifi_interface_t interf
  ******************************************************************************/
 sl_status_t sl_wifi_send_raw_data_frame(sl_wifi_interface_t interface, const void *data, uint16_t data_length);
 
+/***************************************************************************/ /**
+ * @brief
+ *   Submit a raw data frame without waiting and get notified when it has been handed to the NWP.
+ * @pre Pre-conditions:
+ * -
+ *   @ref sl_wifi_init should be called before this API.
+ * -
+ *   This API should be invoked only after the module has established a connection in STA or AP mode.
+ * @param[in] interface
+ *   Wi-Fi interface as identified by @ref sl_wifi_interface_t
+ * @param[in] data
+ *   Data buffer. It is copied before the function returns.
+ * @param[in] data_length
+ *   length of the data.
+ * @param[in] callback
+ *   Completion callback of type @ref sl_wifi_raw_data_frame_callback_t. Can be NULL.
+ * @param[in] context
+ *   Argument passed to the callback.
+ * @return
+ *   sl_status_t. See https://docs.silabs.com/gecko-platform/latest/platform-common/status for details. Possible Error Codes:
+ *   - `0x09` - SL_STATUS_WOULD_BLOCK: SL_WIFI_RAW_DATA_FRAME_WINDOW frames are already outstanding. Retry after a callback.
+ * @note
+ *   Up to SL_WIFI_RAW_DATA_FRAME_WINDOW frames can be outstanding. Frames share the data queue with
+ *   @ref sl_wifi_send_raw_data_frame and are sent in submission order.
+ ******************************************************************************/
+sl_status_t sl_wifi_send_raw_data_frame_async(sl_wifi_interface_t interface,
+                                              const void *data,
+                                              uint16_t data_length,
+                                              sl_wifi_raw_data_frame_callback_t callback,
+                                              void *context);
+
 /***************************************************************************/ /**
  * @brief
  *   Configure TWT parameters. Enables a TWT session. This is blocking API.
@@ -2050,4 +2081,39 @@ sl_status_t sl_wifi_send_transceiver_data(sl_wifi_interface_t interface,
                                           sl_wifi_transceiver_tx_data_control_t *control,
                                           const uint8_t *payload,
                                           uint16_t payload_len);
+
+/***************************************************************************/ /**
+ * @brief Host shall call this API to send several data frames to the same peer with a single queue operation.
+ *
+ * @pre Pre-conditions:
+ * - @ref sl_wifi_transceiver_set_channel shall be called before this API.
+ *
+ * @param[in] interface
+ *   Wi-Fi interface as identified by @ref sl_wifi_interface_t
+ * @param[in] control
+ *   Metadata shared by all frames of the burst. See @ref sl_wifi_transceiver_tx_data_control_t. control->token is ignored; each frame carries its own token.
+ * @param[in] frames
+ *   Array of frames to send. See @ref sl_wifi_transceiver_tx_frame_t.
+ * @param[in] frame_count
+ *   Number of frames in the array. Valid range is 1 - TRANSCEIVER_TX_BURST_MAX_FRAMES.
+ *
+ * @return
+ *   sl_status_t. See [Status Codes](../../wiseconnect-api-reference-guide-err-codes/pages/sl-additional-status-errors). Possible Error Codes:
+ *   - `0x11` - SL_STATUS_NOT_INITIALIZED
+ *   - `0x0B44` - SL_STATUS_WIFI_INTERFACE_NOT_UP
+ *   - `0x0B63` - SL_STATUS_TRANSCEIVER_INVALID_MAC_ADDRESS
+ *   - `0x0B64` - SL_STATUS_TRANSCEIVER_INVALID_QOS_PRIORITY
+ *   - `0x0B66` - SL_STATUS_TRANSCEIVER_INVALID_DATA_RATE
+ *   - `0x21` - SL_STATUS_INVALID_PARAMETER
+ *   - `0x22` - SL_STATUS_NULL_POINTER
+ *
+ * @note This API is only supported in Wi-Fi Transceiver opermode (7).
+ * @note The 802.11 MAC header and host descriptor are built once per burst, and all frames are handed to the bus thread together. If a TX buffer can't be allocated, no frame of the burst is sent.
+ * @note Once sl_wifi_send_transceiver_data_burst() returns, the calling API is responsible for freeing control, frames and payloads.
+ * @note This is not a blocking API. Callback SL_WIFI_TRANSCEIVER_TX_DATA_STATUS_CB can be registered to get the status report for each frame token from firmware.
+ ******************************************************************************/
+sl_status_t sl_wifi_send_transceiver_data_burst(sl_wifi_interface_t interface,
+                                                sl_wifi_transceiver_tx_data_control_t *control,
+                                                const sl_wifi_transceiver_tx_frame_t *frames,
+                                                uint16_t frame_count);
 /** @} */
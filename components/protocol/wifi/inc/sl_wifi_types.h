@@ -80,12 +80,17 @@
 #define TRANSCEIVER_MCAST_FILTER_EN         BIT(0)
 #define TRANSCEIVER_MCAST_FILTER_ADDR_LIMIT 2
 #define TRANSCEIVER_TX_DATA_EXT_DESC_SIZE   4
+#define TRANSCEIVER_TX_BURST_MAX_FRAMES     16
 #define SL_STATUS_ACK_ERR                   0x1
 #define SL_STATUS_CS_BUSY                   0x2
 #define SL_STATUS_UNKNOWN_PEER              0x3
 #define TRANSCEIVER_RX_PKT_TA_MATCH_BIT     BIT(20)
 #define SL_WIFI_SSID_LEN                    34
 
+#ifndef SL_WIFI_RAW_DATA_FRAME_WINDOW
+#define SL_WIFI_RAW_DATA_FRAME_WINDOW 4 ///< Maximum raw data frames submitted with sl_wifi_send_raw_data_frame_async() and not yet sent
+#endif
+
 /** @addtogroup SL_WIFI_CONSTANTS
   * @{ */
 #define SL_WIFI_TRANSCEIVER_CHANNEL_NO               14 ///< Wi-Fi transceiver default channel
@@ -1004,6 +1009,29 @@ typedef struct {
   uint8_t tx_power; ///< Transmission power is currently not supported.
 } sl_wifi_transceiver_tx_data_control_t;
 
+/**
+ * @brief Frame descriptor used with @ref sl_wifi_send_transceiver_data_burst.
+ *
+ * All frames of a burst share the MAC header and transmit settings from one @ref sl_wifi_transceiver_tx_data_control_t.
+ */
+typedef struct {
+  const uint8_t *payload; ///< Pointer to payload (encrypted by host) to be sent to LMAC.
+  uint16_t payload_len;   ///< Length of the payload. Valid range is 1 - 2020 bytes.
+  uint32_t
+    token; ///< Identifier reported in the TX data status report for this frame. Replaces control->token for this frame.
+} sl_wifi_transceiver_tx_frame_t;
+
+/**
+ * @brief Completion callback for @ref sl_wifi_send_raw_data_frame_async.
+ *
+ * @param[in] status
+ *   SL_STATUS_OK once the frame is written to the NWP, SL_STATUS_ABORT if the frame was flushed before it was sent, or the bus write error.
+ * @param[in] context
+ *   Context passed to @ref sl_wifi_send_raw_data_frame_async.
+ * @note The callback runs in the bus thread context and must not block.
+ */
+typedef void (*sl_wifi_raw_data_frame_callback_t)(sl_status_t status, void *context);
+
 /**
  * @struct sl_wifi_transceiver_cw_config_t
  * @brief Wi-Fi transceiver contention window configuration structure.
@@ -2301,6 +2301,28 @@ sl_status_t sl_wifi_send_raw_data_frame(sl_wifi_interface_t interface, const voi
   return sl_si91x_driver_raw_send_command(SLI_SEND_RAW_DATA, data, data_length, SLI_SEND_RAW_DATA_RESPONSE_WAIT_TIME);
 }
 
+sl_status_t sl_wifi_send_raw_data_frame_async(sl_wifi_interface_t interface,
+                                              const void *data,
+                                              uint16_t data_length,
+                                              sl_wifi_raw_data_frame_callback_t callback,
+                                              void *context)
+{
+  if (!device_initialized) {
+    return SL_STATUS_NOT_INITIALIZED;
+  }
+
+  if (!sl_wifi_is_interface_up(interface)) {
+    return SL_STATUS_WIFI_INTERFACE_NOT_UP;
+  }
+
+  SL_VERIFY_POINTER_OR_RETURN(data, SL_STATUS_NULL_POINTER);
+
+  if (data_length == 0) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  return sl_si91x_driver_raw_send_command_async(SLI_SEND_RAW_DATA, data, data_length, callback, context);
+}
+
 sl_status_t sl_wifi_enable_target_wake_time(const sl_wifi_twt_request_t *twt_req)
 {
   if (!twt_req->twt_enable) {
@@ -2972,6 +2994,40 @@ sl_status_t sl_wifi_send_transceiver_data(sl_wifi_interface_t interface,
   return status;
 }
 
+sl_status_t sl_wifi_send_transceiver_data_burst(sl_wifi_interface_t interface,
+                                                sl_wifi_transceiver_tx_data_control_t *control,
+                                                const sl_wifi_transceiver_tx_frame_t *frames,
+                                                uint16_t frame_count)
+{
+  if (!device_initialized) {
+    return SL_STATUS_NOT_INITIALIZED;
+  }
+
+  if (!sl_wifi_is_interface_up(interface)) {
+    return SL_STATUS_WIFI_INTERFACE_NOT_UP;
+  }
+
+  if ((!frame_count) || (frame_count > TRANSCEIVER_TX_BURST_MAX_FRAMES)) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  SL_VERIFY_POINTER_OR_RETURN(control, SL_STATUS_NULL_POINTER);
+  SL_VERIFY_POINTER_OR_RETURN(frames, SL_STATUS_NULL_POINTER);
+
+  for (uint16_t i = 0; i < frame_count; i++) {
+    if ((!frames[i].payload_len) || (frames[i].payload_len > MAX_PAYLOAD_LEN)) {
+      return SL_STATUS_INVALID_PARAMETER;
+    }
+    SL_VERIFY_POINTER_OR_RETURN(frames[i].payload, SL_STATUS_NULL_POINTER);
+  }
+
+  if ((IS_FIXED_DATA_RATE(control->ctrl_flags)) && (validate_datarate(control->rate))) {
+    return SL_STATUS_TRANSCEIVER_INVALID_DATA_RATE;
+  }
+
+  return sl_si91x_driver_send_transceiver_data_burst(control, frames, frame_count, SL_SI91X_WAIT_FOR(1000));
+}
+
 sl_status_t sl_wifi_update_transceiver_peer_list(sl_wifi_interface_t interface, sl_wifi_transceiver_peer_update_t peer)
 {
   sl_status_t status = SL_STATUS_OK;
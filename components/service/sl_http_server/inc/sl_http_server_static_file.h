@@ -0,0 +1,191 @@
+/***************************************************************************/ /**
+ * @file  sl_http_server_static_file.h
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+#ifndef SL_HTTP_SERVER_STATIC_FILE_H
+#define SL_HTTP_SERVER_STATIC_FILE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "lfs.h"
+#include "sl_status.h"
+#include "sl_http_server_types.h"
+
+/******************************************************
+ *                    Constants
+ ******************************************************/
+
+/**
+ *  @addtogroup SERVICE_HTTP_SERVER_CONSTANTS
+ *  @{
+ */
+
+/**
+ * @def SL_HTTP_SERVER_STATIC_FILE_CACHE_ENTRIES
+ * @brief
+ *   Number of recently served files whose response headers are kept in memory.
+ *
+ * @details
+ *   A cached file is only checked against its metadata (size and @ref SL_HTTP_SERVER_STATIC_FILE_TIME_ATTRIBUTE): conditional requests that match are answered with 304 Not Modified without reading the file, and other requests only open the file to stream its content. The least recently used entry is replaced on a miss.
+ */
+#ifndef SL_HTTP_SERVER_STATIC_FILE_CACHE_ENTRIES
+#define SL_HTTP_SERVER_STATIC_FILE_CACHE_ENTRIES 4
+#endif
+
+/**
+ * @def SL_HTTP_SERVER_STATIC_FILE_MAX_PATH_LENGTH
+ * @brief
+ *   Maximum length of a file path, including the root directory, an appended "index.html" or ".gz", and the null terminator.
+ *
+ * @details
+ *   Requests for longer paths are answered with 404 Not Found.
+ */
+#ifndef SL_HTTP_SERVER_STATIC_FILE_MAX_PATH_LENGTH
+#define SL_HTTP_SERVER_STATIC_FILE_MAX_PATH_LENGTH 64
+#endif
+
+/**
+ * @def SL_HTTP_SERVER_STATIC_FILE_CHUNK_SIZE
+ * @brief
+ *   Size, in bytes, of the buffer used to stream files.
+ *
+ * @details
+ *   Files are sent in chunks of the socket MSS, limited to this size. The response headers share the first chunk, so it should be at least the MSS of the connection for full-sized segments.
+ */
+#ifndef SL_HTTP_SERVER_STATIC_FILE_CHUNK_SIZE
+#define SL_HTTP_SERVER_STATIC_FILE_CHUNK_SIZE 1460
+#endif
+
+/**
+ * @def SL_HTTP_SERVER_STATIC_FILE_TIME_ATTRIBUTE
+ * @brief
+ *   littlefs custom attribute type holding the modification time of a file.
+ *
+ * @details
+ *   The attribute is a uint32_t holding seconds since 1970-01-01 UTC, written with lfs_setattr() by the application when it stores the file. When present, it is sent as Last-Modified and used in the ETag. Without it, the ETag is a hash of the file content, computed when the file is loaded into the cache, and a rewrite that keeps the file size is only detected after @ref sl_http_server_static_file_invalidate_cache.
+ */
+#ifndef SL_HTTP_SERVER_STATIC_FILE_TIME_ATTRIBUTE
+#define SL_HTTP_SERVER_STATIC_FILE_TIME_ATTRIBUTE 0x74
+#endif
+
+/** @} */
+
+/******************************************************
+ *                    Structures
+ ******************************************************/
+
+/**
+ * @addtogroup SERVICE_HTTP_SERVER_TYPES
+ * @{
+ */
+
+/**
+ * @brief
+ *   Static file handler configuration.
+ *
+ * @details
+ *   This structure holds the file system and directory the static file handler serves files from.
+ */
+typedef struct {
+  lfs_t *file_system; ///< Mounted littlefs instance the files are read from. Must not be NULL.
+  const char *
+    root_directory; ///< Directory mapped to the URI "/", without a trailing slash (for example, "/www"). NULL or "" serves from the file system root.
+} sl_http_server_static_file_config_t;
+
+/** @} */
+
+/******************************************************
+ *               Function Declarations
+ ******************************************************/
+
+/**
+ * @addtogroup SERVICE_HTTP_SERVER_FUNCTIONS
+ * @{
+ */
+
+/***************************************************************************/ /**
+ * @brief
+ *   Configures the static file handler.
+ *
+ * @details
+ *   This function sets the file system and directory used by @ref sl_http_server_static_file_handler and clears the header cache.
+ *
+ * @param[in] config
+ *   Pointer to the configuration of type @ref sl_http_server_static_file_config_t. The structure is copied, but the file system and the root directory string must stay valid while the handler is in use. Must not be NULL.
+ *
+ * @return
+ *   sl_status_t - Status of the operation. For more details, see https://docs.silabs.com/gecko-platform/latest/platform-common/status.
+ *   - SL_STATUS_OK: Operation successful.
+ *   - SL_STATUS_INVALID_PARAMETER: One or more input parameters are NULL or invalid.
+ */
+sl_status_t sl_http_server_static_file_init(const sl_http_server_static_file_config_t *config);
+
+/***************************************************************************/ /**
+ * @brief
+ *   Request handler serving files from littlefs.
+ *
+ * @details
+ *   This function can be used as the `default_handler` of @ref sl_http_server_config_t, or as the handler of individual URIs.
+ *   The URI path is mapped below the configured root directory, and a path ending with "/" serves its "index.html".
+ *   If the client accepts gzip and a precompressed "<file>.gz" exists, it is sent with "Content-Encoding: gzip" instead of the file.
+ *   Responses carry an ETag (and Last-Modified when the file has a @ref SL_HTTP_SERVER_STATIC_FILE_TIME_ATTRIBUTE), and requests
+ *   with a matching If-None-Match or If-Modified-Since header are answered with 304 Not Modified.
+ *   File content is streamed in socket MSS sized chunks, without buffering the whole file.
+ *   Only GET and HEAD requests are served; other methods are answered with 405 Method Not Allowed.
+ *
+ * @param[in] handle
+ *   Pointer to the HTTP server handle of type @ref sl_http_server_t.
+ *
+ * @param[in] request
+ *   Pointer to the HTTP request of type @ref sl_http_server_request_t.
+ *
+ * @return
+ *   sl_status_t - Status of the operation. For more details, see https://docs.silabs.com/gecko-platform/latest/platform-common/status.
+ *   - SL_STATUS_OK: A response was sent.
+ *   - SL_STATUS_INVALID_PARAMETER: One or more input parameters are NULL or invalid.
+ *   - SL_STATUS_FAIL: Failed to read the file or send the response. The connection is closed by the server.
+ *
+ * @note
+ *   This function reads the request headers using @ref sl_http_server_get_request_headers, so they cannot be read again afterwards.
+ */
+sl_status_t sl_http_server_static_file_handler(sl_http_server_t *handle, sl_http_server_request_t *request);
+
+/***************************************************************************/ /**
+ * @brief
+ *   Clears the static file header cache.
+ *
+ * @details
+ *   Cached entries are checked against the size and the @ref SL_HTTP_SERVER_STATIC_FILE_TIME_ATTRIBUTE of their file
+ *   when they are served, without reading its content. This function must be called after a file without time
+ *   attribute is rewritten with the same size, and after a precompressed "<file>.gz" variant is added or removed,
+ *   since cached entries keep the validator and the variant they were loaded with.
+ */
+void sl_http_server_static_file_invalidate_cache(void);
+
+/** @} */
+
+#endif //SL_HTTP_SERVER_STATIC_FILE_H
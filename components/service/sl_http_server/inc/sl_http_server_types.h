@@ -183,6 +183,42 @@
  */
 #define MAX_HEADER_BUFFER_LENGTH SL_HTTP_SERVER_MAX_HEADER_BUFFER_LENGTH
 
+/**
+ * @def SL_HTTP_SERVER_MAX_CONNECTIONS
+ * @brief
+ *   Maximum number of persistent client connections kept open by the server.
+ * 
+ * @details
+ *   Persistent connections are multiplexed on the HTTP server thread using select(), and each one holds a receive buffer of @ref SL_HTTP_SERVER_MAX_HEADER_BUFFER_LENGTH bytes for a partially received request. This requires select to be enabled through SL_SI91X_EXT_TCP_IP_TOTAL_SELECTS and enough TCP sockets configured for the server socket and all clients. If select is unavailable, every connection is closed after its response.
+ */
+#ifndef SL_HTTP_SERVER_MAX_CONNECTIONS
+#define SL_HTTP_SERVER_MAX_CONNECTIONS 4
+#endif
+
+/**
+ * @def SL_HTTP_SERVER_MAX_KEEP_ALIVE_REQUESTS
+ * @brief
+ *   Maximum number of requests served on a single persistent connection.
+ * 
+ * @details
+ *   After this many requests, the server answers with "Connection: close" and closes the connection.
+ */
+#ifndef SL_HTTP_SERVER_MAX_KEEP_ALIVE_REQUESTS
+#define SL_HTTP_SERVER_MAX_KEEP_ALIVE_REQUESTS 100
+#endif
+
+/**
+ * @def SL_HTTP_SERVER_SELECT_TIMEOUT_MS
+ * @brief
+ *   Interval, in milliseconds, at which the server thread polls open persistent connections.
+ * 
+ * @details
+ *   This bounds how long a new client or a stop request waits while persistent connections are open.
+ */
+#ifndef SL_HTTP_SERVER_SELECT_TIMEOUT_MS
+#define SL_HTTP_SERVER_SELECT_TIMEOUT_MS 100
+#endif
+
 /******************************************************
  *                   Enumerations
  ******************************************************/
@@ -378,8 +414,24 @@ typedef struct {
   sl_http_request_handler_t
     default_handler; ///< Default request handler function to be called when no specific handler matches the request URI.
   uint16_t client_idle_time; ///< Idle duration in seconds before the client is considered inactive.
+  uint16_t
+    keep_alive_timeout; ///< Idle duration in seconds a persistent connection is kept open between requests. 0 closes the connection after every response.
 } sl_http_server_config_t;
 
+/**
+ * @brief
+ *   Structure representing a persistent client connection held open by the HTTP server.
+ */
+typedef struct {
+  int socket; ///< Client socket descriptor, or -1 if the slot is free.
+  uint32_t
+    last_activity; ///< Kernel tick count when the connection was accepted, the last request completed or the next one started arriving.
+  uint16_t request_count; ///< Number of requests served on this connection.
+  char request_buffer
+    [SL_HTTP_SERVER_MAX_HEADER_BUFFER_LENGTH]; ///< Received data of the next request, kept until its headers are complete.
+  uint32_t buffered_length; ///< Length of the data in request_buffer.
+} sl_http_server_connection_t;
+
 /**
  * @brief
  *   HTTP server handle used to manage all HTTP server functions.
@@ -400,6 +452,11 @@ typedef struct sl_http_server_s {
   uint32_t rem_len;         ///< Remaining length of data to be processed in the request.
   bool response_sent;       ///< Flag indicating whether the response has been sent for the current request.
   uint32_t rem_resp_length; ///< Remaining length of data to be sent in the response.
+  bool keep_alive;          ///< Flag indicating whether the connection stays open after the current response.
+  uint32_t
+    buffered_length; ///< Length of pipelined request data at the start of request_buffer that has not been processed yet.
+  sl_http_server_connection_t
+    connections[SL_HTTP_SERVER_MAX_CONNECTIONS]; ///< Persistent client connections served from the server thread.
 } sl_http_server_t;
 
 /**
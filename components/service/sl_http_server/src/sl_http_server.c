@@ -45,11 +45,13 @@
 #include <string.h>
 #include <stdlib.h>
 #include <ctype.h>
+#include <strings.h>
 
-#define BACK_LOG                      1 ///< As we are processing one request at a time, the backlog is set to one.
-#define SL_HIGH_PERFORMANCE_SOCKET    BIT(7)
-#define HTTP_MAX_HEADER_LENGTH        (SL_HTTP_SERVER_MAX_HEADER_BUFFER_LENGTH - 1)
-#define HTTP_CONNECTION_STATUS_HEADER "Connection: close\r\n\r\n"
+#define BACK_LOG                          SL_HTTP_SERVER_MAX_CONNECTIONS ///< One pending client per connection slot.
+#define SL_HIGH_PERFORMANCE_SOCKET        BIT(7)
+#define HTTP_MAX_HEADER_LENGTH            (SL_HTTP_SERVER_MAX_HEADER_BUFFER_LENGTH - 1)
+#define HTTP_CONNECTION_STATUS_HEADER     "Connection: close\r\n\r\n"
+#define HTTP_CONNECTION_KEEP_ALIVE_HEADER "Connection: keep-alive\r\nKeep-Alive: timeout=%u\r\n\r\n"
 
 #define HTTP_SERVER_START_SUCCESS   BIT(0)
 #define HTTP_SERVER_START_FAILED    BIT(1)
@@ -64,6 +66,7 @@ static int server_socket               = -1;
 static int client_socket               = -1;
 static sl_http_server_t *server_handle = NULL;
 static osThreadId_t http_server_id     = NULL;
+static bool select_supported           = true;
 
 const osThreadAttr_t http_server_attributes = {
   .name       = "http_server",
@@ -99,6 +102,19 @@ static sl_status_t unknown_request_handler(sl_http_server_t *handle, sl_http_ser
   return SL_STATUS_OK;
 }
 
+// Case-insensitive search for token in the header line [line, end)
+static bool sli_header_contains(const char *line, const char *end, const char *token)
+{
+  size_t token_length = strlen(token);
+
+  for (; (line + token_length) <= end; line++) {
+    if (0 == strncasecmp(line, token, token_length)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 static sl_status_t sli_parse_http_headers(sl_http_server_t *handle, int length)
 {
   uint16_t header_count   = 0;
@@ -160,6 +176,9 @@ static sl_status_t sli_parse_http_headers(sl_http_server_t *handle, int length)
   length         = strlen(sol);
   headers        = sol;
 
+  // HTTP/1.1 connections are persistent unless the client asks otherwise
+  handle->keep_alive = (SL_HTTP_VERSION_1_1 == handle->request.version);
+
   target = strchr(handle->request.uri.path, '?');
   if (NULL != target) {
     target[0] = 0;
@@ -210,6 +229,12 @@ static sl_status_t sli_parse_http_headers(sl_http_server_t *handle, int length)
           strncpy(content_length, target, string_length);
           handle->request.request_data_length = atoi(content_length);
         }
+      } else if (0 == strncasecmp("Connection", sol, strlen("Connection"))) {
+        if (sli_header_contains(sol, &headers[i], "close")) {
+          handle->keep_alive = false;
+        } else if (sli_header_contains(sol, &headers[i], "keep-alive")) {
+          handle->keep_alive = true;
+        }
       }
 
       sol = &(headers[i + 2]);
@@ -221,65 +246,73 @@ static sl_status_t sli_parse_http_headers(sl_http_server_t *handle, int length)
   return SL_STATUS_OK;
 }
 
-// Define the thread function for handling individual clients
-static void sli_process_request(sl_http_server_t *handle, int client_socket)
+// Receives one request on the socket, runs its handler and returns true if the connection can serve another request.
+// Headers already complete in request_buffer are served without reading the socket.
+// Request data following the current request (pipelined requests) is left at the start of request_buffer.
+static bool sli_process_request(sl_http_server_t *handle, int socket, bool persistent_allowed)
 {
-  int recv_length                   = 0;
-  int rem_length                    = 0;
+  int recv_length                   = (int)handle->buffered_length;
   sl_http_server_request_t *request = NULL;
-  char *recv_buffer                 = NULL;
+  char *sep_pos                     = NULL;
 
   handle->request.request_data_length = 0;
   handle->response_sent               = false;
-  rem_length                          = (SL_HTTP_SERVER_MAX_HEADER_BUFFER_LENGTH - 1);
-  recv_buffer                         = handle->request_buffer;
-
-  // Loop until Complete headers are received
-  while (rem_length > 0) {
-    int length = recv(client_socket, recv_buffer, rem_length, 0);
-    if (length < 0) {
-      SL_DEBUG_LOG("\r\nSocket receive failed with bsd error: %d\r\n", errno);
-      close(client_socket);
-      return;
+  handle->keep_alive                  = false;
+  handle->data_length                 = 0;
+  handle->rem_len                     = 0;
+  handle->rem_resp_length             = 0;
+  handle->buffered_length             = 0;
+  handle->request_buffer[recv_length] = 0;
+
+  // Loop until complete headers are received, starting with any pipelined data already buffered
+  sep_pos = strstr(handle->request_buffer, "\r\n\r\n");
+  while (NULL == sep_pos) {
+    int rem_length = HTTP_MAX_HEADER_LENGTH - recv_length;
+    if (rem_length <= 0) {
+      SL_DEBUG_LOG("\r\nRequest headers exceed the request buffer\r\n");
+      return false;
     }
-    char *sol = &(recv_buffer[recv_length]);
-    recv_length += length;
-    rem_length -= length;
-    recv_buffer[recv_length] = 0;
-    recv_buffer += length;
-
-    // Search for end of the header
-    char *sep_pos = strstr(sol, "\r\n\r\n");
-    SL_DEBUG_LOG("Got chunk: \n%s\n", sol);
-
-    if (NULL != sep_pos) {
-      sep_pos[2] = 0;
-      sep_pos[3] = 0;
-      rem_length = 0;
 
-      if (SL_STATUS_OK != sli_parse_http_headers(handle, length)) {
-        break;
+    int length = recv(socket, &(handle->request_buffer[recv_length]), rem_length, 0);
+    if (length <= 0) {
+      if (length < 0) {
+        SL_DEBUG_LOG("\r\nSocket receive failed with bsd error: %d\r\n", errno);
       }
-      SL_DEBUG_LOG("Got expected data length : %lu\n", handle->request.request_data_length);
+      return false;
+    }
 
-      if (handle->request.request_data_length > 0) {
-        int header_length = (int)(sep_pos - handle->request_buffer);
-        recv_buffer       = (char *)handle->req_data;
-        handle->rem_len   = handle->request.request_data_length;
+    // The end of the header may straddle two chunks
+    int search_start = (recv_length > 3) ? (recv_length - 3) : 0;
+    SL_DEBUG_LOG("Got chunk: \n%s\n", &(handle->request_buffer[recv_length]));
+    recv_length += length;
+    handle->request_buffer[recv_length] = 0;
+    sep_pos                             = strstr(&(handle->request_buffer[search_start]), "\r\n\r\n");
+  }
 
-        SL_DEBUG_LOG("Got header length : %u\n", header_length);
+  int body_offset = (int)(sep_pos - handle->request_buffer) + 4;
+  sep_pos[2]      = 0;
+  sep_pos[3]      = 0;
 
-        // Check if we recived data along with header
-        if (recv_length > (header_length + 4)) {
-          length              = recv_length - (header_length + 4);
-          handle->data_length = length;
-          SL_DEBUG_LOG("Got remaining data length : %lu\n", handle->data_length);
-          handle->req_data = (uint8_t *)(handle->request_buffer + header_length + 4);
-        }
-        recv_length = 0;
-      }
-    }
+  if (SL_STATUS_OK != sli_parse_http_headers(handle, body_offset)) {
+    return false;
   }
+  SL_DEBUG_LOG("Got expected data length : %lu\n", handle->request.request_data_length);
+
+  // Check if we received data along with the header. Anything beyond the body belongs to the next request.
+  uint32_t buffered_body = (uint32_t)(recv_length - body_offset);
+  if (buffered_body > handle->request.request_data_length) {
+    buffered_body = handle->request.request_data_length;
+  }
+  handle->rem_len = handle->request.request_data_length;
+  if (buffered_body > 0) {
+    handle->data_length = buffered_body;
+    handle->req_data    = (uint8_t *)(handle->request_buffer + body_offset);
+    SL_DEBUG_LOG("Got remaining data length : %lu\n", handle->data_length);
+  }
+  int pipelined_offset = body_offset + (int)buffered_body;
+  int pipelined_length = recv_length - pipelined_offset;
+
+  handle->keep_alive = handle->keep_alive && persistent_allowed;
 
   request = &(handle->request);
 
@@ -295,7 +328,168 @@ static void sli_process_request(sl_http_server_t *handle, int client_socket)
   if (request->uri.path && false == handle->response_sent) {
     handle->config.default_handler(handle, &(handle->request));
   }
-  return;
+
+  // The connection is reusable only if the response is complete and no request body is left unread on the socket
+  if (!handle->keep_alive || !handle->response_sent || (0 != handle->rem_resp_length)
+      || (handle->rem_len > handle->data_length)) {
+    return false;
+  }
+
+  if (pipelined_length > 0) {
+    memmove(handle->request_buffer, &(handle->request_buffer[pipelined_offset]), pipelined_length);
+    handle->buffered_length = (uint32_t)pipelined_length;
+  }
+  return true;
+}
+
+// Reads what select() reported on the connection and serves every request whose headers are complete.
+// A partially received request stays in the connection buffer until the next poll.
+// Returns true if the connection stays open.
+static bool sli_serve_connection(sl_http_server_t *handle, sl_http_server_connection_t *connection)
+{
+  int rem_length = HTTP_MAX_HEADER_LENGTH - (int)connection->buffered_length;
+  int length     = recv(connection->socket, &(connection->request_buffer[connection->buffered_length]), rem_length, 0);
+  if (length <= 0) {
+    if (length < 0) {
+      SL_DEBUG_LOG("\r\nSocket receive failed with bsd error: %d\r\n", errno);
+    }
+    return false;
+  }
+
+  // The header wait of a new request starts with its first bytes
+  if (0 == connection->buffered_length) {
+    connection->last_activity = osKernelGetTickCount();
+  }
+  connection->buffered_length += (uint32_t)length;
+  connection->request_buffer[connection->buffered_length] = 0;
+
+  handle->client_socket = connection->socket;
+  while (NULL != strstr(connection->request_buffer, "\r\n\r\n")) {
+    bool persistent_allowed = (connection->request_count + 1) < SL_HTTP_SERVER_MAX_KEEP_ALIVE_REQUESTS;
+
+    memcpy(handle->request_buffer, connection->request_buffer, connection->buffered_length);
+    handle->buffered_length     = connection->buffered_length;
+    connection->buffered_length = 0;
+    if (!sli_process_request(handle, connection->socket, persistent_allowed)) {
+      handle->buffered_length = 0;
+      return false;
+    }
+    connection->request_count++;
+    connection->last_activity = osKernelGetTickCount();
+
+    // Keep the pipelined data for the next request
+    memcpy(connection->request_buffer, handle->request_buffer, handle->buffered_length);
+    connection->buffered_length                             = handle->buffered_length;
+    connection->request_buffer[connection->buffered_length] = 0;
+    handle->buffered_length                                 = 0;
+  }
+
+  if (connection->buffered_length >= HTTP_MAX_HEADER_LENGTH) {
+    SL_DEBUG_LOG("\r\nRequest headers exceed the request buffer\r\n");
+    return false;
+  }
+  return true;
+}
+
+static void sli_close_connections(sl_http_server_t *handle)
+{
+  for (uint8_t i = 0; i < SL_HTTP_SERVER_MAX_CONNECTIONS; i++) {
+    if (handle->connections[i].socket != -1) {
+      close(handle->connections[i].socket);
+      handle->connections[i].socket = -1;
+    }
+  }
+}
+
+static sl_http_server_connection_t *sli_get_free_connection(sl_http_server_t *handle)
+{
+  for (uint8_t i = 0; i < SL_HTTP_SERVER_MAX_CONNECTIONS; i++) {
+    if (handle->connections[i].socket == -1) {
+      return &(handle->connections[i]);
+    }
+  }
+  return NULL;
+}
+
+static bool sli_has_open_connections(const sl_http_server_t *handle)
+{
+  for (uint8_t i = 0; i < SL_HTTP_SERVER_MAX_CONNECTIONS; i++) {
+    if (handle->connections[i].socket != -1) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Expires idle persistent connections and those whose request headers take too long, and serves readable ones
+static void sli_poll_connections(sl_http_server_t *handle)
+{
+  fd_set read_fds;
+  struct timeval timeout = { .tv_sec = 0, .tv_usec = SL_HTTP_SERVER_SELECT_TIMEOUT_MS * 1000 };
+  uint32_t idle_ticks    = handle->config.keep_alive_timeout * osKernelGetTickFreq();
+  uint32_t header_ticks  = idle_ticks;
+  uint32_t current_tick  = osKernelGetTickCount();
+  int max_socket         = -1;
+
+  // A request being received is bounded by the receive timeout, if one is configured
+  if (0 != handle->config.client_idle_time) {
+    header_ticks = handle->config.client_idle_time * osKernelGetTickFreq();
+  }
+
+  FD_ZERO(&read_fds);
+  for (uint8_t i = 0; i < SL_HTTP_SERVER_MAX_CONNECTIONS; i++) {
+    sl_http_server_connection_t *connection = &(handle->connections[i]);
+    if (connection->socket == -1) {
+      continue;
+    }
+    bool awaiting_request = (0 == connection->request_count) || (connection->buffered_length > 0);
+    if ((current_tick - connection->last_activity) >= (awaiting_request ? header_ticks : idle_ticks)) {
+      SL_DEBUG_LOG("\r\nClosing idle connection: %d\r\n", connection->socket);
+      close(connection->socket);
+      connection->socket = -1;
+      continue;
+    }
+    FD_SET(connection->socket, &read_fds);
+    if (connection->socket > max_socket) {
+      max_socket = connection->socket;
+    }
+  }
+
+  if (max_socket < 0) {
+    return;
+  }
+
+  int ready = select(max_socket + 1, &read_fds, NULL, NULL, &timeout);
+  if (ready < 0) {
+    // Without select, idle connections can't be watched, so serve every client with a single request from now on.
+    // Requests still being waited for are finished with blocking reads before their connections are closed.
+    SL_DEBUG_LOG("\r\nSelect failed with bsd error: %d, disabling persistent connections\r\n", errno);
+    select_supported = false;
+    for (uint8_t i = 0; i < SL_HTTP_SERVER_MAX_CONNECTIONS; i++) {
+      sl_http_server_connection_t *connection = &(handle->connections[i]);
+      if ((connection->socket != -1) && ((0 == connection->request_count) || (connection->buffered_length > 0))) {
+        memcpy(handle->request_buffer, connection->request_buffer, connection->buffered_length);
+        handle->buffered_length = connection->buffered_length;
+        handle->client_socket   = connection->socket;
+        sli_process_request(handle, connection->socket, false);
+        handle->buffered_length = 0;
+      }
+    }
+    sli_close_connections(handle);
+    return;
+  }
+
+  for (uint8_t i = 0; (i < SL_HTTP_SERVER_MAX_CONNECTIONS) && (ready > 0); i++) {
+    sl_http_server_connection_t *connection = &(handle->connections[i]);
+    if ((connection->socket == -1) || !FD_ISSET(connection->socket, &read_fds)) {
+      continue;
+    }
+    ready--;
+    if (!sli_serve_connection(handle, connection)) {
+      close(connection->socket);
+      connection->socket = -1;
+    }
+  }
 }
 
 static void client_accept_callback(int32_t sock_id, struct sockaddr *addr, uint8_t ip_version)
@@ -373,26 +567,32 @@ static void sli_http_server(const void *arg)
 
   sl_si91x_time_value timeout = { 0 };
   timeout.tv_sec              = server_handle->config.client_idle_time;
+  bool accept_pending         = false;
+  select_supported            = true;
 
   // Indicate to HTTP server start API that HTTP server has started successfully.
   osEventFlagsSet(server_handle->http_server_id, HTTP_SERVER_START_SUCCESS);
 
   while (1) {
-    socket_return_value = sl_si91x_accept_async(server_socket, client_accept_callback);
-    if (socket_return_value != SLI_SI91X_NO_ERROR) {
-      SL_DEBUG_LOG("\r\nSocket accept failed with bsd error: %d\r\n", errno);
+    if (!accept_pending) {
+      socket_return_value = sl_si91x_accept_async(server_socket, client_accept_callback);
+      if (socket_return_value != SLI_SI91X_NO_ERROR) {
+        SL_DEBUG_LOG("\r\nSocket accept failed with bsd error: %d\r\n", errno);
+      }
+      accept_pending = true;
     }
 
-    // Wait for small amount of time to check if HTTP server stop is called
+    // Block only when no persistent connection needs to be watched
     result = osEventFlagsWait(server_handle->http_server_id,
                               HTTP_SERVER_STOP_CMD | HTTP_SERVER_CONNECT_SUCCESS,
                               osFlagsWaitAny,
-                              osWaitForever);
-    if (result != (uint32_t)osErrorTimeout) {
+                              sli_has_open_connections(server_handle) ? 0 : osWaitForever);
+    if ((result & osFlagsError) == 0) {
       if (result & HTTP_SERVER_STOP_CMD) {
         // HTTP_SERVER_STOP_CMD flag is set
         server_handle->server_socket = -1;
         SL_DEBUG_LOG("\r\nIn http server thread: Got Stop Command\r\n");
+        sli_close_connections(server_handle);
         close(server_socket);
         osEventFlagsSet(server_handle->http_server_id, HTTP_SERVER_EXIT);
         break;
@@ -400,6 +600,7 @@ static void sli_http_server(const void *arg)
       if (result & HTTP_SERVER_CONNECT_SUCCESS) {
         // HTTP_SERVER_CONNECT_SUCCESS flag is set
         osEventFlagsClear(server_handle->http_server_id, HTTP_SERVER_CONNECT_SUCCESS);
+        accept_pending = false;
         SL_DEBUG_LOG("\r\nClient Socket:%d----------------------------", client_socket);
         server_handle->server_socket = server_socket;
         server_handle->client_socket = client_socket;
@@ -415,11 +616,23 @@ static void sli_http_server(const void *arg)
           }
         }
 
-        sli_process_request(server_handle, client_socket);
+        // With a free slot the connection is persistent and its requests are read once select() reports them,
+        // otherwise a single request is served right away and the connection is closed
+        sl_http_server_connection_t *slot = sli_get_free_connection(server_handle);
+        if ((slot != NULL) && select_supported && (server_handle->config.keep_alive_timeout != 0)) {
+          slot->socket          = client_socket;
+          slot->last_activity   = osKernelGetTickCount();
+          slot->request_count   = 0;
+          slot->buffered_length = 0;
+        } else {
+          sli_process_request(server_handle, client_socket, false);
+          server_handle->buffered_length = 0;
+          close(client_socket);
+        }
       }
     }
-    close(client_socket);
-    server_handle->rem_resp_length = 0;
+
+    sli_poll_connections(server_handle);
   }
 
   while (1) {
@@ -463,8 +676,8 @@ static int sli_send_response_buffer(sl_http_server_t *server, sl_http_server_res
   // Prepare response code
   sprintf(response_code, "%d", response->response_code);
 
-  // Prepare content length if available
-  if (response->expected_data_length > 0) {
+  // Prepare content length if available. Persistent connections always need it to delimit the response.
+  if ((response->expected_data_length > 0) || server->keep_alive) {
     sprintf(content_length, "%lu", response->expected_data_length);
   }
 
@@ -491,7 +704,7 @@ static int sli_send_response_buffer(sl_http_server_t *server, sl_http_server_res
   }
 
   // Add content-length if available
-  if (response->expected_data_length > 0) {
+  if ((response->expected_data_length > 0) || server->keep_alive) {
     buffer_length += snprintf(response_buffer + buffer_length,
                               strlen("Content-Length: ") + strlen(content_length) + 3,
                               "Content-Length: %s\r\n",
@@ -510,10 +723,17 @@ static int sli_send_response_buffer(sl_http_server_t *server, sl_http_server_res
   }
 
   // Add connection status header
-  buffer_length += snprintf(response_buffer + buffer_length,
-                            strlen(HTTP_CONNECTION_STATUS_HEADER) + 1,
-                            "%s",
-                            HTTP_CONNECTION_STATUS_HEADER);
+  if (server->keep_alive) {
+    buffer_length += snprintf(response_buffer + buffer_length,
+                              HTTP_MAX_HEADER_LENGTH - buffer_length,
+                              HTTP_CONNECTION_KEEP_ALIVE_HEADER,
+                              server->config.keep_alive_timeout);
+  } else {
+    buffer_length += snprintf(response_buffer + buffer_length,
+                              strlen(HTTP_CONNECTION_STATUS_HEADER) + 1,
+                              "%s",
+                              HTTP_CONNECTION_STATUS_HEADER);
+  }
 
   // Add response data if available
   if ((NULL != response->data) && (response->current_data_length > 0)) {
@@ -561,9 +781,16 @@ sl_status_t sl_http_server_init(sl_http_server_t *handle, const sl_http_server_c
   } else {
     handle->config.default_handler = unknown_request_handler;
   }
-  handle->config.handlers_list    = config->handlers_list;
-  handle->config.handlers_count   = config->handlers_count;
-  handle->config.client_idle_time = config->client_idle_time;
+  handle->config.handlers_list      = config->handlers_list;
+  handle->config.handlers_count     = config->handlers_count;
+  handle->config.client_idle_time   = config->client_idle_time;
+  handle->config.keep_alive_timeout = config->keep_alive_timeout;
+  handle->keep_alive                = false;
+  handle->buffered_length           = 0;
+  for (uint8_t i = 0; i < SL_HTTP_SERVER_MAX_CONNECTIONS; i++) {
+    handle->connections[i].socket          = -1;
+    handle->connections[i].buffered_length = 0;
+  }
 
   memset(handle->request_buffer, 0, sizeof(SL_HTTP_SERVER_MAX_HEADER_BUFFER_LENGTH));
   handle->http_server_id = osEventFlagsNew(NULL);
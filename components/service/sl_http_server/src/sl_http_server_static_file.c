@@ -0,0 +1,587 @@
+/***************************************************************************/ /**
+ * @file  sl_http_server_static_file.c
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include "sl_http_server_static_file.h"
+#include "sl_http_server.h"
+#include "sl_constants.h"
+#include "socket.h"
+#include <errno.h>
+#include <string.h>
+#include <strings.h>
+#include <stdio.h>
+
+#define HTTP_STATIC_FILE_INDEX                 "index.html"
+#define HTTP_STATIC_FILE_GZIP_SUFFIX           ".gz"
+#define HTTP_STATIC_FILE_DEFAULT_CONTENT_TYPE  "application/octet-stream"
+#define HTTP_STATIC_FILE_MAX_REQUEST_HEADERS   16
+#define HTTP_STATIC_FILE_ETAG_LENGTH           20  ///< Quoted "<size>-<validator>" in hex
+#define HTTP_STATIC_FILE_DATE_LENGTH           30  ///< IMF-fixdate, for example "Thu, 01 Jan 1970 00:00:00 GMT"
+#define HTTP_STATIC_FILE_ENTITY_HEADER_LENGTH  224 ///< Content-Type, Content-Length, ETag, Last-Modified, Content-Encoding and Vary
+#define HTTP_STATIC_FILE_CONNECTION_CLOSE      "Connection: close\r\n\r\n"
+#define HTTP_STATIC_FILE_CONNECTION_KEEP_ALIVE "Connection: keep-alive\r\nKeep-Alive: timeout=%u\r\n\r\n"
+#define HTTP_STATIC_FILE_FNV_OFFSET_BASIS      2166136261UL
+#define HTTP_STATIC_FILE_FNV_PRIME             16777619UL
+#define HTTP_STATIC_FILE_SECONDS_PER_DAY       86400UL
+
+// The status line, the entity headers and the connection headers are formatted into the chunk buffer
+#if SL_HTTP_SERVER_STATIC_FILE_CHUNK_SIZE < 512
+#error "SL_HTTP_SERVER_STATIC_FILE_CHUNK_SIZE must be at least 512 bytes"
+#endif
+
+/******************************************************
+ *                    Structures
+ ******************************************************/
+
+// Response headers of a recently served file
+typedef struct {
+  char uri[SL_HTTP_SERVER_STATIC_FILE_MAX_PATH_LENGTH]; // Request path, empty if the entry is unused
+  bool gzip_accepted;                                  // Whether the request accepted gzip, part of the key
+  bool gzip;                                           // Whether the precompressed variant is served
+  uint32_t size;                                       // Size of the served file
+  uint32_t last_used;                                  // Cache clock value of the last use
+  bool has_time;                                       // Whether the validator is the time attribute
+  uint32_t validator;                                  // Time attribute, or content hash without one
+  char etag[HTTP_STATIC_FILE_ETAG_LENGTH];
+  char last_modified[HTTP_STATIC_FILE_DATE_LENGTH]; // Empty if the file has no time attribute
+  uint16_t header_length;
+  char header[HTTP_STATIC_FILE_ENTITY_HEADER_LENGTH]; // Preformatted entity headers
+} sli_http_static_file_entry_t;
+
+typedef struct {
+  const char *extension;
+  const char *content_type;
+} sli_http_static_file_content_type_t;
+
+/******************************************************
+ *               Variable Definitions
+ ******************************************************/
+static sl_http_server_static_file_config_t static_file_config = { 0 };
+static sli_http_static_file_entry_t static_file_cache[SL_HTTP_SERVER_STATIC_FILE_CACHE_ENTRIES];
+static uint32_t static_file_cache_clock = 0;
+static uint8_t static_file_chunk[SL_HTTP_SERVER_STATIC_FILE_CHUNK_SIZE];
+
+static const sli_http_static_file_content_type_t static_file_content_types[] = {
+  { "html", SL_HTTP_CONTENT_TYPE_TEXT_HTML },
+  { "htm", SL_HTTP_CONTENT_TYPE_TEXT_HTML },
+  { "css", SL_HTTP_CONTENT_TYPE_TEXT_CSS },
+  { "js", SL_HTTP_CONTENT_TYPE_TEXT_JAVASCRIPT },
+  { "json", SL_HTTP_CONTENT_TYPE_APPLICATION_JSON },
+  { "xml", SL_HTTP_CONTENT_TYPE_APPLICATION_XML },
+  { "txt", SL_HTTP_CONTENT_TYPE_TEXT_PLAIN },
+  { "csv", SL_HTTP_CONTENT_TYPE_TEXT_CSV },
+  { "pdf", SL_HTTP_CONTENT_TYPE_APPLICATION_PDF },
+  { "svg", "image/svg+xml" },
+  { "png", "image/png" },
+  { "jpg", "image/jpeg" },
+  { "jpeg", "image/jpeg" },
+  { "gif", "image/gif" },
+  { "ico", "image/x-icon" },
+  { "wasm", "application/wasm" },
+};
+
+/******************************************************
+ *               Static functions
+ ******************************************************/
+// Whether the parameters of an Accept-Encoding item, up to end, leave it acceptable. A missing q-value means q=1.
+static bool sli_has_nonzero_q_value(const char *params, const char *end)
+{
+  while (NULL != (params = memchr(params, ';', (size_t)(end - params)))) {
+    params++;
+    params += strspn(params, " \t");
+    if (((params + 1) < end) && (('q' == params[0]) || ('Q' == params[0])) && ('=' == params[1])) {
+      // "0", "0.", and "0.0" up to "0.000" are the only zero q-values
+      for (params += 2; (params < end) && (('.' == *params) || (('0' <= *params) && (*params <= '9'))); params++) {
+        if (('0' != *params) && ('.' != *params)) {
+          return true;
+        }
+      }
+      return false;
+    }
+  }
+  return true;
+}
+
+// Whether an Accept-Encoding header value accepts coding. An entry for the coding takes precedence over "*".
+static bool sli_accepts_encoding(const char *value, const char *coding)
+{
+  size_t coding_length = strlen(coding);
+  int8_t coding_state  = -1; // -1 if not listed, else 1 if acceptable
+  int8_t any_state     = -1; // Same for "*"
+
+  while ('\0' != *value) {
+    const char *item   = value + strspn(value, " \t,");
+    const char *end    = item + strcspn(item, ",");
+    size_t name_length = strcspn(item, " \t;,");
+
+    if ((name_length == coding_length) && (0 == strncasecmp(item, coding, coding_length))) {
+      coding_state = sli_has_nonzero_q_value(item + name_length, end) ? 1 : 0;
+    } else if ((1 == name_length) && ('*' == item[0])) {
+      any_state = sli_has_nonzero_q_value(item + name_length, end) ? 1 : 0;
+    }
+    value = end;
+  }
+  return (coding_state >= 0) ? (1 == coding_state) : (1 == any_state);
+}
+
+static const char *sli_get_content_type(const char *path)
+{
+  const char *extension = strrchr(path, '.');
+
+  if ((NULL == extension) || (NULL != strchr(extension, '/'))) {
+    return HTTP_STATIC_FILE_DEFAULT_CONTENT_TYPE;
+  }
+  extension++;
+
+  for (uint8_t i = 0; i < (sizeof(static_file_content_types) / sizeof(static_file_content_types[0])); i++) {
+    if (0 == strcasecmp(extension, static_file_content_types[i].extension)) {
+      return static_file_content_types[i].content_type;
+    }
+  }
+  return HTTP_STATIC_FILE_DEFAULT_CONTENT_TYPE;
+}
+
+// Formats seconds since the Unix epoch as an IMF-fixdate
+static void sli_format_http_date(uint32_t seconds, char *buffer)
+{
+  static const char *const week_days[] = { "Thu", "Fri", "Sat", "Sun", "Mon", "Tue", "Wed" }; // 1970-01-01 was a Thursday
+  static const char *const months[]    = { "Jan", "Feb", "Mar", "Apr", "May", "Jun",
+                                           "Jul", "Aug", "Sep", "Oct", "Nov", "Dec" };
+  uint32_t days                        = seconds / HTTP_STATIC_FILE_SECONDS_PER_DAY;
+  uint32_t day_seconds                 = seconds % HTTP_STATIC_FILE_SECONDS_PER_DAY;
+
+  // Convert days to a civil date, with years starting on March 1st so that leap days come last
+  uint32_t shifted_days  = days + 719468;
+  uint32_t era           = shifted_days / 146097;
+  uint32_t day_of_era    = shifted_days - (era * 146097);
+  uint32_t year_of_era   = (day_of_era - (day_of_era / 1460) + (day_of_era / 36524) - (day_of_era / 146096)) / 365;
+  uint32_t day_of_year   = day_of_era - ((365 * year_of_era) + (year_of_era / 4) - (year_of_era / 100));
+  uint32_t shifted_month = ((5 * day_of_year) + 2) / 153;
+  uint32_t day           = day_of_year - (((153 * shifted_month) + 2) / 5) + 1;
+  uint32_t month         = (shifted_month < 10) ? (shifted_month + 3) : (shifted_month - 9);
+  uint32_t year          = year_of_era + (era * 400) + ((month <= 2) ? 1 : 0);
+
+  snprintf(buffer,
+           HTTP_STATIC_FILE_DATE_LENGTH,
+           "%s, %02lu %s %04lu %02lu:%02lu:%02lu GMT",
+           week_days[days % 7],
+           (unsigned long)day,
+           months[month - 1],
+           (unsigned long)year,
+           (unsigned long)(day_seconds / 3600),
+           (unsigned long)((day_seconds / 60) % 60),
+           (unsigned long)(day_seconds % 60));
+}
+
+// Maps the request path below the root directory. Returns false if the path does not fit.
+static bool sli_build_file_path(char *path, const char *uri, bool gzip)
+{
+  const char *root  = (NULL != static_file_config.root_directory) ? static_file_config.root_directory : "";
+  const char *index = ('/' == uri[strlen(uri) - 1]) ? HTTP_STATIC_FILE_INDEX : "";
+  int length        = snprintf(path,
+                        SL_HTTP_SERVER_STATIC_FILE_MAX_PATH_LENGTH,
+                        "%s%s%s%s",
+                        root,
+                        uri,
+                        index,
+                        gzip ? HTTP_STATIC_FILE_GZIP_SUFFIX : "");
+
+  return (length > 0) && (length < SL_HTTP_SERVER_STATIC_FILE_MAX_PATH_LENGTH);
+}
+
+static sli_http_static_file_entry_t *sli_find_cache_entry(const char *uri, bool gzip_accepted)
+{
+  for (uint8_t i = 0; i < SL_HTTP_SERVER_STATIC_FILE_CACHE_ENTRIES; i++) {
+    sli_http_static_file_entry_t *entry = &static_file_cache[i];
+    if (('\0' != entry->uri[0]) && (entry->gzip_accepted == gzip_accepted) && (0 == strcmp(entry->uri, uri))) {
+      return entry;
+    }
+  }
+  return NULL;
+}
+
+static sli_http_static_file_entry_t *sli_get_least_recently_used_entry(void)
+{
+  sli_http_static_file_entry_t *victim = &static_file_cache[0];
+
+  for (uint8_t i = 0; i < SL_HTTP_SERVER_STATIC_FILE_CACHE_ENTRIES; i++) {
+    sli_http_static_file_entry_t *entry = &static_file_cache[i];
+    if ('\0' == entry->uri[0]) {
+      return entry;
+    }
+    if ((static_file_cache_clock - entry->last_used) > (static_file_cache_clock - victim->last_used)) {
+      victim = entry;
+    }
+  }
+  return victim;
+}
+
+// Computes the FNV-1a hash of the file content and rewinds the file. Only done when a file is loaded into the cache.
+static sl_status_t sli_hash_file(lfs_file_t *file, uint32_t *hash)
+{
+  lfs_ssize_t length = 0;
+
+  *hash = HTTP_STATIC_FILE_FNV_OFFSET_BASIS;
+  while ((length = lfs_file_read(static_file_config.file_system, file, static_file_chunk, sizeof(static_file_chunk)))
+         > 0) {
+    for (lfs_ssize_t i = 0; i < length; i++) {
+      *hash = (*hash ^ static_file_chunk[i]) * HTTP_STATIC_FILE_FNV_PRIME;
+    }
+  }
+  if ((length < 0) || (lfs_file_rewind(static_file_config.file_system, file) < 0)) {
+    return SL_STATUS_FAIL;
+  }
+  return SL_STATUS_OK;
+}
+
+// Gets the validator of an open file: its time attribute, or the hash of its content when it has none
+static sl_status_t sli_get_file_validator(lfs_file_t *file, const char *path, bool *has_time, uint32_t *validator)
+{
+  *has_time = (lfs_getattr(static_file_config.file_system,
+                           path,
+                           SL_HTTP_SERVER_STATIC_FILE_TIME_ATTRIBUTE,
+                           validator,
+                           sizeof(*validator))
+               == (lfs_ssize_t)sizeof(*validator));
+  if (*has_time) {
+    return SL_STATUS_OK;
+  }
+  return sli_hash_file(file, validator);
+}
+
+// Checks the file variant of a cached entry against its metadata only: the file must still exist with the same size
+// and time attribute. The content is not read, so a file without time attribute rewritten with the same size keeps
+// its cached headers until the cache is invalidated.
+static sl_status_t sli_revalidate_cache_entry(const sli_http_static_file_entry_t *entry, char *path)
+{
+  lfs_t *file_system = static_file_config.file_system;
+  struct lfs_info info;
+  uint32_t time = 0;
+  bool has_time = false;
+
+  if (!sli_build_file_path(path, entry->uri, entry->gzip) || (lfs_stat(file_system, path, &info) < 0)
+      || (LFS_TYPE_REG != info.type)) {
+    return SL_STATUS_NOT_FOUND;
+  }
+  if (info.size != entry->size) {
+    return SL_STATUS_FAIL;
+  }
+
+  has_time = (lfs_getattr(file_system, path, SL_HTTP_SERVER_STATIC_FILE_TIME_ATTRIBUTE, &time, sizeof(time))
+              == (lfs_ssize_t)sizeof(time));
+  if ((has_time != entry->has_time) || (has_time && (time != entry->validator))) {
+    return SL_STATUS_FAIL;
+  }
+  return SL_STATUS_OK;
+}
+
+// Looks the file up in the file system, leaves it open and stores its response headers in the least recently used entry
+static sl_status_t sli_load_cache_entry(const char *uri,
+                                        bool gzip_accepted,
+                                        lfs_file_t *file,
+                                        sli_http_static_file_entry_t **entry)
+{
+  lfs_t *file_system                   = static_file_config.file_system;
+  sli_http_static_file_entry_t *victim = sli_get_least_recently_used_entry();
+  char path[SL_HTTP_SERVER_STATIC_FILE_MAX_PATH_LENGTH];
+  const char *content_type = NULL;
+  uint32_t validator       = 0;
+  lfs_soff_t size          = 0;
+  bool has_time            = false;
+  bool gzip                = false;
+  int length               = 0;
+
+  if (!sli_build_file_path(path, uri, false)) {
+    return SL_STATUS_NOT_FOUND;
+  }
+  content_type = sli_get_content_type(path);
+
+  // Prefer the precompressed variant when the client accepts it
+  if (gzip_accepted && sli_build_file_path(path, uri, true)
+      && (lfs_file_open(file_system, file, path, LFS_O_RDONLY) >= 0)) {
+    gzip = true;
+  } else if (!sli_build_file_path(path, uri, false) || (lfs_file_open(file_system, file, path, LFS_O_RDONLY) < 0)) {
+    return SL_STATUS_NOT_FOUND;
+  }
+
+  victim->uri[0] = '\0';
+  size           = lfs_file_size(file_system, file);
+  if (size < 0) {
+    lfs_file_close(file_system, file);
+    return SL_STATUS_FAIL;
+  }
+
+  victim->last_modified[0] = '\0';
+  if (SL_STATUS_OK != sli_get_file_validator(file, path, &has_time, &validator)) {
+    lfs_file_close(file_system, file);
+    return SL_STATUS_FAIL;
+  }
+  if (has_time) {
+    sli_format_http_date(validator, victim->last_modified);
+  }
+
+  snprintf(victim->etag, sizeof(victim->etag), "\"%lx-%lx\"", (unsigned long)size, (unsigned long)validator);
+  length = snprintf(victim->header,
+                    sizeof(victim->header),
+                    "Content-Type: %s\r\nContent-Length: %lu\r\nETag: %s\r\n%s%s%s%sVary: Accept-Encoding\r\n",
+                    content_type,
+                    (unsigned long)size,
+                    victim->etag,
+                    ('\0' != victim->last_modified[0]) ? "Last-Modified: " : "",
+                    victim->last_modified,
+                    ('\0' != victim->last_modified[0]) ? "\r\n" : "",
+                    gzip ? "Content-Encoding: gzip\r\n" : "");
+  if ((length < 0) || (length >= (int)sizeof(victim->header))) {
+    lfs_file_close(file_system, file);
+    return SL_STATUS_FAIL;
+  }
+
+  strcpy(victim->uri, uri);
+  victim->gzip_accepted = gzip_accepted;
+  victim->gzip          = gzip;
+  victim->size          = (uint32_t)size;
+  victim->has_time      = has_time;
+  victim->validator     = validator;
+  victim->header_length = (uint16_t)length;
+  *entry                = victim;
+
+  return SL_STATUS_OK;
+}
+
+static bool sli_is_not_modified(const sli_http_static_file_entry_t *entry,
+                                const char *if_none_match,
+                                const char *if_modified_since)
+{
+  // If-Modified-Since is only evaluated when If-None-Match is absent
+  if (NULL != if_none_match) {
+    return (0 == strcmp(if_none_match, "*")) || (NULL != strstr(if_none_match, entry->etag));
+  }
+  return (NULL != if_modified_since) && ('\0' != entry->last_modified[0])
+         && (0 == strcmp(if_modified_since, entry->last_modified));
+}
+
+static int sli_send_chunk(int socket, const uint8_t *data, uint32_t length, uint32_t segment_size)
+{
+  while (length > 0) {
+    uint32_t tx_length = (length > segment_size) ? segment_size : length;
+
+    if (send(socket, data, tx_length, 0) == -1) {
+      return -1;
+    }
+    data += tx_length;
+    length -= tx_length;
+  }
+  return 0;
+}
+
+// Sends the response headers and, if file is not NULL, the file content. The headers share the first segment with the content.
+static sl_status_t sli_send_file(sl_http_server_t *handle,
+                                 const sli_http_static_file_entry_t *entry,
+                                 const char *status_line,
+                                 lfs_file_t *file)
+{
+  int segment_size            = 0;
+  socklen_t segment_size_size = sizeof(segment_size); // in/out parameter
+  uint32_t length             = 0;
+  uint32_t remaining          = (NULL != file) ? entry->size : 0;
+
+  // The socket layer reports the MSS of the connection as its send buffer size
+  getsockopt(handle->client_socket, SOL_SOCKET, SO_SNDBUF, (char *)&segment_size, &segment_size_size);
+  if ((segment_size <= 0) || (segment_size > (int)sizeof(static_file_chunk))) {
+    segment_size = sizeof(static_file_chunk);
+  }
+
+  length = (uint32_t)snprintf((char *)static_file_chunk,
+                              sizeof(static_file_chunk),
+                              "%s %s\r\n",
+                              (SL_HTTP_VERSION_1_1 == handle->request.version) ? "HTTP/1.1" : "HTTP/1.0",
+                              status_line);
+  memcpy(&static_file_chunk[length], entry->header, entry->header_length);
+  length += entry->header_length;
+  if (handle->keep_alive) {
+    length += (uint32_t)snprintf((char *)&static_file_chunk[length],
+                                 sizeof(static_file_chunk) - length,
+                                 HTTP_STATIC_FILE_CONNECTION_KEEP_ALIVE,
+                                 handle->config.keep_alive_timeout);
+  } else {
+    memcpy(&static_file_chunk[length], HTTP_STATIC_FILE_CONNECTION_CLOSE, strlen(HTTP_STATIC_FILE_CONNECTION_CLOSE));
+    length += strlen(HTTP_STATIC_FILE_CONNECTION_CLOSE);
+  }
+
+  // A failure leaves rem_resp_length non-zero, which makes the server close the connection
+  handle->response_sent   = true;
+  handle->rem_resp_length = remaining;
+
+  do {
+    if ((remaining > 0) && (length < (uint32_t)segment_size)) {
+      uint32_t read_length = (uint32_t)segment_size - length;
+      if (read_length > remaining) {
+        read_length = remaining;
+      }
+      if (lfs_file_read(static_file_config.file_system, file, &static_file_chunk[length], read_length)
+          != (lfs_ssize_t)read_length) {
+        SL_DEBUG_LOG("\r\nStatic file read failed\r\n");
+        return SL_STATUS_FAIL;
+      }
+      length += read_length;
+      remaining -= read_length;
+    }
+
+    if (sli_send_chunk(handle->client_socket, static_file_chunk, length, (uint32_t)segment_size) != 0) {
+      SL_DEBUG_LOG("\r\nStatic file send failed with bsd error: %d\r\n", errno);
+      return SL_STATUS_FAIL;
+    }
+    handle->rem_resp_length = remaining;
+    length                  = 0;
+  } while (remaining > 0);
+
+  return SL_STATUS_OK;
+}
+
+static sl_status_t sli_send_error(sl_http_server_t *handle,
+                                  sl_http_response_code_t response_code,
+                                  sl_http_header_t *headers,
+                                  uint16_t header_count)
+{
+  sl_http_server_response_t response = { 0 };
+
+  response.response_code = response_code;
+  response.headers       = headers;
+  response.header_count  = header_count;
+  return sl_http_server_send_response(handle, &response);
+}
+
+/******************************************************
+ *               Function Definitions APIs
+ ******************************************************/
+sl_status_t sl_http_server_static_file_init(const sl_http_server_static_file_config_t *config)
+{
+  if ((NULL == config) || (NULL == config->file_system)) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  static_file_config = *config;
+  sl_http_server_static_file_invalidate_cache();
+
+  return SL_STATUS_OK;
+}
+
+void sl_http_server_static_file_invalidate_cache(void)
+{
+  memset(static_file_cache, 0, sizeof(static_file_cache));
+  static_file_cache_clock = 0;
+}
+
+sl_status_t sl_http_server_static_file_handler(sl_http_server_t *handle, sl_http_server_request_t *request)
+{
+  sl_http_header_t headers[HTTP_STATIC_FILE_MAX_REQUEST_HEADERS] = { 0 };
+  sl_http_header_t allow_header                                  = { .key = "Allow", .value = "GET, HEAD" };
+  sli_http_static_file_entry_t *entry                            = NULL;
+  const char *if_none_match                                      = NULL;
+  const char *if_modified_since                                  = NULL;
+  const char *uri                                                = NULL;
+  bool gzip_accepted                                             = false;
+  bool not_modified                                              = false;
+  bool file_open                                                 = false;
+  bool send_content                                              = false;
+  char path[SL_HTTP_SERVER_STATIC_FILE_MAX_PATH_LENGTH];
+  lfs_file_t file;
+  sl_status_t status;
+
+  if ((NULL == handle) || (NULL == request)) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  uri = request->uri.path;
+  if (NULL == static_file_config.file_system) {
+    return sli_send_error(handle, SL_HTTP_RESPONSE_INTERNAL_SERVER_ERROR, NULL, 0);
+  }
+  if ((SL_HTTP_REQUEST_GET != request->type) && (SL_HTTP_REQUEST_HEAD != request->type)) {
+    return sli_send_error(handle, SL_HTTP_RESPONSE_METHOD_NOT_ALLOWED, &allow_header, 1);
+  }
+  if ((NULL == uri) || ('/' != uri[0])) {
+    return sli_send_error(handle, SL_HTTP_RESPONSE_BAD_REQUEST, NULL, 0);
+  }
+  if (NULL != strstr(uri, "..")) {
+    return sli_send_error(handle, SL_HTTP_RESPONSE_FORBIDDEN, NULL, 0);
+  }
+
+  if (request->request_header_count > 0) {
+    uint16_t header_count = (request->request_header_count < HTTP_STATIC_FILE_MAX_REQUEST_HEADERS)
+                              ? request->request_header_count
+                              : HTTP_STATIC_FILE_MAX_REQUEST_HEADERS;
+    sl_http_server_get_request_headers(handle, request, headers, header_count);
+    for (uint16_t i = 0; (i < header_count) && (NULL != headers[i].key); i++) {
+      if (0 == strcasecmp(headers[i].key, "Accept-Encoding")) {
+        gzip_accepted = sli_accepts_encoding(headers[i].value, "gzip");
+      } else if (0 == strcasecmp(headers[i].key, "If-None-Match")) {
+        if_none_match = headers[i].value;
+      } else if (0 == strcasecmp(headers[i].key, "If-Modified-Since")) {
+        if_modified_since = headers[i].value;
+      }
+    }
+  }
+
+  // A cached entry is checked against the metadata of its file before its validators answer the request, so that
+  // a removed file, or one rewritten with another size or time attribute, is loaded again
+  entry = sli_find_cache_entry(uri, gzip_accepted);
+  if ((NULL != entry) && (SL_STATUS_OK != sli_revalidate_cache_entry(entry, path))) {
+    entry->uri[0] = '\0';
+    entry         = NULL;
+  }
+
+  if (NULL == entry) {
+    status = sli_load_cache_entry(uri, gzip_accepted, &file, &entry);
+    if (SL_STATUS_NOT_FOUND == status) {
+      return sli_send_error(handle, SL_HTTP_RESPONSE_NOT_FOUND, NULL, 0);
+    } else if (SL_STATUS_OK != status) {
+      return sli_send_error(handle, SL_HTTP_RESPONSE_INTERNAL_SERVER_ERROR, NULL, 0);
+    }
+    file_open = true;
+  }
+  entry->last_used = ++static_file_cache_clock;
+
+  not_modified = sli_is_not_modified(entry, if_none_match, if_modified_since);
+  send_content = !not_modified && (SL_HTTP_REQUEST_GET == request->type);
+
+  // A cached file is only opened to stream its content
+  if (send_content && !file_open) {
+    if (lfs_file_open(static_file_config.file_system, &file, path, LFS_O_RDONLY) < 0) {
+      entry->uri[0] = '\0';
+      return sli_send_error(handle, SL_HTTP_RESPONSE_NOT_FOUND, NULL, 0);
+    }
+    file_open = true;
+  }
+
+  status = sli_send_file(handle, entry, not_modified ? "304 Not Modified" : "200 OK", send_content ? &file : NULL);
+
+  if (file_open) {
+    lfs_file_close(static_file_config.file_system, &file);
+  }
+  return status;
+}
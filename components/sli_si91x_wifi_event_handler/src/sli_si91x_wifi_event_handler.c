@@ -37,6 +37,7 @@
 #include "cmsis_os2.h"
 #include "cmsis_compiler.h"
 #include "sl_si91x_core_utilities.h"
+#include "sl_si91x_command_trace.h"
 #include <string.h>
 #ifdef SL_NET_COMPONENT_INCLUDED
 #include "sl_net_types.h"
@@ -286,6 +287,10 @@ static sl_status_t bus_write_frame(sli_si91x_command_queue_t *queue,
     if (SI91X_PACKET_WITH_ASYNC_RESPONSE != (node->flags & SI91X_PACKET_WITH_ASYNC_RESPONSE)) {
       // Update trace information with packet details
       // If the packet doesn't have an async response, mark the command as in flight
+      if (SI91X_PACKET_TIMEOUT_FROM_SEND & node->flags) {
+        // The command may have waited behind others of its kind; its timeout starts now
+        node->command_tickcount = osKernelGetTickCount();
+      }
       queue->command_in_flight = true;
       queue->packet_id         = node->host_packet->id;
       queue->firmware_queue_id = node->firmware_queue_id;
@@ -294,6 +299,7 @@ static sl_status_t bus_write_frame(sli_si91x_command_queue_t *queue,
       queue->command_timeout   = node->command_timeout;
       queue->command_tickcount = node->command_tickcount;
       queue->sdk_context       = node->sdk_context;
+      sli_si91x_command_window_push(queue);
     }
   }
 #ifdef SLI_SI91X_MCU_INTERFACE
@@ -305,7 +311,9 @@ static sl_status_t bus_write_frame(sli_si91x_command_queue_t *queue,
   sli_si91x_update_tx_command_status(true);
 #endif
   // Write the frame to the bus using packet data and length
+  SLI_SI91X_COMMAND_TRACE(SL_SI91X_COMMAND_TRACE_BUS_START, command_type, node->host_packet->id, packet->command);
   status = sli_si91x_bus_write_frame(packet, packet->data, length);
+  SLI_SI91X_COMMAND_TRACE(SL_SI91X_COMMAND_TRACE_BUS_DONE, command_type, node->host_packet->id, packet->command);
 
 #ifdef SLI_SI91X_MCU_INTERFACE
   if (packet->desc[2] == SLI_COMMON_REQ_SOFT_RESET) {
@@ -330,7 +338,7 @@ static sl_status_t bus_write_frame(sli_si91x_command_queue_t *queue,
   }
 
 #ifdef SLI_SI91X_ENABLE_BLE
-  if (command_type == SLI_SI91X_BT_CMD) {
+  if ((command_type == SLI_SI91X_BT_CMD) && !(SI91X_PACKET_NO_TX_DONE_NOTIFY & node->flags)) {
     rsi_bt_common_tx_done(packet);
   }
 #endif
@@ -372,7 +380,9 @@ static sl_status_t bus_write_data_frame(sli_si91x_buffer_queue_t *queue)
 #endif
 
   // Write the frame to the bus using packet data and length
+  SLI_SI91X_COMMAND_TRACE(SL_SI91X_COMMAND_TRACE_DATA_TX_START, SI91X_CMD_MAX, 0, packet->command);
   status = sli_si91x_bus_write_frame(packet, packet->data, length);
+  SLI_SI91X_COMMAND_TRACE(SL_SI91X_COMMAND_TRACE_DATA_TX_DONE, SI91X_CMD_MAX, 0, packet->command);
 
   // Handle errors during frame writing
   if (status != SL_STATUS_OK) {
@@ -390,6 +400,9 @@ static sl_status_t bus_write_data_frame(sli_si91x_buffer_queue_t *queue)
     sl_si91x_host_clear_sleep_indicator();
   }
 
+  // Complete asynchronous raw data frames before the buffer is released
+  sli_si91x_raw_data_frame_sent(buffer, status);
+
   sli_si91x_host_free_buffer(buffer);
   return SL_STATUS_OK;
 }
@@ -566,6 +579,7 @@ static inline void sli_si91x_wifi_handle_rx_events(uint32_t *event)
   uint8_t queue_id                                            = 0;
   uint16_t frame_type                                         = 0;
   uint16_t frame_status                                       = 0;
+  int8_t in_flight_index[SI91X_CMD_MAX];
 
   // Check if there is an RX packet pending or bus RX event is set
   if ((*event & SL_SI91X_NCP_HOST_BUS_RX_EVENT)
@@ -595,6 +609,12 @@ static inline void sli_si91x_wifi_handle_rx_events(uint32_t *event)
     queue_id     = ((data[1] & 0xF0) >> 4);                // Extract the queue ID
     frame_type   = (uint16_t)(data[2] + (data[3] << 8));   // Extract the frame type
     frame_status = (uint16_t)(data[12] + (data[13] << 8)); // Extract the frame status
+    SLI_SI91X_COMMAND_TRACE(SL_SI91X_COMMAND_TRACE_RESPONSE, SLI_SI91X_COMMAND_TRACE_ANY_QUEUE, 0, frame_type);
+
+    // With several commands in flight, make the one this frame answers the current command of its queue
+    for (uint8_t i = 0; i < SI91X_CMD_MAX; i++) {
+      in_flight_index[i] = sli_si91x_command_window_select(&cmd_queues[i], frame_type);
+    }
 #ifdef SLI_SI91X_MCU_INTERFACE
     if ((frame_type == SLI_COMMON_RSP_TA_M4_COMMANDS) || (frame_type == SLI_WLAN_REQ_SET_CERTIFICATE)
         || (frame_type == SLI_COMMON_RSP_SOFT_RESET)) {
@@ -1417,6 +1437,7 @@ static inline void sli_si91x_wifi_handle_rx_events(uint32_t *event)
             }
             socket->command_queue.command_tickcount = 0;
             socket->command_queue.command_timeout   = 0;
+            sli_si91x_socket_poll_notify(socket->index, SL_SI91X_SOCKET_POLL_READ);
           }
 #elif defined(SLI_SI91X_NETWORK_DUAL_STACK)
           extern bool bypass_mode_enabled;
@@ -1451,6 +1472,7 @@ static inline void sli_si91x_wifi_handle_rx_events(uint32_t *event)
               }
               socket->command_queue.command_tickcount = 0;
               socket->command_queue.command_timeout   = 0;
+              sli_si91x_socket_poll_notify(socket->index, SL_SI91X_SOCKET_POLL_READ);
             }
           } else {
             // If SLI_SI91X_OFFLOAD_NETWORK_STACK is defined and dual stack mode is enabled, process the raw data frame.
@@ -1508,6 +1530,10 @@ static inline void sli_si91x_wifi_handle_rx_events(uint32_t *event)
         break;
       }
     }
+
+    for (uint8_t i = 0; i < SI91X_CMD_MAX; i++) {
+      sli_si91x_command_window_retire(&cmd_queues[i], in_flight_index[i]);
+    }
     sli_submit_rx_buffer();
   } else {
     *event &= ~SL_SI91X_NCP_HOST_BUS_RX_EVENT; // Reset the event flag
@@ -1524,7 +1550,7 @@ static inline void sli_si91x_wifi_handle_tx_event(uint32_t *event)
       if (!(*event & (SL_SI91X_TX_PENDING_FLAG(i)))) {
         continue;
       }
-      if (cmd_queues[i].command_in_flight == true) {
+      if (sli_si91x_command_window_is_full(&cmd_queues[i])) {
         tx_command_queues_command_in_flight_status |= SL_SI91X_TX_PENDING_FLAG(i);
         continue;
       } else {
@@ -1591,6 +1617,7 @@ static inline void sli_si91x_wifi_handle_tx_event(uint32_t *event)
         sl_status_t status = bus_write_data_frame(&sli_si91x_sockets[i]->tx_data_queue);
         if (status == SL_STATUS_OK) {
           --sli_si91x_sockets[i]->data_buffer_count;
+          sli_si91x_socket_poll_notify(i, SL_SI91X_SOCKET_POLL_WRITE);
         }
         if (sli_si91x_buffer_queue_empty(&sli_si91x_sockets[i]->tx_data_queue)) {
           tx_socket_data_queues_status &= ~(1 << i);
@@ -1625,9 +1652,10 @@ void sli_wifi_event_handler_init(void)
 {
   // Array to track the status of commands in flight
 
-  cmd_queues[SI91X_COMMON_CMD].sequential      = true;
-  cmd_queues[SLI_SI91X_WLAN_CMD].sequential    = true;
-  cmd_queues[SLI_SI91X_NETWORK_CMD].sequential = true;
+  // Common, WLAN and network commands may overlap when the command window allows it
+  cmd_queues[SI91X_COMMON_CMD].sequential      = (SL_SI91X_COMMAND_QUEUE_WINDOW <= 1);
+  cmd_queues[SLI_SI91X_WLAN_CMD].sequential    = (SL_SI91X_COMMAND_QUEUE_WINDOW <= 1);
+  cmd_queues[SLI_SI91X_NETWORK_CMD].sequential = (SL_SI91X_COMMAND_QUEUE_WINDOW <= 1);
   cmd_queues[SLI_SI91X_BT_CMD].sequential      = true;
   cmd_queues[SLI_SI91X_SOCKET_CMD].sequential  = true;
 }
@@ -38,6 +38,7 @@
 #include "tempSensor_hal.h"
 #include "apds9960Sensor_hal.h"
 #include "accelerometerSensor_hal.h"
+#include "icm40627Sensor_hal.h"
 #include "adc_sensor_hal.h"
 #include "sl_si91x_sdc.h"
 
@@ -0,0 +1,119 @@
+/***************************************************************************/ /**
+ * @file icm40627Sensor_hal.h
+ * @brief ICM40627SENSOR_HAL API implementation
+ * @brief ACCELEROMETERSENSOR_HAL API implementation
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef ICM40627SENSOR_HAL_H_
+#define ICM40627SENSOR_HAL_H_
+#include "sensor_type.h"
+
+/*******************************************************************************
+ ****************** ICM40627 IMU sensor Typedefs/ Defines  *********************
+ ******************************************************************************/
+typedef int32_t sl_icm40627_error_t;
+typedef void *sl_sensor_icm40627_handle_t; /*!< ICM40627 sensor handle*/
+
+#ifndef SL_SH_ICM40627_ODR_HZ
+#define SL_SH_ICM40627_ODR_HZ 1000 ///< Sensor output data rate, 25 Hz to 8000 Hz
+#endif
+#ifndef SL_SH_ICM40627_FIFO_WATERMARK
+#define SL_SH_ICM40627_FIFO_WATERMARK 16 ///< Samples in the sensor FIFO that raise its interrupt
+#endif
+#ifndef SL_SH_ICM40627_MAX_BATCH
+#define SL_SH_ICM40627_MAX_BATCH 32 ///< Max samples read from the sensor FIFO per sample call
+#endif
+
+#ifdef SH_ICM40627_ENABLE
+#include "sl_si91x_icm40627.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+* @fn       sl_sensor_icm40627_handle_t sl_si91x_icm40627_sensor_create
+*                                (sl_sensor_bus_t bus, int id)
+* @brief   Create an ICM40627 IMU sensor instance and start streaming its
+*          samples to the sensor FIFO. Only one instance can be created.
+* @param   bus SPI bus the sensor is attached to
+* @param   id declared in sl_imu_sensor_id_t
+* @return  sl_sensor_icm40627_handle_t returns ICM40627 sensor handle if
+*          succeed, return NULL if failed.
+*******************************************************************************/
+sl_sensor_icm40627_handle_t sl_si91x_icm40627_sensor_create(sl_sensor_bus_t bus, int id);
+
+/*******************************************************************************
+ * @fn      sl_icm40627_error_t sl_si91x_icm40627_sensor_delete
+ *                                    (sl_sensor_icm40627_handle_t *sensor)
+ * @brief   Stops streaming, deletes and release the sensor resource.
+ * @param   sensor point to ICM40627 sensor handle, will set to NULL if delete
+ *          succeed.
+ * @return  sl_icm40627_error_t
+ *          - RSI_OK Success
+ *          - RSI_FAIL Fail
+ ******************************************************************************/
+sl_icm40627_error_t sl_si91x_icm40627_sensor_delete(sl_sensor_icm40627_handle_t *sensor);
+
+/*******************************************************************************
+ * @fn      sl_icm40627_error_t sl_si91x_icm40627_sensor_sample
+ *          (sl_sensor_icm40627_handle_t sensor,
+ *                                           sl_sensor_data_group_t *data_group)
+ * @brief   Sample a group of sensor data. Reads up to data_group->max_number
+ *          samples (one if it is 0) from the sensor FIFO in one SPI burst.
+ * @param   sensor ICM40627 sensor handle to operate
+ * @param   data_group sampled data.
+ * @return  sl_icm40627_error_t
+ *          - RSI_OK Success
+ *          - RSI_FAIL Fail
+ ******************************************************************************/
+sl_icm40627_error_t sl_si91x_icm40627_sensor_sample(sl_sensor_icm40627_handle_t sensor,
+                                                    sl_sensor_data_group_t *data_group);
+
+/*******************************************************************************
+ * @fn      sl_icm40627_error_t sl_si91x_icm40627_sensor_control
+ *          (sl_sensor_icm40627_handle_t sensor, sl_sensor_command_t cmd,
+                                                                     void *args)
+ * @brief   Control sensor mode with control commands and args
+ * @param   sensor ICM40627 sensor handle to operate
+ * @param   cmd control commands detailed in sensor_command_t
+ * @param   args control commands args
+ * @return  sl_icm40627_error_t
+ *          - RSI_OK Success
+ *          - RSI_FAIL Fail
+ ******************************************************************************/
+sl_icm40627_error_t sl_si91x_icm40627_sensor_control(sl_sensor_icm40627_handle_t sensor,
+                                                     sl_sensor_command_t cmd,
+                                                     void *args);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ICM40627SENSOR_HAL_H_ */
@@ -91,6 +91,17 @@ typedef struct {
 #define SL_ADC_GY61_T sl_adc_gy61_t
 #endif
 
+//Sensor IMU data, sampled in batches from the sensor FIFO
+#ifndef SL_IMU_T
+typedef struct {
+  SL_AXIS_T accelerometer; ///< Accelerometer       unit: G
+  SL_AXIS_T gyroscope;     ///< Gyroscope           unit: deg/sec
+  float temperature;       ///< Temperature         unit: Celsius
+  uint32_t timestamp_us;   ///< Sampling time       unit: us (sensor clock)
+} sl_imu_t;
+#define SL_IMU_T sl_imu_t
+#endif
+
 //Sensor operations
 typedef enum {
   SL_COMMAND_SET_MODE,
@@ -126,6 +137,9 @@ typedef struct {
 
 #ifdef SH_SDC_ENABLE
     int16_t sh_sdc_data[16];
+#endif
+#ifdef SH_ICM40627_ENABLE
+    SL_IMU_T imu; ///< IMU                 unit: sl_imu_t
 #endif
   };
 } sl_sensor_data_t;
@@ -133,6 +147,7 @@ typedef struct {
 //Sensor data group structure
 typedef struct {
   uint8_t number;                ///< effective data number
+  uint8_t max_number;            ///< room in the data buffer for one sample call, 0 if not given (one sample)
   sl_sensor_data_t *sensor_data; ///< data buffer
 } sl_sensor_data_group_t;
 
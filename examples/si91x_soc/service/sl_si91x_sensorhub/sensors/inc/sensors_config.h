@@ -39,6 +39,9 @@
 #define SL_CONFIG_SENSOR_APDS9960
 #define SL_CONFIG_SENSOR_ADXL345
 #define SL_CONFIG_SENSOR_ADC
+#ifdef SH_ICM40627_ENABLE
+#define SL_CONFIG_SENSOR_ICM40627
+#endif
 
 #define SL_SENSOR_ID_MASK            0XF0
 #define SL_SENSOR_ID_OFFSET          4
@@ -85,6 +88,12 @@ typedef enum {
   SL_ACCELEROMETER_MAX_ID, /*!< max accelerometer sensor id*/
 } sl_accelerometer_sensor_id_t;
 
+// IMU sensor ids
+typedef enum {
+  SL_ICM40627_ID = 0x01, /*!< ICM40627 6-axis IMU sensor id*/
+  SL_IMU_MAX_ID,         /*!< max IMU sensor id*/
+} sl_imu_sensor_id_t;
+
 // ADC sensor ids
 typedef enum {
   SL_ADC_JOYSTICK_ID = 0x00, /*!< adc joystick id*/
@@ -107,6 +116,9 @@ typedef enum {
 #endif
 #ifdef SL_CONFIG_SENSOR_ADXL345
   SL_SENSOR_ADXL345_ID = (SL_ACCELEROMETER_SENSOR_ID << SL_SENSOR_ID_OFFSET) | SL_ADXL345_ID, ///< ADXL345 sensor id
+#endif
+#ifdef SL_CONFIG_SENSOR_ICM40627
+  SL_SENSOR_ICM40627_ID = (SL_IMU_ID << SL_SENSOR_ID_OFFSET) | SL_ICM40627_ID, ///< ICM40627 sensor id
 #endif
   SL_GPIO_SENSE_GPIO_ID   = (SL_GPIO_SENSOR_ID << SL_SENSOR_ID_OFFSET) | SL_SH_GPIO_1, ///< GPIOs id
   SL_GPIO_SENSE_BUTTON_ID = (SL_GPIO_SENSOR_ID << SL_SENSOR_ID_OFFSET) | SL_SH_GPIO_0, ///< Button id
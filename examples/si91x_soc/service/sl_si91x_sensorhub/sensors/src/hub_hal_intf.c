@@ -97,6 +97,15 @@ sl_sensor_impl_type_t sensor_impls[] = {
     .sample  = sl_si91x_accelerometer_sensor_sample,
     .control = sl_si91x_accelerometer_sensor_control,
   },
+#endif
+#ifdef SL_CONFIG_SENSOR_ICM40627 //ICM40627 sensor operations
+  {
+    .type    = SL_IMU_ID,
+    .create  = sl_si91x_icm40627_sensor_create,
+    .delete  = sl_si91x_icm40627_sensor_delete,
+    .sample  = sl_si91x_icm40627_sensor_sample,
+    .control = sl_si91x_icm40627_sensor_control,
+  },
 #endif
   {
     //GPIO sensor operations
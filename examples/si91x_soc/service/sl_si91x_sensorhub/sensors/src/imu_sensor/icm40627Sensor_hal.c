@@ -0,0 +1,214 @@
+/***************************************************************************/ /**
+ * @file icm40627Sensor_hal.c
+ * @brief ICM40627SENSOR_HAL API implementation
+ * @brief ACCELEROMETERSENSOR_HAL API implementation
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+/**=============================================================================
+ * @brief : This file contains the ICM40627 IMU HAL file for Sensor Hub
+ * application
+ * The sensor streams its samples to its FIFO, and each sample call reads a
+ * batch of them in one SPI burst. Use it with a sensor hub ring buffer
+ * (sl_si91x_sensorhub_configure_ring_buffer) to get the batches delivered.
+ ============================================================================**/
+#include <stdio.h>
+#include "rsi_debug.h"
+#include "sensor_hub.h"
+#include "sensor_type.h"
+
+#ifdef SH_ICM40627_ENABLE
+/*******************************************************************************
+ ******************** ICM40627 Sensor Information structure ********************
+ ******************************************************************************/
+typedef struct {
+  sl_imu_sensor_id_t id;
+  sl_ssi_handle_t ssi_handle;
+  float accel_res;
+  float gyro_res;
+  sl_icm40627_fifo_stream_t stream;
+} sl_sensor_icm40627_t;
+
+extern ARM_DRIVER_SPI *SPIdrv; //ULP SSI driver, initialized by the sensor hub
+
+static sl_sensor_icm40627_t *icm40627_sensor;
+static uint8_t icm40627_fifo_buffer[1 + (SL_SH_ICM40627_MAX_BATCH * SL_ICM40627_FIFO_PACKET_SIZE)];
+static sl_icm40627_fifo_frame_t icm40627_frames[SL_SH_ICM40627_MAX_BATCH];
+
+/*******************************************************************************
+* @fn       sl_sensor_icm40627_handle_t sl_si91x_icm40627_sensor_create
+*                                (sl_sensor_bus_t bus, int id)
+* @brief   Create an ICM40627 IMU sensor instance and start streaming its
+*          samples to the sensor FIFO. Only one instance can be created.
+* @param   bus SPI bus the sensor is attached to
+* @param   id declared in sl_imu_sensor_id_t
+* @return  sl_sensor_icm40627_handle_t returns ICM40627 sensor handle if
+*          succeed, return NULL if failed.
+*******************************************************************************/
+sl_sensor_icm40627_handle_t sl_si91x_icm40627_sensor_create(sl_sensor_bus_t bus, int id)
+{
+  sl_status_t status;
+
+  if ((bus != SL_SH_SPI) || (id != SL_ICM40627_ID) || (icm40627_sensor != NULL)) {
+    DEBUGOUT("no driver founded, IMU ID = %d", id);
+    return NULL;
+  }
+  sl_sensor_icm40627_t *p_sensor = (sl_sensor_icm40627_t *)pvPortMalloc(sizeof(sl_sensor_icm40627_t));
+  if (p_sensor == NULL) {
+    DEBUGOUT("\r\n ICM40627 sensor create failed:%u \r\n", sizeof(sl_sensor_icm40627_t));
+    return NULL;
+  }
+  p_sensor->id                 = id;
+  p_sensor->ssi_handle         = SPIdrv;
+  p_sensor->stream.buffer      = icm40627_fifo_buffer;
+  p_sensor->stream.buffer_size = sizeof(icm40627_fifo_buffer);
+
+  status = sl_si91x_icm40627_init(p_sensor->ssi_handle);
+  if (status == SL_STATUS_OK) {
+    sl_si91x_icm40627_set_sample_rate(p_sensor->ssi_handle, SL_SH_ICM40627_ODR_HZ);
+    status = sl_si91x_icm40627_get_accel_resolution(p_sensor->ssi_handle, &p_sensor->accel_res);
+  }
+  if (status == SL_STATUS_OK) {
+    status = sl_si91x_icm40627_get_gyro_resolution(p_sensor->ssi_handle, &p_sensor->gyro_res);
+  }
+  if (status == SL_STATUS_OK) {
+    status =
+      sl_si91x_icm40627_fifo_stream_start(p_sensor->ssi_handle, &p_sensor->stream, SL_SH_ICM40627_FIFO_WATERMARK);
+  }
+  if (status != SL_STATUS_OK) {
+    vPortFree(p_sensor);
+    DEBUGOUT("ICM40627 sensor init failed:%lu", status);
+    return NULL;
+  }
+  icm40627_sensor = p_sensor;
+  return (sl_sensor_icm40627_handle_t)p_sensor;
+}
+
+/*******************************************************************************
+ * @fn      sl_icm40627_error_t sl_si91x_icm40627_sensor_delete
+ *                                    (sl_sensor_icm40627_handle_t *sensor)
+ * @brief   Stops streaming, deletes and release the sensor resource.
+ * @param   sensor point to ICM40627 sensor handle, will set to NULL if delete
+ *          succeed.
+ * @return  sl_icm40627_error_t
+ *          - RSI_OK Success
+ *          - RSI_FAIL Fail
+ ******************************************************************************/
+sl_icm40627_error_t sl_si91x_icm40627_sensor_delete(sl_sensor_icm40627_handle_t *sensor)
+{
+  if (sensor == NULL || *sensor == NULL) {
+    return RSI_FAIL;
+  }
+  sl_sensor_icm40627_t *p_sensor = (sl_sensor_icm40627_t *)(*sensor);
+
+  if (sl_si91x_icm40627_fifo_stream_stop(p_sensor->ssi_handle) != SL_STATUS_OK) {
+    return RSI_FAIL;
+  }
+  sl_si91x_icm40627_enable_sensor(p_sensor->ssi_handle, false, false, false);
+
+  icm40627_sensor = NULL;
+  vPortFree(p_sensor);
+  *sensor = NULL;
+  return RSI_OK;
+}
+
+/*******************************************************************************
+ * @fn      sl_icm40627_error_t sl_si91x_icm40627_sensor_sample
+ *          (sl_sensor_icm40627_handle_t sensor,
+ *                                           sl_sensor_data_group_t *data_group)
+ * @brief   Sample a group of sensor data. Reads up to data_group->max_number
+ *          samples (one if it is 0) from the sensor FIFO in one SPI burst.
+ * @param   sensor ICM40627 sensor handle to operate
+ * @param   data_group sampled data.
+ * @return  sl_icm40627_error_t
+ *          - RSI_OK Success
+ *          - RSI_FAIL Fail
+ ******************************************************************************/
+sl_icm40627_error_t sl_si91x_icm40627_sensor_sample(sl_sensor_icm40627_handle_t sensor,
+                                                    sl_sensor_data_group_t *data_group)
+{
+  sl_sensor_icm40627_t *p_sensor = (sl_sensor_icm40627_t *)(sensor);
+  const sl_icm40627_fifo_frame_t *frame;
+  sl_imu_t *imu;
+  uint16_t max_frames;
+  uint16_t frame_count = 0;
+
+  if (sensor == NULL || data_group == NULL) {
+    return RSI_FAIL;
+  }
+
+  max_frames = (data_group->max_number != 0) ? data_group->max_number : 1;
+  if (max_frames > SL_SH_ICM40627_MAX_BATCH) {
+    max_frames = SL_SH_ICM40627_MAX_BATCH;
+  }
+  if (sl_si91x_icm40627_fifo_read_frames(p_sensor->ssi_handle,
+                                         &p_sensor->stream,
+                                         icm40627_frames,
+                                         max_frames,
+                                         &frame_count)
+      != SL_STATUS_OK) {
+    return RSI_FAIL;
+  }
+
+  for (uint16_t i = 0; i < frame_count; i++) {
+    frame                = &icm40627_frames[i];
+    imu                  = &data_group->sensor_data[data_group->number].imu;
+    imu->accelerometer.x = (float)frame->accel[0] * p_sensor->accel_res;
+    imu->accelerometer.y = (float)frame->accel[1] * p_sensor->accel_res;
+    imu->accelerometer.z = (float)frame->accel[2] * p_sensor->accel_res;
+    imu->gyroscope.x     = (float)frame->gyro[0] * p_sensor->gyro_res;
+    imu->gyroscope.y     = (float)frame->gyro[1] * p_sensor->gyro_res;
+    imu->gyroscope.z     = (float)frame->gyro[2] * p_sensor->gyro_res;
+    imu->temperature     = ((float)frame->temperature / 2.07f) + 25.0f;
+    imu->timestamp_us    = (uint32_t)frame->timestamp_us;
+    data_group->number++;
+  }
+  return RSI_OK;
+}
+
+/*******************************************************************************
+ * @fn      sl_icm40627_error_t sl_si91x_icm40627_sensor_control
+ *          (sl_sensor_icm40627_handle_t sensor, sl_sensor_command_t cmd,
+                                                                     void *args)
+ * @brief   Control sensor mode with control commands and args
+ * @param   sensor ICM40627 sensor handle to operate
+ * @param   cmd control commands detailed in sensor_command_t
+ * @param   args control commands args
+ * @return  sl_icm40627_error_t
+ *          - RSI_OK Success
+ *          - RSI_FAIL Fail
+ ******************************************************************************/
+sl_icm40627_error_t sl_si91x_icm40627_sensor_control(sl_sensor_icm40627_handle_t sensor,
+                                                     sl_sensor_command_t cmd,
+                                                     void *args)
+{
+  (void)args;
+  if (sensor == NULL || cmd == 0) {
+    return RSI_FAIL;
+  }
+  return RSI_OK;
+}
+#endif /* SH_ICM40627_ENABLE */
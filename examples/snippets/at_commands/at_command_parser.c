@@ -83,7 +83,39 @@ sl_status_t console_parse_at_command(char *command_line,
                                      console_args_t *args,
                                      const console_descriptive_command_t **output_command);
 
-// Simple linear database search. This function could be replaced with a more complicated version
+// Find the entry whose key equals token, ignoring case. Sorted databases use a binary search, others a linear scan
+static const console_database_entry_t *at_command_lookup_entry(const console_database_t *db,
+                                                               const char *token,
+                                                               uint32_t *index)
+{
+  if (db->flags & CONSOLE_DATABASE_SORTED_NOCASE) {
+    uint32_t low  = 0;
+    uint32_t high = db->length;
+
+    while (low < high) {
+      uint32_t middle = low + ((high - low) / 2);
+      int result      = strcasecmp(token, db->entries[middle].key);
+      if (result == 0) {
+        *index = middle;
+        return &(db->entries[middle]);
+      } else if (result < 0) {
+        high = middle;
+      } else {
+        low = middle + 1;
+      }
+    }
+    return NULL;
+  }
+
+  for (uint32_t i = 0; i < db->length; i++) {
+    if (strcasecmp(token, db->entries[i].key) == 0) {
+      *index = i;
+      return &(db->entries[i]);
+    }
+  }
+  return NULL;
+}
+
 sl_status_t console_find_at_command(char **string,
                                     const char *string_end,
                                     const console_database_t *db,
@@ -109,20 +141,7 @@ sl_status_t console_find_at_command(char **string,
     if (status != SL_STATUS_OK)
       return SL_STATUS_FAIL;
 
-    size_t token_length = strlen(token);
-
-    for (uint32_t i = 0; i < db->length; i++) {
-      if (strncasecmp(token, db->entries[i].key, token_length) == 0 && db->entries[i].key[token_length] == 0) {
-        *entry          = &(db->entries[i]);
-        *starting_index = i;
-
-        if (strlen(db->entries[i].key) == token_length) {
-          break;
-        } else {
-          return SL_STATUS_COMMAND_INCOMPLETE;
-        }
-      }
-    }
+    *entry = at_command_lookup_entry(db, token, starting_index);
     if (*entry == NULL) {
       return SL_STATUS_FAIL;
     }
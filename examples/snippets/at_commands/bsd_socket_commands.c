@@ -46,12 +46,27 @@ int errno;
 #include "sl_si91x_socket.h"
 #include "sl_si91x_socket_utility.h"
 #include "at_utility.h"
+#include "cmsis_os2.h"
 
 /******************************************************
  *                    Macros
  ******************************************************/
 #define UDP_MAX_RECEIVE_DATA_LENGTH 1470
 #define TCP_MAX_RECEIVE_DATA_LENGTH 1460
+
+// Binary data mode framing. Each frame starts with a little-endian 16-bit length word. Bit 15 set
+// requests up to (length & AT_DATA_MODE_LENGTH_MASK) bytes from recv(), otherwise the payload follows
+// and is passed to send(). A zero length word leaves data mode.
+#define AT_DATA_MODE_MAX_FRAME_LENGTH UDP_MAX_RECEIVE_DATA_LENGTH
+#define AT_DATA_MODE_RECEIVE_REQUEST  0x8000
+#define AT_DATA_MODE_LENGTH_MASK      0x7FFF
+#define AT_DATA_MODE_CRC_LENGTH       2
+#define AT_DATA_MODE_CRC_INITIAL      0xFFFF
+
+#ifndef AT_DATA_MODE_IDLE_TIMEOUT_MS
+#define AT_DATA_MODE_IDLE_TIMEOUT_MS 10000
+#endif
+
 #define VERIFY_BSD_STATUS(status) \
   do {                            \
     if (status < 0) {             \
@@ -60,11 +75,31 @@ int errno;
     }                             \
   } while (0)
 
+/******************************************************
+ *                   Enumerations
+ ******************************************************/
+
+// Status byte at the start of every data mode response
+typedef enum {
+  AT_DATA_MODE_STATUS_OK             = 0,
+  AT_DATA_MODE_STATUS_CRC_ERROR      = 1,
+  AT_DATA_MODE_STATUS_SOCKET_ERROR   = 2,
+  AT_DATA_MODE_STATUS_INVALID_LENGTH = 3,
+  AT_DATA_MODE_STATUS_OVERFLOW       = 4,
+} at_data_mode_status_t;
+
 /******************************************************
  *               Static Function Declarations
  ******************************************************/
 
 static inline void print_errno(void);
+static uint16_t at_data_mode_crc16(uint16_t crc, const uint8_t *data, uint32_t length);
+static sl_status_t at_data_mode_read(uint8_t *buffer, uint32_t length);
+static void at_data_mode_respond(at_data_mode_status_t status,
+                                 uint16_t length,
+                                 const uint8_t *payload,
+                                 uint16_t payload_length,
+                                 bool crc_enable);
 
 /******************************************************
  *               Extern Functions
@@ -76,6 +111,8 @@ uint8_t nfds = 0;
 
 static uint8_t remote_terminate_flag        = 0;
 static uint8_t skip_remote_terminate_prints = 0;
+// stdout is the data mode stream, so nothing else may be printed while it is active
+static volatile uint8_t data_mode_active = 0;
 
 /******************************************************
  *               Function Definitions
@@ -86,6 +123,9 @@ void remote_terminate(int socket_id, uint16_t port_number, uint32_t bytes_sent)
   if (skip_remote_terminate_prints) {
     remote_terminate_flag        = 1;
     skip_remote_terminate_prints = 0;
+  } else if (data_mode_active) {
+    // Reported through the socket error status of the next frame instead
+    remote_terminate_flag = 1;
   } else {
     printf("Remote Terminate on socket %d, port %d , bytes_sent %ld\r\n", socket_id, port_number, bytes_sent);
   }
@@ -523,6 +563,134 @@ static inline void print_errno(void)
   SL_DEBUG_LOG("errno %d", errno);
 }
 
+// CRC-16/CCITT-FALSE
+static uint16_t at_data_mode_crc16(uint16_t crc, const uint8_t *data, uint32_t length)
+{
+  for (uint32_t i = 0; i < length; i++) {
+    crc ^= (uint16_t)(data[i] << 8);
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+    }
+  }
+  return crc;
+}
+
+// Reads exactly length raw bytes from the UART receive cache, bypassing the line handler
+static sl_status_t at_data_mode_read(uint8_t *buffer, uint32_t length)
+{
+  uint32_t received = 0;
+  uint32_t idle_ms  = 0;
+
+  while (received < length) {
+    uint32_t count = console_read_data_from_cache((char *)&buffer[received], length - received);
+    if (console_check_and_clear_rx_overflow()) {
+      return SL_STATUS_WOULD_OVERFLOW;
+    }
+    if (count == 0) {
+      if (idle_ms++ >= AT_DATA_MODE_IDLE_TIMEOUT_MS) {
+        return SL_STATUS_TIMEOUT;
+      }
+      osDelay(1);
+      continue;
+    }
+    received += count;
+    idle_ms = 0;
+  }
+  return SL_STATUS_OK;
+}
+
+// Response: status byte, little-endian length word, payload and, if enabled, the CRC of all preceding bytes
+static void at_data_mode_respond(at_data_mode_status_t status,
+                                 uint16_t length,
+                                 const uint8_t *payload,
+                                 uint16_t payload_length,
+                                 bool crc_enable)
+{
+  uint8_t header[3] = { (uint8_t)status, (uint8_t)(length & 0xFF), (uint8_t)(length >> 8) };
+
+  fwrite(header, 1, sizeof(header), stdout);
+  if (payload_length != 0) {
+    fwrite(payload, 1, payload_length, stdout);
+  }
+  if (crc_enable) {
+    uint16_t crc = at_data_mode_crc16(AT_DATA_MODE_CRC_INITIAL, header, sizeof(header));
+    crc          = at_data_mode_crc16(crc, payload, payload_length);
+    uint8_t trailer[AT_DATA_MODE_CRC_LENGTH] = { (uint8_t)(crc & 0xFF), (uint8_t)(crc >> 8) };
+    fwrite(trailer, 1, sizeof(trailer), stdout);
+  }
+  fflush(stdout);
+}
+
+sl_status_t bsd_socket_data_mode_handler(console_args_t *arguments)
+{
+  static uint8_t buffer[AT_DATA_MODE_MAX_FRAME_LENGTH + AT_DATA_MODE_CRC_LENGTH];
+  int32_t sock_fd          = (int32_t)arguments->arg[0];
+  bool crc_enable          = GET_OPTIONAL_COMMAND_ARG(arguments, 1, 0, uint8_t) != 0;
+  uint32_t crc_length      = crc_enable ? AT_DATA_MODE_CRC_LENGTH : 0;
+  uint8_t header[2]        = { 0 };
+  sl_status_t status       = SL_STATUS_OK;
+  at_data_mode_status_t rc = AT_DATA_MODE_STATUS_OK;
+
+  // The host must wait for this before sending the first frame
+  PRINT_AT_CMD_SUCCESS;
+  fflush(stdout);
+  console_check_and_clear_rx_overflow();
+  data_mode_active = 1;
+
+  while (1) {
+    status = at_data_mode_read(header, sizeof(header));
+    if (status != SL_STATUS_OK) {
+      break;
+    }
+
+    uint16_t frame  = (uint16_t)(header[0] | (header[1] << 8));
+    uint16_t length = frame & AT_DATA_MODE_LENGTH_MASK;
+    if (frame == 0) {
+      break;
+    }
+    if (length > AT_DATA_MODE_MAX_FRAME_LENGTH) {
+      // The rest of the stream can't be framed any more, so leave data mode
+      at_data_mode_respond(AT_DATA_MODE_STATUS_INVALID_LENGTH, 0, NULL, 0, crc_enable);
+      status = SL_STATUS_INVALID_PARAMETER;
+      break;
+    }
+
+    uint16_t payload_length = (frame & AT_DATA_MODE_RECEIVE_REQUEST) ? 0 : length;
+    status                  = at_data_mode_read(buffer, payload_length + crc_length);
+    if (status != SL_STATUS_OK) {
+      break;
+    }
+
+    if (crc_enable) {
+      uint16_t crc = at_data_mode_crc16(AT_DATA_MODE_CRC_INITIAL, header, sizeof(header));
+      crc          = at_data_mode_crc16(crc, buffer, payload_length);
+      if (crc != (uint16_t)(buffer[payload_length] | (buffer[payload_length + 1] << 8))) {
+        at_data_mode_respond(AT_DATA_MODE_STATUS_CRC_ERROR, 0, NULL, 0, crc_enable);
+        continue;
+      }
+    }
+
+    if (frame & AT_DATA_MODE_RECEIVE_REQUEST) {
+      int32_t received = recv(sock_fd, buffer, length, 0);
+      rc               = (received < 0) ? AT_DATA_MODE_STATUS_SOCKET_ERROR : AT_DATA_MODE_STATUS_OK;
+      received         = (received < 0) ? 0 : received;
+      at_data_mode_respond(rc, (uint16_t)received, buffer, (uint16_t)received, crc_enable);
+    } else {
+      int32_t sent = send(sock_fd, buffer, length, 0);
+      rc           = (sent < 0) ? AT_DATA_MODE_STATUS_SOCKET_ERROR : AT_DATA_MODE_STATUS_OK;
+      at_data_mode_respond(rc, (uint16_t)((sent < 0) ? 0 : sent), NULL, 0, crc_enable);
+    }
+  }
+
+  if (status == SL_STATUS_WOULD_OVERFLOW) {
+    // Received bytes were dropped, so the framing is lost and data mode has to end
+    at_data_mode_respond(AT_DATA_MODE_STATUS_OVERFLOW, 0, NULL, 0, crc_enable);
+  }
+  data_mode_active = 0;
+
+  return status;
+}
+
 /* Function to get no of set bits in binary
 representation of positive integer n */
 unsigned int countSetBits(unsigned int number)
@@ -115,11 +115,23 @@ BaseType_t xTaskIncrementTick(void);
 extern uint32_t frontend_switch_control;
 sl_status_t sl_si91x_power_manager_sleep(void);
 boolean_t sl_si91x_power_manager_is_ok_to_sleep(void);
+sl_power_state_t sl_si91x_power_manager_get_idle_state(uint32_t expected_idle_us);
 
 #define DEFAULT_TICK_FREQUENCY 32000 // Default frequency
 #define SLEEP_TRANSITION_DELAY 96    // This is the post sleep transition delay
+#define US_PER_SECOND          1000000 // Microseconds per second
 static uint32_t lf_tick_frequency = 0;
 static uint32_t XTAL_SleepStart = 0, XTAL_SleepStop = 0;
+static uint32_t sleep_compensation_lfticks = 0; // Wakeup advance for the sleep transitions, 0 when standing by
+
+/***************************************************************************
+ * Converts os ticks to microseconds, saturated to 32 bits.
+ ******************************************************************************/
+static uint32_t sli_os_ticks_to_us(TickType_t os_ticks)
+{
+  uint64_t us = ((uint64_t)os_ticks * US_PER_SECOND) / configTICK_RATE_HZ;
+  return (us > UINT32_MAX) ? UINT32_MAX : (uint32_t)us;
+}
 /***************************************************************************
  * Sets up sleeptimer timer for constant ticking.
  ******************************************************************************/
@@ -179,6 +191,11 @@ void vPortSuppressTicksAndSleep(TickType_t xExpectedIdleTime)
     // Enable the NVIC interrupts.
     __asm volatile("cpsie i" ::: "memory");
   } else {
+    // The sleeptimer wakes the system up after the expected idle time. If it is shorter than the
+    // break-even time of sleep, the sleep transitions would cost more than they save: standby instead.
+    bool idle_standby = (sl_si91x_power_manager_get_idle_state(sli_os_ticks_to_us(xExpectedIdleTime))
+                         == SL_SI91X_POWER_MANAGER_STANDBY);
+
     // Disable the chip level interrupt
     sleeptimer_hal_disable_int(SLEEPTIMER_EVENT_COMP);
 
@@ -188,7 +205,7 @@ void vPortSuppressTicksAndSleep(TickType_t xExpectedIdleTime)
     XTAL_SleepStart = rsi_sysrtc_get_counter();
     // Bypass clock reconfiguration and Xtal turn off request, when the system is in PS1 or standby state.
     if (sl_si91x_power_manager_get_ps1_state_status() == false
-        && sl_si91x_power_manager_get_standby_state_status() == false) {
+        && sl_si91x_power_manager_get_standby_state_status() == false && !idle_standby) {
       // Switch Subsystems' Ref clocks to MHz RC,Set M4 SOC and QSPI/QSPI2 clock to Ref clock
       sli_si91x_config_clocks_to_mhz_rc();
 
@@ -210,6 +227,9 @@ void vPortSuppressTicksAndSleep(TickType_t xExpectedIdleTime)
     // The calculation below shows the time taken for the XTAL handshake between TA and M4
     XTAL_SleepStop = rsi_sysrtc_get_counter() - XTAL_SleepStart;
 
+    // Standby resumes immediately, only sleep needs to wake up early to absorb its transitions
+    sleep_compensation_lfticks = idle_standby ? 0 : (SLEEP_TRANSITION_DELAY + XTAL_SleepStop);
+
     /* To ensure the new compare value can be updated and prevent unwanted immediate interrupts,
     the SYSRTC compare value is temporarily set to its maximum value before updating the idle sleep time.
     This guarantees that the minimum compare drift condition is satisfied in the sleep timer HAL layer. */
@@ -239,6 +259,9 @@ void vPortSuppressTicksAndSleep(TickType_t xExpectedIdleTime)
 #endif
       // Call the API to enable the standby state.
       sl_si91x_power_manager_standby();
+    } else if (idle_standby && (sl_si91x_power_manager_get_ps1_state_status() == false)) {
+      // Standby until the sleeptimer wakeup, the wakeup sources are not reconfigured.
+      sl_si91x_power_manager_standby();
     } else {
       // Call the API to enable the sleep state.
       sl_si91x_power_manager_sleep();
@@ -320,7 +343,9 @@ static void sli_os_schedule_wakeup(TickType_t os_ticks)
 
   // Before entering sleep, the sleep time is adjusted based on the XTAL handshake and post-sleep delay
   if (is_sleeping) {
-    lf_ticks_to_sleep -= SLEEP_TRANSITION_DELAY + XTAL_SleepStop;
+    // Clamped, a short idle time must not wrap around to a very long sleep
+    lf_ticks_to_sleep =
+      (lf_ticks_to_sleep > sleep_compensation_lfticks) ? (lf_ticks_to_sleep - sleep_compensation_lfticks) : 0;
   }
 
   if (lf_ticks_to_sleep <= (current_tick_count - last_update_lftick)) {
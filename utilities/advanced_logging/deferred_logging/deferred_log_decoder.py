@@ -0,0 +1,99 @@
+"""Decoder for the binary stream produced by the deferred logging backend.
+
+Usage: python deferred_log_decoder.py <application.elf> <capture.bin>
+
+Each record is a sequence of little-endian 32-bit words:
+  [0] 0xD1 marker | argument count | sequence number
+  [1] address of the format string in the application image
+  [2] kernel tick count
+  [3...] arguments
+Format strings (and %s arguments that point into flash) are read back from the ELF file.
+"""
+import re
+import struct
+from sys import argv
+
+from elftools.elf.elffile import ELFFile
+
+RECORD_MARKER = 0xD1
+HEADER_WORDS = 3
+FORMAT_SPEC = re.compile(r"%([-+ #0]*)(\d*)(?:\.(\d+))?(hh|h|ll|l|z|j|t)?([diuxXcspf%])")
+
+
+class Image:
+    """Read-only view of the loadable sections of an ELF image"""
+
+    def __init__(self, path):
+        self.sections = []
+        with open(path, "rb") as file:
+            elf = ELFFile(file)
+            for section in elf.iter_sections():
+                if section["sh_addr"] and section["sh_type"] == "SHT_PROGBITS":
+                    self.sections.append((section["sh_addr"], section.data()))
+
+    def string_at(self, address):
+        for base, data in self.sections:
+            if base <= address < base + len(data):
+                end = data.find(b"\0", address - base)
+                return data[address - base:end].decode("utf-8", "replace")
+        return None
+
+
+def convert(image, fmt, args):
+    """Apply C format specifiers to 32-bit arguments"""
+    args = list(args)
+
+    def substitute(match):
+        flags, width, precision, _, conversion = match.groups()
+        if conversion == "%":
+            return "%"
+        value = args.pop(0) if args else 0
+        if conversion == "s":
+            text = image.string_at(value)
+            return text if text is not None else "<0x%08x>" % value
+        if conversion in "di":
+            value = struct.unpack("<i", struct.pack("<I", value))[0]
+            conversion = "d"
+        elif conversion == "u":
+            conversion = "d"
+        elif conversion == "p":
+            return "0x%08x" % value
+        elif conversion == "f":
+            # Floats are promoted to double and do not fit in one record argument
+            return "<float>"
+        spec = "%" + flags + width + ("." + precision if precision else "") + conversion
+        return spec % value
+
+    return FORMAT_SPEC.sub(substitute, fmt)
+
+
+def decode(image, data):
+    words = [w[0] for w in struct.iter_unpack("<I", data[: len(data) & ~3])]
+    index = 0
+    while index + HEADER_WORDS <= len(words):
+        header = words[index]
+        if (header >> 24) != RECORD_MARKER:
+            # Lost synchronisation, skip to the next marker
+            index += 1
+            continue
+        count = (header >> 16) & 0xFF
+        sequence = header & 0xFFFF
+        address, tick = words[index + 1], words[index + 2]
+        args = words[index + HEADER_WORDS:index + HEADER_WORDS + count]
+        index += HEADER_WORDS + count
+        if address == 0:
+            print("[%10u] #%05u %u records dropped" % (tick, sequence, args[0] if args else 0))
+            continue
+        fmt = image.string_at(address)
+        if fmt is None:
+            print("[%10u] #%05u <unknown format 0x%08x> %s" % (tick, sequence, address, args))
+            continue
+        print("[%10u] #%05u %s" % (tick, sequence, convert(image, fmt, args).rstrip("\r\n")))
+
+
+if __name__ == "__main__":
+    if len(argv) != 3:
+        print("Usage: python deferred_log_decoder.py <application.elf> <capture.bin>")
+        raise SystemExit(1)
+    with open(argv[2], "rb") as capture:
+        decode(Image(argv[1]), capture.read())